@@ -13,6 +13,7 @@
 
 #include <cstring>
 #include <fstream>
+#include <limits>
 
 template <typename T>
 T readUnaligned(void *ptr) {
@@ -66,6 +67,22 @@ void BinaryDecoder::dumpField(void *&binaryPtr, const PTField &field, std::ostre
     binaryPtr = ptrOffset(binaryPtr, field.size);
 }
 
+void BinaryDecoder::dumpHex(const void *data, size_t size, std::ostream &ptmFile) {
+    static const char digits[] = "0123456789abcdef";
+    std::string line("\tHex");
+    line.reserve(line.size() + size * 3 + 1);
+    auto bytes = reinterpret_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; ++i) {
+        line += ' ';
+        if (bytes[i] > 0xf) {
+            line += digits[bytes[i] >> 4];
+        }
+        line += digits[bytes[i] & 0xf];
+    }
+    line += '\n';
+    ptmFile << line;
+}
+
 void *BinaryDecoder::getDevBinary() {
     binary = readBinaryFile(binaryFile);
     char *data = nullptr;
@@ -145,6 +162,22 @@ void BinaryDecoder::parseTokens() {
         exit(1);
     }
 
+    // Indexing derived structs once, instead of searching the whole list for every patch token
+    std::unordered_map<std::string, size_t> structPositions;
+    for (size_t i = 0; i < patchList.size(); ++i) {
+        auto structPos = patchList[i].find("struct ");
+        if (structPos == std::string::npos) {
+            continue;
+        }
+        auto nameStartPos = patchList[i].find_first_not_of(' ', structPos + 7);
+        auto nameEndPos = patchList[i].find(' ', nameStartPos);
+        if (nameStartPos == std::string::npos || nameEndPos == std::string::npos ||
+            patchList[i].find(':', nameEndPos) == std::string::npos) {
+            continue;
+        }
+        structPositions.emplace(patchList[i].substr(nameStartPos, nameEndPos - nameStartPos), i);
+    }
+
     // Reading all Patch Tokens and according structs
     uint8_t patchNo = 0;
     size_t patchTokenEnumPos = findPos(patchList, "enum PATCH_TOKEN");
@@ -174,14 +207,12 @@ void BinaryDecoder::parseTokens() {
             patchNo++;
             continue;
         }
-        std::string structName = "struct " + patchList[i].substr(nameStartPos + 1, nameEndPos - nameStartPos - 1) + " :";
-
-        size_t structPos = findPos(patchList, structName);
-        if (structPos == patchList.size()) {
+        auto structIt = structPositions.find(patchList[i].substr(nameStartPos + 1, nameEndPos - nameStartPos - 1));
+        if (structIt == structPositions.end()) {
             patchNo++;
             continue;
         }
-        patchTokenPtr->size = readStructFields(patchList, structPos + 1, patchTokenPtr->fields);
+        patchTokenPtr->size = readStructFields(patchList, structIt->second + 1, patchTokenPtr->fields);
         patchTokens[patchNo++] = std::move(patchTokenPtr);
     }
 
@@ -295,8 +326,10 @@ void BinaryDecoder::readPatchTokens(void *&patchListPtr, uint32_t patchListSize,
         auto Size = readUnaligned<uint32_t>(patchTokenPtr);
         patchTokenPtr = ptrOffset(patchTokenPtr, sizeof(uint32_t));
 
-        if (patchTokens.count(token) > 0) {
-            ptmFile << patchTokens[(token)]->name << ":\n";
+        auto patchTokenIt = patchTokens.find(static_cast<uint8_t>(token));
+        bool isKnownToken = (patchTokenIt != patchTokens.end()) && (token <= std::numeric_limits<uint8_t>::max());
+        if (isKnownToken) {
+            ptmFile << patchTokenIt->second->name << ":\n";
         } else {
             ptmFile << "Unidentified PatchToken:\n";
         }
@@ -304,9 +337,9 @@ void BinaryDecoder::readPatchTokens(void *&patchListPtr, uint32_t patchListSize,
         ptmFile << '\t' << "4 Token " << token << '\n';
         ptmFile << '\t' << "4 Size " << Size << '\n';
 
-        if (patchTokens.count(token) > 0) {
+        if (isKnownToken) {
             uint32_t fieldsSize = 0;
-            for (const auto &v : patchTokens[(token)]->fields) {
+            for (const auto &v : patchTokenIt->second->fields) {
                 if ((fieldsSize += v.size) > (Size - sizeof(uint32_t) * 2)) {
                     break;
                 }
@@ -320,13 +353,8 @@ void BinaryDecoder::readPatchTokens(void *&patchListPtr, uint32_t patchListSize,
         patchListPtr = ptrOffset(patchListPtr, Size);
 
         if (patchListPtr > patchTokenPtr) {
-            ptmFile << "\tHex";
-            uint8_t *byte = reinterpret_cast<uint8_t *>(patchTokenPtr);
-            while (ptrDiff(patchListPtr, patchTokenPtr) != 0) {
-                ptmFile << ' ' << std::hex << +*(byte++);
-                patchTokenPtr = ptrOffset(patchTokenPtr, sizeof(uint8_t));
-            }
-            ptmFile << std::dec << '\n';
+            dumpHex(patchTokenPtr, ptrDiff(patchListPtr, patchTokenPtr), ptmFile);
+            patchTokenPtr = patchListPtr;
         }
     }
 }
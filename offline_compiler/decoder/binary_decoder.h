@@ -42,6 +42,7 @@ class BinaryDecoder {
     PTMap patchTokens;
     std::string binaryFile, pathToPatch, pathToDump;
     void dumpField(void *&binaryPtr, const PTField &field, std::ostream &ptmFile);
+    void dumpHex(const void *data, size_t size, std::ostream &ptmFile);
     uint8_t getSize(const std::string &typeStr);
     void *getDevBinary();
     void parseTokens();
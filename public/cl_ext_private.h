@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "CL/cl.h"
 
 /***************************************
  * * Internal only queue properties *
@@ -34,3 +35,39 @@
  * ****************************************/
 /* performance counter */
 #define CL_PROFILING_COMMAND_PERFCOUNTERS_INTEL 0x407F
+
+/***************************************
+ * * read-only host memory import *
+ * ****************************************/
+// Used with CL_MEM_USE_HOST_PTR, CL_MEM_READ_ONLY and host read-only or no access flags.
+// host_ptr may point to memory that is not writable, e.g. private or shared mapping of a file.
+#define CL_MEM_READ_ONLY_HOST_PTR_INTEL (1 << 19)
+
+/***************************************
+ * * runtime telemetry *
+ * ****************************************/
+// Counters for clGetTelemetryDataINTEL
+#define CL_TELEMETRY_API_CALL_INTEL 0
+#define CL_TELEMETRY_FLUSH_TASK_INTEL 1
+#define CL_TELEMETRY_FLUSH_INTEL 2
+#define CL_TELEMETRY_WAIT_FOR_TASK_COUNT_INTEL 3
+#define CL_TELEMETRY_ALLOCATION_INTEL 4
+#define CL_TELEMETRY_RESIDENCY_INTEL 5
+
+// Log-linear latency buckets, 4 linear sub-buckets for every power of two nanoseconds
+#define CL_TELEMETRY_HISTOGRAM_BUCKETS_INTEL 256
+
+typedef struct _cl_telemetry_data_intel {
+    cl_ulong count;
+    cl_ulong totalNanoseconds;
+    cl_ulong maxNanoseconds;
+    cl_ulong histogram[CL_TELEMETRY_HISTOGRAM_BUCKETS_INTEL];
+} cl_telemetry_data_intel;
+
+/***************************************
+ * * command templates *
+ * ****************************************/
+// NDRange kernels recorded once on in-order queue and replayed with clEnqueueCommandTemplateINTEL
+typedef struct _cl_command_template_intel *cl_command_template_intel;
+
+#define CL_INVALID_COMMAND_TEMPLATE_INTEL -1102
@@ -12,6 +12,7 @@
 #include "runtime/accelerators/intel_motion_estimation.h"
 #include "runtime/built_ins/built_ins.h"
 #include "runtime/command_queue/command_queue.h"
+#include "runtime/command_queue/command_template.h"
 #include "runtime/command_stream/command_stream_receiver.h"
 #include "runtime/context/context.h"
 #include "runtime/context/driver_diagnostics.h"
@@ -562,7 +563,8 @@ cl_mem CL_API_CALL clCreateBuffer(cl_context context,
             ((flags & CL_MEM_COPY_HOST_PTR) && (flags & CL_MEM_USE_HOST_PTR)) ||
             ((flags & CL_MEM_HOST_READ_ONLY) && (flags & CL_MEM_HOST_NO_ACCESS)) ||
             ((flags & CL_MEM_HOST_READ_ONLY) && (flags & CL_MEM_HOST_WRITE_ONLY)) ||
-            ((flags & CL_MEM_HOST_WRITE_ONLY) && (flags & CL_MEM_HOST_NO_ACCESS))) {
+            ((flags & CL_MEM_HOST_WRITE_ONLY) && (flags & CL_MEM_HOST_NO_ACCESS)) ||
+            ((flags & CL_MEM_READ_ONLY_HOST_PTR_INTEL) && !((flags & CL_MEM_USE_HOST_PTR) && Buffer::isReadOnlyMemoryPermittedByFlags(flags)))) {
             retVal = CL_INVALID_VALUE;
             break;
         }
@@ -653,7 +655,7 @@ cl_mem CL_API_CALL clCreateSubBuffer(cl_mem buffer,
             flags |= parentFlags & (CL_MEM_HOST_WRITE_ONLY | CL_MEM_HOST_READ_ONLY |
                                     CL_MEM_HOST_NO_ACCESS);
         }
-        flags |= parentFlags & (CL_MEM_USE_HOST_PTR | CL_MEM_ALLOC_HOST_PTR | CL_MEM_COPY_HOST_PTR);
+        flags |= parentFlags & (CL_MEM_USE_HOST_PTR | CL_MEM_ALLOC_HOST_PTR | CL_MEM_COPY_HOST_PTR | CL_MEM_READ_ONLY_HOST_PTR_INTEL);
 
         if (bufferCreateType != CL_BUFFER_CREATE_TYPE_REGION) {
             retVal = CL_INVALID_VALUE;
@@ -1576,6 +1578,31 @@ cl_int CL_API_CALL clSetKernelArg(cl_kernel kernel,
     return retVal;
 }
 
+cl_int CL_API_CALL clSetKernelArgsINTEL(cl_kernel kernel,
+                                        cl_uint numArgs,
+                                        const cl_uint *argIndices,
+                                        const size_t *argSizes,
+                                        const void **argValues) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+
+    auto pKernel = castToObject<Kernel>(kernel);
+    DBG_LOG_INPUTS("kernel", kernel, "numArgs", numArgs,
+                   "argIndices", argIndices, "argSizes", argSizes, "argValues", argValues);
+    do {
+        if (!pKernel) {
+            retVal = CL_INVALID_KERNEL;
+            break;
+        }
+        if (numArgs == 0 || argIndices == nullptr || argSizes == nullptr || argValues == nullptr) {
+            retVal = CL_INVALID_VALUE;
+            break;
+        }
+        retVal = pKernel->setArgs(numArgs, argIndices, argSizes, argValues);
+    } while (false);
+    return retVal;
+}
+
 cl_int CL_API_CALL clGetKernelInfo(cl_kernel kernel,
                                    cl_kernel_info paramName,
                                    size_t paramValueSize,
@@ -2171,6 +2198,11 @@ cl_int CL_API_CALL clEnqueueFillBuffer(cl_command_queue commandQueue,
         EventWaitList(numEventsInWaitList, eventWaitList));
 
     if (CL_SUCCESS == retVal) {
+        if (pBuffer->deviceWriteMemObjFlagsInvalid()) {
+            retVal = CL_INVALID_OPERATION;
+            return retVal;
+        }
+
         retVal = pCommandQueue->enqueueFillBuffer(
             pBuffer,
             pattern,
@@ -2212,6 +2244,11 @@ cl_int CL_API_CALL clEnqueueCopyBuffer(cl_command_queue commandQueue,
         WithCastToInternal(dstBuffer, &pDstBuffer));
 
     if (CL_SUCCESS == retVal) {
+        if (pDstBuffer->deviceWriteMemObjFlagsInvalid()) {
+            retVal = CL_INVALID_OPERATION;
+            return retVal;
+        }
+
         size_t srcSize = pSrcBuffer->getSize();
         size_t dstSize = pDstBuffer->getSize();
         if (srcOffset + cb > srcSize || dstOffset + cb > dstSize) {
@@ -2269,6 +2306,11 @@ cl_int CL_API_CALL clEnqueueCopyBufferRect(cl_command_queue commandQueue,
         WithCastToInternal(dstBuffer, &pDstBuffer));
 
     if (CL_SUCCESS == retVal) {
+        if (pDstBuffer->deviceWriteMemObjFlagsInvalid()) {
+            retVal = CL_INVALID_OPERATION;
+            return retVal;
+        }
+
         retVal = pCommandQueue->enqueueCopyBufferRect(
             pSrcBuffer,
             pDstBuffer,
@@ -2555,6 +2597,10 @@ cl_int CL_API_CALL clEnqueueCopyImageToBuffer(cl_command_queue commandQueue,
         WithCastToInternal(dstBuffer, &pDstBuffer));
 
     if (CL_SUCCESS == retVal) {
+        if (pDstBuffer->deviceWriteMemObjFlagsInvalid()) {
+            retVal = CL_INVALID_OPERATION;
+            return retVal;
+        }
         if (IsPackedYuvImage(&pSrcImage->getImageFormat())) {
             retVal = validateYuvOperation(srcOrigin, region);
             if (retVal != CL_SUCCESS)
@@ -3151,6 +3197,179 @@ clSetPerformanceConfigurationINTEL(
     return retVal;
 }
 
+cl_int CL_API_CALL clGetTelemetryDataINTEL(cl_uint counter,
+                                           cl_telemetry_data_intel *data) {
+    cl_int retVal = CL_SUCCESS;
+    DBG_LOG_INPUTS("counter", counter, "data", data);
+    if (counter >= Telemetry::countersCount || data == nullptr) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    TelemetryCounterData counterData;
+    Telemetry::collect(static_cast<TelemetryCounter>(counter), counterData);
+
+    data->count = counterData.count;
+    data->totalNanoseconds = counterData.totalNanoseconds;
+    data->maxNanoseconds = counterData.maxNanoseconds;
+    static_assert(CL_TELEMETRY_HISTOGRAM_BUCKETS_INTEL == TelemetryHistogram::bucketsCount, "histogram size mismatch");
+    for (uint32_t i = 0; i < TelemetryHistogram::bucketsCount; i++) {
+        data->histogram[i] = counterData.histogram[i];
+    }
+    return retVal;
+}
+
+cl_command_template_intel CL_API_CALL clCreateCommandTemplateINTEL(cl_command_queue commandQueue,
+                                                                   cl_int *errcodeRet) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandQueue", commandQueue);
+
+    CommandQueue *pCommandQueue = nullptr;
+    CommandTemplate *pCommandTemplate = nullptr;
+
+    do {
+        retVal = validateObjects(WithCastToInternal(commandQueue, &pCommandQueue));
+        if (retVal != CL_SUCCESS) {
+            break;
+        }
+
+        pCommandTemplate = CommandTemplate::create(pCommandQueue, retVal);
+    } while (false);
+
+    if (errcodeRet) {
+        *errcodeRet = retVal;
+    }
+    return pCommandTemplate;
+}
+
+cl_int CL_API_CALL clCommandTemplateNDRangeKernelINTEL(cl_command_template_intel commandTemplate,
+                                                       cl_kernel kernel,
+                                                       cl_uint workDim,
+                                                       const size_t *globalWorkOffset,
+                                                       const size_t *globalWorkSize,
+                                                       const size_t *localWorkSize) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandTemplate", commandTemplate, "kernel", kernel,
+                   "globalWorkOffset[0]", DebugManager.getInput(globalWorkOffset, 0),
+                   "globalWorkOffset[1]", DebugManager.getInput(globalWorkOffset, 1),
+                   "globalWorkOffset[2]", DebugManager.getInput(globalWorkOffset, 2),
+                   "globalWorkSize", DebugManager.getSizes(globalWorkSize, workDim, false),
+                   "localWorkSize", DebugManager.getSizes(localWorkSize, workDim, true));
+
+    auto pCommandTemplate = castToObject<CommandTemplate>(commandTemplate);
+    if (!pCommandTemplate) {
+        retVal = CL_INVALID_COMMAND_TEMPLATE_INTEL;
+        return retVal;
+    }
+
+    Kernel *pKernel = nullptr;
+    retVal = validateObjects(WithCastToInternal(kernel, &pKernel));
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    retVal = pCommandTemplate->recordNDRangeKernel(*pKernel, workDim, globalWorkOffset, globalWorkSize, localWorkSize);
+    return retVal;
+}
+
+cl_int CL_API_CALL clFinalizeCommandTemplateINTEL(cl_command_template_intel commandTemplate) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandTemplate", commandTemplate);
+
+    auto pCommandTemplate = castToObject<CommandTemplate>(commandTemplate);
+    if (!pCommandTemplate) {
+        retVal = CL_INVALID_COMMAND_TEMPLATE_INTEL;
+        return retVal;
+    }
+
+    retVal = pCommandTemplate->finalize();
+    return retVal;
+}
+
+cl_int CL_API_CALL clSetCommandTemplateGlobalWorkSizeINTEL(cl_command_template_intel commandTemplate,
+                                                           cl_uint commandIndex,
+                                                           const size_t *globalWorkSize) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandTemplate", commandTemplate, "commandIndex", commandIndex, "globalWorkSize", globalWorkSize);
+
+    auto pCommandTemplate = castToObject<CommandTemplate>(commandTemplate);
+    if (!pCommandTemplate) {
+        retVal = CL_INVALID_COMMAND_TEMPLATE_INTEL;
+        return retVal;
+    }
+
+    retVal = pCommandTemplate->setGlobalWorkSize(commandIndex, globalWorkSize);
+    return retVal;
+}
+
+cl_int CL_API_CALL clEnqueueCommandTemplateINTEL(cl_command_queue commandQueue,
+                                                 cl_command_template_intel commandTemplate,
+                                                 cl_uint numEventsInWaitList,
+                                                 const cl_event *eventWaitList,
+                                                 cl_event *event) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandQueue", commandQueue, "commandTemplate", commandTemplate,
+                   "numEventsInWaitList", numEventsInWaitList,
+                   "eventWaitList", DebugManager.getEvents(reinterpret_cast<const uintptr_t *>(eventWaitList), numEventsInWaitList),
+                   "event", DebugManager.getEvents(reinterpret_cast<const uintptr_t *>(event), 1));
+
+    CommandQueue *pCommandQueue = nullptr;
+    retVal = validateObjects(
+        WithCastToInternal(commandQueue, &pCommandQueue),
+        EventWaitList(numEventsInWaitList, eventWaitList));
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    auto pCommandTemplate = castToObject<CommandTemplate>(commandTemplate);
+    if (!pCommandTemplate) {
+        retVal = CL_INVALID_COMMAND_TEMPLATE_INTEL;
+        return retVal;
+    }
+    if (&pCommandTemplate->getCommandQueue() != pCommandQueue) {
+        retVal = CL_INVALID_COMMAND_QUEUE;
+        return retVal;
+    }
+
+    retVal = pCommandQueue->enqueueCommandTemplate(*pCommandTemplate, numEventsInWaitList, eventWaitList, event);
+    return retVal;
+}
+
+cl_int CL_API_CALL clRetainCommandTemplateINTEL(cl_command_template_intel commandTemplate) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandTemplate", commandTemplate);
+
+    auto pCommandTemplate = castToObject<CommandTemplate>(commandTemplate);
+    if (!pCommandTemplate) {
+        retVal = CL_INVALID_COMMAND_TEMPLATE_INTEL;
+        return retVal;
+    }
+
+    pCommandTemplate->retain();
+    return retVal;
+}
+
+cl_int CL_API_CALL clReleaseCommandTemplateINTEL(cl_command_template_intel commandTemplate) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandTemplate", commandTemplate);
+
+    auto pCommandTemplate = castToObject<CommandTemplate>(commandTemplate);
+    if (!pCommandTemplate) {
+        retVal = CL_INVALID_COMMAND_TEMPLATE_INTEL;
+        return retVal;
+    }
+
+    pCommandTemplate->release();
+    return retVal;
+}
+
 cl_command_queue CL_API_CALL clCreateCommandQueueWithPropertiesKHR(cl_context context,
                                                                    cl_device_id device,
                                                                    const cl_queue_properties_khr *properties,
@@ -3329,6 +3548,18 @@ void *CL_API_CALL clGetExtensionFunctionAddress(const char *func_name) {
     //perf counters
     RETURN_FUNC_PTR_IF_EXIST(clCreatePerfCountersCommandQueueINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clSetPerformanceConfigurationINTEL);
+    // batched kernel argument setup
+    RETURN_FUNC_PTR_IF_EXIST(clSetKernelArgsINTEL);
+    // runtime telemetry
+    RETURN_FUNC_PTR_IF_EXIST(clGetTelemetryDataINTEL);
+    // command templates
+    RETURN_FUNC_PTR_IF_EXIST(clCreateCommandTemplateINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandTemplateNDRangeKernelINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clFinalizeCommandTemplateINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clSetCommandTemplateGlobalWorkSizeINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clEnqueueCommandTemplateINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clRetainCommandTemplateINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clReleaseCommandTemplateINTEL);
     // Support device extensions
     RETURN_FUNC_PTR_IF_EXIST(clCreateAcceleratorINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clGetAcceleratorInfoINTEL);
@@ -8,6 +8,7 @@
 #include "CL/cl.h"
 #include "CL/cl_gl.h"
 #include "runtime/api/dispatch.h"
+#include "public/cl_ext_private.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -856,6 +857,59 @@ clSetPerformanceConfigurationINTEL(
     cl_uint *offsets,
     cl_uint *values);
 
+extern CL_API_ENTRY cl_int CL_API_CALL
+clSetKernelArgsINTEL(
+    cl_kernel kernel,
+    cl_uint numArgs,
+    const cl_uint *argIndices,
+    const size_t *argSizes,
+    const void **argValues);
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clGetTelemetryDataINTEL(
+    cl_uint counter,
+    cl_telemetry_data_intel *data);
+
+extern CL_API_ENTRY cl_command_template_intel CL_API_CALL
+clCreateCommandTemplateINTEL(
+    cl_command_queue commandQueue,
+    cl_int *errcodeRet);
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clCommandTemplateNDRangeKernelINTEL(
+    cl_command_template_intel commandTemplate,
+    cl_kernel kernel,
+    cl_uint workDim,
+    const size_t *globalWorkOffset,
+    const size_t *globalWorkSize,
+    const size_t *localWorkSize);
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clFinalizeCommandTemplateINTEL(
+    cl_command_template_intel commandTemplate);
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clSetCommandTemplateGlobalWorkSizeINTEL(
+    cl_command_template_intel commandTemplate,
+    cl_uint commandIndex,
+    const size_t *globalWorkSize);
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clEnqueueCommandTemplateINTEL(
+    cl_command_queue commandQueue,
+    cl_command_template_intel commandTemplate,
+    cl_uint numEventsInWaitList,
+    const cl_event *eventWaitList,
+    cl_event *event);
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clRetainCommandTemplateINTEL(
+    cl_command_template_intel commandTemplate);
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clReleaseCommandTemplateINTEL(
+    cl_command_template_intel commandTemplate);
+
 extern CL_API_ENTRY cl_event CL_API_CALL
 clCreateEventFromGLsyncKHR(
     cl_context context,
@@ -21,6 +21,9 @@ struct _cl_accelerator_intel : public ClDispatch {
 struct _cl_command_queue : public ClDispatch {
 };
 
+struct _cl_command_template_intel : public ClDispatch {
+};
+
 // device_queue is a type used internally
 struct _device_queue : public _cl_command_queue {
 };
@@ -36,6 +36,10 @@ BuiltIns::BuiltIns() {
 }
 
 BuiltIns::~BuiltIns() {
+    // kernels of builders reference built-in programs
+    for (auto &operationBuilder : BuiltinOpsBuilders) {
+        operationBuilder.first.reset();
+    }
     delete static_cast<SchedulerKernel *>(schedulerBuiltIn.pKernel);
     delete schedulerBuiltIn.pProgram;
     schedulerBuiltIn.pKernel = nullptr;
@@ -736,44 +740,54 @@ class BuiltInOp<HWFamily, EBuiltInOps::FillImage3d> : public BuiltinDispatchInfo
 BuiltinDispatchInfoBuilder &BuiltIns::getBuiltinDispatchInfoBuilder(EBuiltInOps operation, Context &context, Device &device) {
     uint32_t operationId = static_cast<uint32_t>(operation);
     auto &operationBuilder = BuiltinOpsBuilders[operationId];
+    std::call_once(operationBuilder.second, [&] { operationBuilder.first = createBuiltinDispatchInfoBuilder(operation, context, device); });
+    return *operationBuilder.first;
+}
+
+std::unique_ptr<BuiltinDispatchInfoBuilder> BuiltIns::createBuiltinDispatchInfoBuilder(EBuiltInOps operation, Context &context, Device &device) {
     switch (operation) {
     default:
         throw std::runtime_error("getBuiltinDispatchInfoBuilder failed");
     case EBuiltInOps::CopyBufferToBuffer:
-        std::call_once(operationBuilder.second, [&] { operationBuilder.first = std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::CopyBufferToBuffer>>(*this, context, device); });
-        break;
+        return std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::CopyBufferToBuffer>>(*this, context, device);
     case EBuiltInOps::CopyBufferRect:
-        std::call_once(operationBuilder.second, [&] { operationBuilder.first = std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::CopyBufferRect>>(*this, context, device); });
-        break;
+        return std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::CopyBufferRect>>(*this, context, device);
     case EBuiltInOps::FillBuffer:
-        std::call_once(operationBuilder.second, [&] { operationBuilder.first = std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::FillBuffer>>(*this, context, device); });
-        break;
+        return std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::FillBuffer>>(*this, context, device);
     case EBuiltInOps::CopyBufferToImage3d:
-        std::call_once(operationBuilder.second, [&] { operationBuilder.first = std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::CopyBufferToImage3d>>(*this, context, device); });
-        break;
+        return std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::CopyBufferToImage3d>>(*this, context, device);
     case EBuiltInOps::CopyImage3dToBuffer:
-        std::call_once(operationBuilder.second, [&] { operationBuilder.first = std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::CopyImage3dToBuffer>>(*this, context, device); });
-        break;
+        return std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::CopyImage3dToBuffer>>(*this, context, device);
     case EBuiltInOps::CopyImageToImage3d:
-        std::call_once(operationBuilder.second, [&] { operationBuilder.first = std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::CopyImageToImage3d>>(*this, context, device); });
-        break;
+        return std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::CopyImageToImage3d>>(*this, context, device);
     case EBuiltInOps::FillImage3d:
-        std::call_once(operationBuilder.second, [&] { operationBuilder.first = std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::FillImage3d>>(*this, context, device); });
-        break;
+        return std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::FillImage3d>>(*this, context, device);
     case EBuiltInOps::VmeBlockMotionEstimateIntel:
-        std::call_once(operationBuilder.second, [&] { operationBuilder.first = std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::VmeBlockMotionEstimateIntel>>(*this, context, device); });
-        break;
+        return std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::VmeBlockMotionEstimateIntel>>(*this, context, device);
     case EBuiltInOps::VmeBlockAdvancedMotionEstimateCheckIntel:
-        std::call_once(operationBuilder.second, [&] { operationBuilder.first = std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::VmeBlockAdvancedMotionEstimateCheckIntel>>(*this, context, device); });
-        break;
+        return std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::VmeBlockAdvancedMotionEstimateCheckIntel>>(*this, context, device);
     case EBuiltInOps::VmeBlockAdvancedMotionEstimateBidirectionalCheckIntel:
-        std::call_once(operationBuilder.second, [&] { operationBuilder.first = std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::VmeBlockAdvancedMotionEstimateBidirectionalCheckIntel>>(*this, context, device); });
-        break;
+        return std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::VmeBlockAdvancedMotionEstimateBidirectionalCheckIntel>>(*this, context, device);
     case EBuiltInOps::AuxTranslation:
-        std::call_once(operationBuilder.second, [&] { operationBuilder.first = std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::AuxTranslation>>(*this, context, device); });
-        break;
+        return std::make_unique<BuiltInOp<HWFamily, EBuiltInOps::AuxTranslation>>(*this, context, device);
     }
-    return *operationBuilder.first;
+}
+
+Program *BuiltIns::getBuiltinProgram(EBuiltInOps operation, const char *options, Context &context, Device &device) {
+    auto &builtinProgram = builtinPrograms[static_cast<uint32_t>(operation)];
+    std::call_once(builtinProgram.second, [&] {
+        auto src = getBuiltinsLib().getBuiltinCode(operation, BuiltinCode::ECodeType::Any, device);
+        builtinProgram.first = BuiltinsLib::createProgramFromCode(src, context, device);
+        builtinProgram.first->build(0, nullptr, options, nullptr, nullptr, enableCacheing);
+    });
+    return builtinProgram.first.get();
+}
+
+std::unique_ptr<BuiltinDispatchInfoBuilder> BuiltinDispatchInfoBuilder::clone(Context &context, Device &device) const {
+    if (!isCloneable()) {
+        return nullptr;
+    }
+    return kernelsLib.createBuiltinDispatchInfoBuilder(operation, context, device);
 }
 
 std::unique_ptr<BuiltinDispatchInfoBuilder> BuiltIns::setBuiltinDispatchInfoBuilder(EBuiltInOps operation, Context &context, Device &device, std::unique_ptr<BuiltinDispatchInfoBuilder> builder) {
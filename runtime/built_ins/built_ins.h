@@ -176,6 +176,7 @@ class BuiltIns {
     std::pair<std::unique_ptr<BuiltinDispatchInfoBuilder>, std::once_flag> BuiltinOpsBuilders[static_cast<uint32_t>(EBuiltInOps::COUNT)];
 
     BuiltinDispatchInfoBuilder &getBuiltinDispatchInfoBuilder(EBuiltInOps op, Context &context, Device &device);
+    std::unique_ptr<BuiltinDispatchInfoBuilder> createBuiltinDispatchInfoBuilder(EBuiltInOps op, Context &context, Device &device);
     std::unique_ptr<BuiltinDispatchInfoBuilder> setBuiltinDispatchInfoBuilder(EBuiltInOps op, Context &context, Device &device,
                                                                               std::unique_ptr<BuiltinDispatchInfoBuilder> newBuilder);
     BuiltIns();
@@ -187,6 +188,9 @@ class BuiltIns {
         const char *kernelNames,
         int &errcodeRet);
 
+    // program of built-in operation, built once and shared by all dispatch info builders of that operation
+    Program *getBuiltinProgram(EBuiltInOps op, const char *options, Context &context, Device &device);
+
     SchedulerKernel &getSchedulerKernel(Context &context);
 
     MOCKABLE_VIRTUAL const SipKernel &getSipKernel(SipKernelType type, Device &device);
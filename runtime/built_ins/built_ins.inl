@@ -12,9 +12,8 @@
 namespace OCLRT {
 template <typename... KernelsDescArgsT>
 void BuiltinDispatchInfoBuilder::populate(Context &context, Device &device, EBuiltInOps op, const char *options, KernelsDescArgsT &&... desc) {
-    auto src = kernelsLib.getBuiltinsLib().getBuiltinCode(op, BuiltinCode::ECodeType::Any, device);
-    prog.reset(BuiltinsLib::createProgramFromCode(src, context, device).release());
-    prog->build(0, nullptr, options, nullptr, nullptr, kernelsLib.isCacheingEnabled());
+    prog = kernelsLib.getBuiltinProgram(op, options, context, device);
+    operation = op;
     grabKernels(std::forward<KernelsDescArgsT>(desc)...);
 }
 
@@ -27,8 +26,17 @@ BuiltInOp<HWFamily, EBuiltInOps::AuxTranslation>::BuiltInOp(BuiltIns &kernelsLib
 
 template <typename HWFamily>
 bool BuiltInOp<HWFamily, EBuiltInOps::AuxTranslation>::buildDispatchInfos(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const {
+    auto &kernelInstances = (AuxTranslationDirection::AuxToNonAux == operationParams.auxTranslationDirection) ? convertToNonAuxKernel : convertToAuxKernel;
+    // translations in both directions may be dispatched before and after a kernel, skip instances already used by this multi dispatch
     size_t kernelInstanceNumber = 0;
-    resizeKernelInstances(operationParams.buffersForAuxTranslation->size());
+    for (auto &dispatchInfo : multiDispatchInfo) {
+        for (auto &kernelInstance : kernelInstances) {
+            if (dispatchInfo.getKernel() == kernelInstance.get()) {
+                kernelInstanceNumber++;
+            }
+        }
+    }
+    resizeKernelInstances(kernelInstanceNumber + operationParams.buffersForAuxTranslation->size());
 
     for (auto &buffer : *operationParams.buffersForAuxTranslation) {
         DispatchInfoBuilder<SplitDispatch::Dim::d1D, SplitDispatch::SplitMode::NoSplit> builder;
@@ -36,12 +44,12 @@ bool BuiltInOp<HWFamily, EBuiltInOps::AuxTranslation>::buildDispatchInfos(MultiD
         size_t allocationSize = graphicsAllocation->getUnderlyingBufferSize();
 
         if (AuxTranslationDirection::AuxToNonAux == operationParams.auxTranslationDirection) {
-            builder.setKernel(convertToNonAuxKernel.at(kernelInstanceNumber++).get());
+            builder.setKernel(kernelInstances.at(kernelInstanceNumber++).get());
             builder.setArg(0, buffer);
             builder.setArgSvm(1, allocationSize, reinterpret_cast<void *>(graphicsAllocation->getGpuAddress()));
         } else {
             UNRECOVERABLE_IF(AuxTranslationDirection::NonAuxToAux != operationParams.auxTranslationDirection);
-            builder.setKernel(convertToAuxKernel.at(kernelInstanceNumber++).get());
+            builder.setKernel(kernelInstances.at(kernelInstanceNumber++).get());
             builder.setArgSvm(0, allocationSize, reinterpret_cast<void *>(graphicsAllocation->getGpuAddress()));
             builder.setArg(1, buffer);
         }
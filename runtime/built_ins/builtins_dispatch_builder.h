@@ -77,6 +77,11 @@ class BuiltinDispatchInfoBuilder {
 
     std::vector<std::unique_ptr<Kernel>> &peekUsedKernels() { return usedKernels; }
 
+    // Creates builder of the same operation dispatching through its own kernel instances,
+    // so it can be owned by a single command queue. Builders not populated from built-in program can't be cloned.
+    bool isCloneable() const { return operation != EBuiltInOps::COUNT; }
+    std::unique_ptr<BuiltinDispatchInfoBuilder> clone(Context &context, Device &device) const;
+
   protected:
     template <typename KernelNameT, typename... KernelsDescArgsT>
     void grabKernels(KernelNameT &&kernelName, Kernel *&kernelDst, KernelsDescArgsT &&... kernelsDesc) {
@@ -85,7 +90,7 @@ class BuiltinDispatchInfoBuilder {
             return;
         }
         cl_int err = 0;
-        kernelDst = Kernel::create(prog.get(), *kernelInfo, &err);
+        kernelDst = Kernel::create(prog, *kernelInfo, &err);
         kernelDst->isBuiltIn = true;
         usedKernels.push_back(std::unique_ptr<Kernel>(kernelDst));
         grabKernels(std::forward<KernelsDescArgsT>(kernelsDesc)...);
@@ -93,7 +98,8 @@ class BuiltinDispatchInfoBuilder {
 
     cl_int grabKernels() { return CL_SUCCESS; }
 
-    std::unique_ptr<Program> prog;
+    Program *prog = nullptr; // owned by BuiltIns, shared by all builders of the operation
+    EBuiltInOps operation = EBuiltInOps::COUNT;
     std::vector<std::unique_ptr<Kernel>> usedKernels;
     BuiltIns &kernelsLib;
 };
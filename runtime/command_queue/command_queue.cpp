@@ -14,9 +14,11 @@
 #include "runtime/device_queue/device_queue.h"
 #include "runtime/event/event.h"
 #include "runtime/event/event_builder.h"
+#include "runtime/gmm_helper/gmm.h"
 #include "runtime/gtpin/gtpin_notify.h"
 #include "runtime/helpers/aligned_memory.h"
 #include "runtime/helpers/array_count.h"
+#include "runtime/helpers/blit_commands_helper.h"
 #include "runtime/helpers/get_info.h"
 #include "runtime/helpers/mipmap.h"
 #include "runtime/helpers/options.h"
@@ -108,6 +110,11 @@ CommandQueue::~CommandQueue() {
         }
     }
 
+    // kernels of cloned builders reference built-in programs owned by the device
+    for (auto &builtinDispatchInfoBuilder : builtinDispatchInfoBuilders) {
+        builtinDispatchInfoBuilder.first.reset();
+    }
+
     //for normal queue, decrement ref count on context
     //special queue is owned by context so ref count doesn't have to be decremented
     if (context && !isSpecialCommandQueue) {
@@ -138,6 +145,11 @@ void CommandQueue::waitUntilComplete(uint32_t taskCountToWait, FlushStamp flushS
 
     device->getCommandStreamReceiver().waitForTaskCountWithKmdNotifyFallback(taskCountToWait, flushStampToWait, useQuickKmdSleep, *device->getOsContext());
 
+    auto blitterCommandStreamReceiver = device->getBlitterCommandStreamReceiver();
+    if (blitterCommandStreamReceiver && blitterTaskCount) {
+        blitterCommandStreamReceiver->waitForCompletionWithTimeout(false, TimeoutControls::maxTimeout, blitterTaskCount);
+    }
+
     DEBUG_BREAK_IF(getHwTag() < taskCountToWait);
     latestTaskCountWaited = taskCountToWait;
     WAIT_LEAVE()
@@ -177,6 +189,53 @@ bool CommandQueue::isQueueBlocked() {
     return false;
 }
 
+bool CommandQueue::isBlitEnqueueAllowed(cl_uint numEventsInWaitList, cl_event *event, const GraphicsAllocation &srcAllocation, const GraphicsAllocation &dstAllocation) {
+    // blitter copies raw memory, it can't access compressed contents
+    auto isCompressed = [](const GraphicsAllocation &allocation) {
+        return allocation.getAllocationType() == GraphicsAllocation::AllocationType::BUFFER_COMPRESSED ||
+               (allocation.gmm && allocation.gmm->isRenderCompressed);
+    };
+    return device->getBlitterCommandStreamReceiver() != nullptr &&
+           numEventsInWaitList == 0 && event == nullptr &&
+           !isCompressed(srcAllocation) && !isCompressed(dstAllocation) &&
+           !isQueueBlocked();
+}
+
+void CommandQueue::enqueueBlit(BlitProperties &blitProperties, bool blocking) {
+    auto &commandStreamReceiver = device->getCommandStreamReceiver();
+    auto commandStreamReceiverOwnership = commandStreamReceiver.obtainUniqueOwnership();
+    TakeOwnershipWrapper<CommandQueue> queueOwnership(*this);
+
+    if (!isCompleted(taskCount)) {
+        // batched render engine work has to reach the GPU before blitter starts waiting for it
+        commandStreamReceiver.flushBatchedSubmissions();
+        blitProperties.dependencyTagAllocation = commandStreamReceiver.getTagAllocation();
+        blitProperties.dependencyTaskCount = taskCount;
+    }
+
+    blitterTaskCount = device->getBlitterCommandStreamReceiver()->blitBuffer(blitProperties, *device->getOsContext());
+    blitterDependencyPending = true;
+    blitProperties.srcAllocation->blitterTaskCount = blitterTaskCount;
+    blitProperties.dstAllocation->blitterTaskCount = blitterTaskCount;
+
+    if (blocking) {
+        waitForBlitterDependency();
+    }
+}
+
+bool CommandQueue::isBlitterCompleted(uint32_t blitterTaskCountToCheck) const {
+    auto blitterCommandStreamReceiver = device->getBlitterCommandStreamReceiver();
+    return blitterTaskCountToCheck == 0 || blitterCommandStreamReceiver == nullptr ||
+           *blitterCommandStreamReceiver->getTagAddress() >= blitterTaskCountToCheck;
+}
+
+void CommandQueue::waitForBlitterDependency() {
+    if (blitterDependencyPending) {
+        device->getBlitterCommandStreamReceiver()->waitForCompletionWithTimeout(false, TimeoutControls::maxTimeout, blitterTaskCount);
+        blitterDependencyPending = false;
+    }
+}
+
 cl_int CommandQueue::getCommandQueueInfo(cl_command_queue_info paramName,
                                          size_t paramValueSize,
                                          void *paramValue,
@@ -195,6 +254,36 @@ uint32_t CommandQueue::getTaskLevelFromWaitList(uint32_t taskLevel,
     return taskLevel;
 }
 
+CommandStreamReceiver *CommandQueue::getOtherCsrOfDependency(cl_event dependency) {
+    auto pEvent = castToObjectOrAbort<Event>(dependency);
+    if (pEvent->isUserEvent() || !pEvent->getCommandQueue() || pEvent->peekTaskCount() == Event::eventNotReady) {
+        return nullptr;
+    }
+    auto &eventCommandStreamReceiver = pEvent->getCommandQueue()->getDevice().getCommandStreamReceiver();
+    if (&eventCommandStreamReceiver == &device->getCommandStreamReceiver()) {
+        return nullptr;
+    }
+    return &eventCommandStreamReceiver;
+}
+
+void CommandQueue::flushDependenciesFromOtherCsrs(cl_uint numEventsInWaitList, const cl_event *eventWaitList) {
+    for (auto iEvent = 0u; iEvent < numEventsInWaitList; ++iEvent) {
+        auto eventCommandStreamReceiver = getOtherCsrOfDependency(eventWaitList[iEvent]);
+        if (eventCommandStreamReceiver) {
+            eventCommandStreamReceiver->flushBatchedSubmissions();
+        }
+    }
+}
+
+bool CommandQueue::hasDependenciesFromOtherCsrs(cl_uint numEventsInWaitList, const cl_event *eventWaitList) {
+    for (auto iEvent = 0u; iEvent < numEventsInWaitList; ++iEvent) {
+        if (getOtherCsrOfDependency(eventWaitList[iEvent])) {
+            return true;
+        }
+    }
+    return false;
+}
+
 LinearStream &CommandQueue::getCS(size_t minRequiredSize) {
     DEBUG_BREAK_IF(nullptr == device);
     auto &commandStreamReceiver = device->getCommandStreamReceiver();
@@ -533,6 +622,45 @@ void CommandQueue::enqueueBlockedMapUnmapOperation(const cl_event *eventWaitList
     this->virtualEvent = eventBuilder->getEvent();
 }
 
+CompletionStamp &CommandQueue::submitUnblockedCommand(Command &command, uint32_t taskLevel, bool terminated) {
+    if (command.isBlocking()) {
+        // blocking commands wait for their own completion, don't stall other producers' submission with them
+        return command.submit(taskLevel, terminated);
+    }
+
+    command.readyTaskLevel = taskLevel;
+    command.readyTerminated = terminated;
+    readyCommands.pushFrontOne(command);
+
+    // CSR ownership is recursive, so a producer that already owns it (e.g. enqueue unblocking its own event) submits directly.
+    // The owner submits only commands that were ready when it detached the list, later ones are submitted by their producers.
+    auto commandStreamReceiverOwnership = device->getCommandStreamReceiver().obtainUniqueOwnership();
+    if (!command.submitted.load(std::memory_order_acquire)) {
+        submitReadyCommands();
+    }
+    return command.completionStamp;
+}
+
+void CommandQueue::submitReadyCommands() {
+    // ready-list is LIFO, restore the order in which commands became ready
+    Command *pendingCommands = nullptr;
+    auto readyCommand = readyCommands.detachNodes();
+    while (readyCommand != nullptr) {
+        auto next = readyCommand->next;
+        readyCommand->next = pendingCommands;
+        pendingCommands = readyCommand;
+        readyCommand = next;
+    }
+
+    while (pendingCommands != nullptr) {
+        auto command = pendingCommands;
+        pendingCommands = command->next;
+        command->next = nullptr;
+        command->submit(command->readyTaskLevel, command->readyTerminated);
+        command->submitted.store(true, std::memory_order_release);
+    }
+}
+
 bool CommandQueue::setupDebugSurface(Kernel *kernel) {
     auto &commandStreamReceiver = device->getCommandStreamReceiver();
     auto debugSurface = commandStreamReceiver.getDebugSurfaceAllocation();
@@ -565,7 +693,7 @@ void CommandQueue::releaseIndirectHeap(IndirectHeap::Type heapType) {
 
 void CommandQueue::dispatchAuxTranslation(MultiDispatchInfo &multiDispatchInfo, BuffersForAuxTranslation &buffersForAuxTranslation,
                                           AuxTranslationDirection auxTranslationDirection) {
-    auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::AuxTranslation, getContext(), getDevice());
+    auto &builder = getBuiltinDispatchInfoBuilder(EBuiltInOps::AuxTranslation);
     BuiltinDispatchInfoBuilder::BuiltinOpParams dispatchParams;
 
     dispatchParams.buffersForAuxTranslation = &buffersForAuxTranslation;
@@ -574,6 +702,18 @@ void CommandQueue::dispatchAuxTranslation(MultiDispatchInfo &multiDispatchInfo,
     builder.buildDispatchInfos(multiDispatchInfo, dispatchParams);
 }
 
+BuiltinDispatchInfoBuilder &CommandQueue::getBuiltinDispatchInfoBuilder(EBuiltInOps operation) {
+    auto &sharedBuilder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(operation, getContext(), getDevice());
+    if (!sharedBuilder.isCloneable()) {
+        // builder substituted in BuiltIns is used as it is
+        return sharedBuilder;
+    }
+
+    auto &queueBuilder = builtinDispatchInfoBuilders[static_cast<uint32_t>(operation)];
+    std::call_once(queueBuilder.second, [&] { queueBuilder.first = sharedBuilder.clone(getContext(), getDevice()); });
+    return *queueBuilder.first;
+}
+
 void CommandQueue::obtainNewTimestampPacketNodes(size_t numberOfNodes, TimestampPacketContainer &previousNodes) {
     auto allocator = device->getMemoryManager()->getTimestampPacketAllocator();
 
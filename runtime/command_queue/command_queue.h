@@ -7,21 +7,30 @@
 
 #pragma once
 #include "runtime/api/cl_types.h"
+#include "runtime/built_ins/built_ins.h"
 #include "runtime/indirect_heap/indirect_heap.h"
 #include "runtime/helpers/base_object.h"
 #include "runtime/helpers/properties_helper.h"
 #include "runtime/helpers/timestamp_packet.h"
 #include "runtime/event/user_event.h"
 #include "runtime/os_interface/performance_counters.h"
+#include "runtime/utilities/iflist.h"
 #include <atomic>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 
 namespace OCLRT {
+struct BlitProperties;
 class Buffer;
+class BuiltinDispatchInfoBuilder;
+class CommandStreamReceiver;
+class CommandTemplate;
 class LinearStream;
 class Context;
 class Device;
 class EventBuilder;
+class GraphicsAllocation;
 class Image;
 class IndirectHeap;
 class Kernel;
@@ -113,6 +122,13 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
         return CL_SUCCESS;
     }
 
+    virtual cl_int enqueueCommandTemplate(CommandTemplate &commandTemplate,
+                                          cl_uint numEventsInWaitList,
+                                          const cl_event *eventWaitList,
+                                          cl_event *event) {
+        return CL_SUCCESS;
+    }
+
     MOCKABLE_VIRTUAL void *enqueueMapBuffer(Buffer *buffer, cl_bool blockingMap,
                                             cl_map_flags mapFlags, size_t offset,
                                             size_t size, cl_uint numEventsInWaitList,
@@ -321,10 +337,23 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     MOCKABLE_VIRTUAL void waitUntilComplete(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep);
 
+    bool isBlitEnqueueAllowed(cl_uint numEventsInWaitList, cl_event *event, const GraphicsAllocation &srcAllocation, const GraphicsAllocation &dstAllocation);
+    bool isBlitterCompleted(uint32_t blitterTaskCountToCheck) const;
+    void enqueueBlit(BlitProperties &blitProperties, bool blocking);
+    void waitForBlitterDependency();
+    uint32_t peekBlitterTaskCount() const { return blitterTaskCount; }
+
+    // built-in operation builder with kernels owned by this queue, enqueues on different queues don't contend on it
+    BuiltinDispatchInfoBuilder &getBuiltinDispatchInfoBuilder(EBuiltInOps operation);
+
     static uint32_t getTaskLevelFromWaitList(uint32_t taskLevel,
                                              cl_uint numEventsInWaitList,
                                              const cl_event *eventWaitList);
 
+    // work batched by other receivers has to reach GPU before semaphores waiting on their tags are submitted
+    void flushDependenciesFromOtherCsrs(cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+    bool hasDependenciesFromOtherCsrs(cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+
     Device &getDevice() { return *device; }
     Context &getContext() { return *context; }
     Context *getContextPtr() { return context; }
@@ -391,6 +420,8 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     MOCKABLE_VIRTUAL bool setupDebugSurface(Kernel *kernel);
 
+    CompletionStamp &submitUnblockedCommand(Command &command, uint32_t taskLevel, bool terminated);
+
     // taskCount of last task
     uint32_t taskCount;
 
@@ -418,6 +449,8 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     void obtainNewTimestampPacketNodes(size_t numberOfNodes, TimestampPacketContainer &previousNodes);
 
+    void submitReadyCommands();
+
     Context *context;
     Device *device;
 
@@ -435,13 +468,24 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     LinearStream *commandStream;
 
+    // commands unblocked by events, waiting to be submitted by the next CSR owner
+    IFList<Command, true> readyCommands;
+
     bool mapDcFlushRequired = false;
     bool isSpecialCommandQueue = false;
 
     std::unique_ptr<TimestampPacketContainer> timestampPacketContainer;
 
+    // last task submitted by this queue to the blitter engine
+    uint32_t blitterTaskCount = 0;
+    // render engine was not ordered after blitterTaskCount yet
+    bool blitterDependencyPending = false;
+
+    std::pair<std::unique_ptr<BuiltinDispatchInfoBuilder>, std::once_flag> builtinDispatchInfoBuilders[static_cast<uint32_t>(EBuiltInOps::COUNT)];
+
   private:
     void providePerformanceHint(TransferProperties &transferProperties);
+    CommandStreamReceiver *getOtherCsrOfDependency(cl_event dependency);
 };
 
 typedef CommandQueue *(*CommandQueueCreateFunc)(
@@ -8,6 +8,7 @@
 #pragma once
 #include "runtime/command_stream/command_stream_receiver.h"
 #include "runtime/command_queue/command_queue.h"
+#include "runtime/command_queue/command_template.h"
 #include "runtime/mem_obj/mem_obj.h"
 #include "runtime/memory_manager/graphics_allocation.h"
 #include "runtime/program/printf_handler.h"
@@ -125,6 +126,11 @@ class CommandQueueHw : public CommandQueue {
                          const cl_event *eventWaitList,
                          cl_event *event) override;
 
+    cl_int enqueueCommandTemplate(CommandTemplate &commandTemplate,
+                                  cl_uint numEventsInWaitList,
+                                  const cl_event *eventWaitList,
+                                  cl_event *event) override;
+
     cl_int enqueueSVMMap(cl_bool blockingMap,
                          cl_map_flags mapFlags,
                          void *svmPtr,
@@ -315,6 +321,7 @@ class CommandQueueHw : public CommandQueue {
                                       EventBuilder &eventBuilder,
                                       uint32_t taskLevel,
                                       bool slmUsed,
+                                      PreemptionMode preemptionMode,
                                       PrintfHandler *printfHandler);
 
     template <uint32_t commandType>
@@ -331,6 +338,7 @@ class CommandQueueHw : public CommandQueue {
 
   protected:
     MOCKABLE_VIRTUAL void enqueueHandlerHook(const unsigned int commandType, const MultiDispatchInfo &dispatchInfo){};
+    MOCKABLE_VIRTUAL bool enqueueKernelFastPath(Surface **surfacesForResidency, size_t numSurfaceForResidency, bool blocking, const MultiDispatchInfo &multiDispatchInfo);
     MOCKABLE_VIRTUAL bool createAllocationForHostSurface(HostPtrSurface &surface);
     size_t calculateHostPtrSizeForImage(size_t *region, size_t rowPitch, size_t slicePitch, Image *image);
 
@@ -338,6 +346,23 @@ class CommandQueueHw : public CommandQueue {
     bool isTaskLevelUpdateRequired(const uint32_t &taskLevel, const cl_event *eventWaitList, const cl_uint &numEventsInWaitList, unsigned int commandType);
     void obtainTaskLevelAndBlockedStatus(unsigned int &taskLevel, cl_uint &numEventsInWaitList, const cl_event *&eventWaitList, bool &blockQueue, unsigned int commandType) override;
     void forceDispatchScheduler(OCLRT::MultiDispatchInfo &multiDispatchInfo);
+    struct AuxTranslations {
+        bool empty() const { return compressBefore.empty() && resolveBefore.empty() && compressAfter.empty() && resolveAfter.empty(); }
+
+        BuffersForAuxTranslation compressBefore;
+        BuffersForAuxTranslation resolveBefore;
+        BuffersForAuxTranslation compressAfter;
+        BuffersForAuxTranslation resolveAfter;
+    };
+    bool isAuxTranslationStateUpdateAllowed(cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+    bool isKernelFastPathAllowed(const MultiDispatchInfo &multiDispatchInfo, cl_uint numEventsInWaitList, cl_event *event);
+    void planAuxTranslations(AuxTranslations &auxTranslations, const BuffersForAuxTranslation &nonAuxBuffers,
+                             const BuffersForAuxTranslation &resolvedBuffers, bool stateUpdateAllowed);
+    void commitAuxTranslations(const AuxTranslations &auxTranslations);
+    bool isCommandTemplatePrebuiltReplayAllowed(const CommandTemplate &commandTemplate, cl_event *event);
+    cl_int enqueueCommandTemplateKernels(const CommandTemplate &commandTemplate, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event);
+    std::unique_ptr<CommandTemplate::Instance> createCommandTemplateInstance(const CommandTemplate &commandTemplate);
+    void dispatchCommandTemplate(const CommandTemplate &commandTemplate, CommandTemplate::Instance &instance, PreemptionMode preemptionMode, bool programCommands);
     static void computeOffsetsValueForRectCommands(size_t *bufferOffset,
                                                    size_t *hostOffset,
                                                    const size_t *bufferOrigin,
@@ -7,6 +7,7 @@
 
 #include "runtime/command_queue/gpgpu_walker.h"
 #include "runtime/command_queue/enqueue_barrier.h"
+#include "runtime/command_queue/enqueue_command_template.h"
 #include "runtime/command_queue/enqueue_copy_buffer.h"
 #include "runtime/command_queue/enqueue_copy_buffer_rect.h"
 #include "runtime/command_queue/enqueue_copy_buffer_to_image.h"
@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/command_template.h"
+#include "runtime/command_queue/command_queue.h"
+#include "runtime/context/context.h"
+#include "runtime/device/device.h"
+#include "runtime/helpers/dispatch_info_builder.h"
+#include "runtime/kernel/kernel.h"
+#include "runtime/memory_manager/memory_manager.h"
+
+#include <algorithm>
+
+namespace OCLRT {
+constexpr size_t CommandTemplate::maxInstancesCount;
+
+CommandTemplate *CommandTemplate::create(CommandQueue *commandQueue, cl_int &errcodeRet) {
+    errcodeRet = CL_SUCCESS;
+    if (commandQueue->isOOQEnabled()) {
+        // recorded kernels rely on in-order execution of the queue
+        errcodeRet = CL_INVALID_COMMAND_QUEUE;
+        return nullptr;
+    }
+    return new CommandTemplate(*commandQueue);
+}
+
+CommandTemplate::CommandTemplate(CommandQueue &commandQueue) : commandQueue(commandQueue) {
+    commandQueue.incRefInternal();
+}
+
+CommandTemplate::~CommandTemplate() {
+    for (auto &instance : instances) {
+        releaseInstance(*instance);
+    }
+    for (auto &command : commands) {
+        command->kernel->decRefInternal();
+    }
+    commandQueue.decRefInternal();
+}
+
+cl_int CommandTemplate::recordNDRangeKernel(Kernel &kernel, cl_uint workDim, const size_t *globalWorkOffset,
+                                            const size_t *globalWorkSize, const size_t *localWorkSize) {
+    TakeOwnershipWrapper<CommandTemplate> templateOwnership(*this);
+    if (finalized) {
+        return CL_INVALID_OPERATION;
+    }
+    if (&kernel.getContext() != &commandQueue.getContext()) {
+        return CL_INVALID_CONTEXT;
+    }
+    if (kernel.isParentKernel || kernel.getKernelInfo().builtinDispatchBuilder != nullptr) {
+        return CL_INVALID_KERNEL;
+    }
+    if (workDim < 1 || workDim > 3) {
+        return CL_INVALID_WORK_DIMENSION;
+    }
+
+    auto retVal = validateWorkSizes(kernel, workDim, globalWorkSize, localWorkSize);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    auto command = std::make_unique<RecordedCommand>();
+    command->kernel = &kernel;
+    command->workDim = workDim;
+    const auto &kernelInfo = kernel.getKernelInfo();
+    bool haveRequiredWorkGroupSize = kernelInfo.reqdWorkGroupSize[0] != WorkloadInfo::undefinedOffset;
+    for (auto i = 0u; i < workDim; i++) {
+        command->globalWorkOffset[i] = globalWorkOffset ? globalWorkOffset[i] : 0;
+        command->globalWorkSize[i] = globalWorkSize[i];
+        if (haveRequiredWorkGroupSize) {
+            command->localWorkSize[i] = kernelInfo.reqdWorkGroupSize[i];
+        } else if (localWorkSize) {
+            command->localWorkSize[i] = localWorkSize[i];
+        }
+    }
+    command->localWorkSizeSpecified = haveRequiredWorkGroupSize || localWorkSize != nullptr;
+
+    bakeDispatchInfos(*command);
+    kernel.incRefInternal();
+    commands.push_back(std::move(command));
+    return CL_SUCCESS;
+}
+
+cl_int CommandTemplate::finalize() {
+    TakeOwnershipWrapper<CommandTemplate> templateOwnership(*this);
+    if (finalized || commands.empty()) {
+        return CL_INVALID_OPERATION;
+    }
+    finalized = true;
+    return CL_SUCCESS;
+}
+
+cl_int CommandTemplate::setGlobalWorkSize(cl_uint commandIndex, const size_t *globalWorkSize) {
+    TakeOwnershipWrapper<CommandTemplate> templateOwnership(*this);
+    if (commandIndex >= commands.size()) {
+        return CL_INVALID_VALUE;
+    }
+
+    auto &command = *commands[commandIndex];
+    auto retVal = validateWorkSizes(*command.kernel, command.workDim, globalWorkSize,
+                                    command.localWorkSizeSpecified ? command.localWorkSize : nullptr);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    for (auto i = 0u; i < command.workDim; i++) {
+        command.globalWorkSize[i] = globalWorkSize[i];
+    }
+    bakeDispatchInfos(command);
+    generation++;
+    return CL_SUCCESS;
+}
+
+cl_int CommandTemplate::validateWorkSizes(Kernel &kernel, cl_uint workDim, const size_t *globalWorkSize,
+                                          const size_t *localWorkSize) const {
+    if (globalWorkSize == nullptr) {
+        return CL_INVALID_GLOBAL_WORK_SIZE;
+    }
+
+    const auto &kernelInfo = kernel.getKernelInfo();
+    bool haveRequiredWorkGroupSize = kernelInfo.reqdWorkGroupSize[0] != WorkloadInfo::undefinedOffset;
+    size_t remainder = 0;
+    size_t totalWorkItems = 1u;
+    for (auto i = 0u; i < workDim; i++) {
+        if (globalWorkSize[i] == 0) {
+            return CL_INVALID_GLOBAL_WORK_SIZE;
+        }
+        if (localWorkSize) {
+            if (localWorkSize[i] == 0 || (haveRequiredWorkGroupSize && kernelInfo.reqdWorkGroupSize[i] != localWorkSize[i])) {
+                return CL_INVALID_WORK_GROUP_SIZE;
+            }
+            totalWorkItems *= localWorkSize[i];
+            remainder += globalWorkSize[i] % localWorkSize[i];
+        }
+    }
+
+    if (remainder != 0 && !kernel.getAllowNonUniform()) {
+        return CL_INVALID_WORK_GROUP_SIZE;
+    }
+    if (totalWorkItems > commandQueue.getDevice().getDeviceInfo().maxWorkGroupSize) {
+        return CL_INVALID_WORK_GROUP_SIZE;
+    }
+    return CL_SUCCESS;
+}
+
+void CommandTemplate::bakeDispatchInfos(RecordedCommand &command) {
+    command.multiDispatchInfo.reset(new MultiDispatchInfo(command.kernel));
+
+    DispatchInfoBuilder<SplitDispatch::Dim::d3D, SplitDispatch::SplitMode::WalkerSplit> builder;
+    builder.setDispatchGeometry(command.workDim, command.globalWorkSize,
+                                command.localWorkSizeSpecified ? command.localWorkSize : nullptr,
+                                command.globalWorkOffset);
+    builder.setKernel(command.kernel);
+    builder.bake(*command.multiDispatchInfo);
+}
+
+CommandTemplate::Instance *CommandTemplate::obtainIdleInstance(uint32_t completedTaskCount) {
+    Instance *idleInstance = nullptr;
+    auto it = instances.begin();
+    while (it != instances.end()) {
+        auto &instance = **it;
+        if (instance.taskCount > completedTaskCount) {
+            it++;
+            continue;
+        }
+        if (instance.generation != generation) {
+            releaseInstance(instance);
+            it = instances.erase(it);
+            continue;
+        }
+        idleInstance = &instance;
+        it++;
+    }
+    return idleInstance;
+}
+
+CommandTemplate::Instance *CommandTemplate::addInstance(std::unique_ptr<Instance> instance) {
+    instance->generation = generation;
+    instances.push_back(std::move(instance));
+    return instances.back().get();
+}
+
+uint32_t CommandTemplate::getOldestInstanceTaskCount() const {
+    uint32_t oldestTaskCount = 0;
+    for (auto &instance : instances) {
+        if (oldestTaskCount == 0 || instance->taskCount < oldestTaskCount) {
+            oldestTaskCount = instance->taskCount;
+        }
+    }
+    return oldestTaskCount;
+}
+
+void CommandTemplate::releaseInstance(Instance &instance) {
+    // GPU may still execute the instance, allocations are reused only after its task count completes
+    auto memoryManager = commandQueue.getDevice().getMemoryManager();
+    memoryManager->storeAllocation(std::unique_ptr<GraphicsAllocation>(instance.commandStream->getGraphicsAllocation()), REUSABLE_ALLOCATION, instance.taskCount);
+    memoryManager->storeAllocation(std::unique_ptr<GraphicsAllocation>(instance.dsh->getGraphicsAllocation()), REUSABLE_ALLOCATION, instance.taskCount);
+    memoryManager->storeAllocation(std::unique_ptr<GraphicsAllocation>(instance.ioh->getGraphicsAllocation()), REUSABLE_ALLOCATION, instance.taskCount);
+    memoryManager->storeAllocation(std::unique_ptr<GraphicsAllocation>(instance.ssh->getGraphicsAllocation()), REUSABLE_ALLOCATION, instance.taskCount);
+}
+} // namespace OCLRT
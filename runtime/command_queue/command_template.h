@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/api/cl_types.h"
+#include "runtime/helpers/base_object.h"
+#include "runtime/helpers/dispatch_info.h"
+#include "runtime/indirect_heap/indirect_heap.h"
+#include "public/cl_ext_private.h"
+
+#include <memory>
+#include <vector>
+
+namespace OCLRT {
+class CommandQueue;
+class Kernel;
+
+template <>
+struct OpenCLObjectMapper<_cl_command_template_intel> {
+    typedef class CommandTemplate DerivedType;
+};
+
+// Sequence of NDRange kernels recorded once and replayed many times on its command queue.
+// Walkers of all recorded kernels are programmed once into command buffer of template instance,
+// replay refreshes only indirect state (kernel arguments) and jumps to that buffer with second level batch buffer start.
+// Instance still used by GPU is never touched, next replay programs another one.
+class CommandTemplate : public BaseObject<_cl_command_template_intel> {
+  public:
+    static const cl_ulong objectMagic = 0x436D645465706C74LL;
+    // replays in flight above that count wait for the oldest one
+    static constexpr size_t maxInstancesCount = 4;
+
+    struct RecordedCommand {
+        Kernel *kernel = nullptr;
+        uint32_t workDim = 0;
+        size_t globalWorkOffset[3] = {0, 0, 0};
+        size_t globalWorkSize[3] = {1, 1, 1};
+        size_t localWorkSize[3] = {1, 1, 1};
+        bool localWorkSizeSpecified = false;
+        std::unique_ptr<MultiDispatchInfo> multiDispatchInfo;
+    };
+
+    struct Instance {
+        std::unique_ptr<LinearStream> commandStream;
+        std::unique_ptr<IndirectHeap> dsh;
+        std::unique_ptr<IndirectHeap> ioh;
+        std::unique_ptr<IndirectHeap> ssh;
+        uint32_t taskCount = 0;
+        uint32_t generation = 0;
+    };
+
+    static CommandTemplate *create(CommandQueue *commandQueue, cl_int &errcodeRet);
+
+    CommandTemplate(CommandQueue &commandQueue);
+    ~CommandTemplate() override;
+
+    cl_int recordNDRangeKernel(Kernel &kernel, cl_uint workDim, const size_t *globalWorkOffset,
+                               const size_t *globalWorkSize, const size_t *localWorkSize);
+    cl_int finalize();
+    // changes sizes of recorded command, instances are reprogrammed when GPU is done with them
+    cl_int setGlobalWorkSize(cl_uint commandIndex, const size_t *globalWorkSize);
+
+    CommandQueue &getCommandQueue() const { return commandQueue; }
+    bool isFinalized() const { return finalized; }
+    const std::vector<std::unique_ptr<RecordedCommand>> &getCommands() const { return commands; }
+    uint32_t getGeneration() const { return generation; }
+
+    // returns instance up to date and not used by GPU anymore, stale idle instances are released
+    Instance *obtainIdleInstance(uint32_t completedTaskCount);
+    Instance *addInstance(std::unique_ptr<Instance> instance);
+    size_t getInstancesCount() const { return instances.size(); }
+    uint32_t getOldestInstanceTaskCount() const;
+
+  protected:
+    cl_int validateWorkSizes(Kernel &kernel, cl_uint workDim, const size_t *globalWorkSize,
+                             const size_t *localWorkSize) const;
+    void bakeDispatchInfos(RecordedCommand &command);
+    void releaseInstance(Instance &instance);
+
+    CommandQueue &commandQueue;
+    std::vector<std::unique_ptr<RecordedCommand>> commands;
+    std::vector<std::unique_ptr<Instance>> instances;
+    uint32_t generation = 0;
+    bool finalized = false;
+};
+} // namespace OCLRT
@@ -11,6 +11,7 @@
 #include "runtime/device/device.h"
 #include "runtime/event/event_builder.h"
 #include "runtime/helpers/get_info.h"
+#include "runtime/helpers/memory_fill.h"
 #include "runtime/helpers/mipmap.h"
 #include "runtime/mem_obj/buffer.h"
 #include "runtime/mem_obj/image.h"
@@ -100,6 +101,13 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
             outEventObj->setStartTimeStamp();
         }
 
+        auto blitterTaskCountToWait = transferProperties.memObj->getGraphicsAllocation()->blitterTaskCount;
+        if (transferProperties.cmdType == CL_COMMAND_READ_BUFFER || transferProperties.cmdType == CL_COMMAND_WRITE_BUFFER ||
+            transferProperties.cmdType == CL_COMMAND_FILL_BUFFER) {
+            // memory is accessed right away by the CPU
+            transferProperties.memObj->waitForBlitterCompletion();
+        }
+
         UNRECOVERABLE_IF((transferProperties.memObj->isMemObjZeroCopy() == false) && isMipMapped(transferProperties.memObj));
         switch (transferProperties.cmdType) {
         case CL_COMMAND_MAP_BUFFER:
@@ -134,6 +142,10 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
             memcpy_s(ptrOffset(transferProperties.memObj->getCpuAddressForMemoryTransfer(), transferProperties.offset[0]), transferProperties.size[0], transferProperties.ptr, transferProperties.size[0]);
             eventCompleted = true;
             break;
+        case CL_COMMAND_FILL_BUFFER:
+            fillMemoryWithPattern(ptrOffset(transferProperties.memObj->getCpuAddressForMemoryTransfer(), transferProperties.offset[0]), transferProperties.size[0], transferProperties.ptr, transferProperties.patternSize);
+            eventCompleted = true;
+            break;
         case CL_COMMAND_MARKER:
             break;
         default:
@@ -143,6 +155,7 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
         if (outEventObj) {
             outEventObj->setEndTimeStamp();
             outEventObj->updateTaskCount(this->taskCount);
+            outEventObj->setBlitterTaskCount(blitterTaskCountToWait);
             outEventObj->flushStamp->setStamp(this->flushStamp->peekStamp());
             if (eventCompleted) {
                 outEventObj->setStatus(CL_COMPLETE);
@@ -0,0 +1,360 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "hw_cmds.h"
+#include "runtime/command_queue/command_queue_hw.h"
+#include "runtime/command_queue/command_template.h"
+#include "runtime/command_queue/gpgpu_walker.h"
+#include "runtime/command_queue/hardware_interface.h"
+#include "runtime/command_stream/command_stream_receiver_hw.h"
+#include "runtime/event/event_builder.h"
+#include "runtime/gtpin/gtpin_notify.h"
+#include "runtime/helpers/kernel_commands.h"
+#include "runtime/kernel/kernel.h"
+#include "runtime/memory_manager/memory_manager.h"
+#include "runtime/program/program.h"
+
+namespace OCLRT {
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::enqueueCommandTemplate(CommandTemplate &commandTemplate,
+                                                         cl_uint numEventsInWaitList,
+                                                         const cl_event *eventWaitList,
+                                                         cl_event *event) {
+    using MI_BATCH_BUFFER_START = typename GfxFamily::MI_BATCH_BUFFER_START;
+
+    TakeOwnershipWrapper<CommandTemplate> templateOwnership(commandTemplate);
+    if (!commandTemplate.isFinalized()) {
+        return CL_INVALID_OPERATION;
+    }
+    for (auto &command : commandTemplate.getCommands()) {
+        if (!command->kernel->isPatched()) {
+            if (event) {
+                *event = nullptr;
+            }
+            return CL_INVALID_KERNEL_ARGS;
+        }
+    }
+
+    auto blockQueue = isQueueBlocked() || (getTaskLevelFromWaitList(this->taskLevel, numEventsInWaitList, eventWaitList) == Event::eventNotReady);
+    if (blockQueue || !isCommandTemplatePrebuiltReplayAllowed(commandTemplate, event)) {
+        return enqueueCommandTemplateKernels(commandTemplate, numEventsInWaitList, eventWaitList, event);
+    }
+
+    auto &commandStreamReceiver = device->getCommandStreamReceiver();
+    if (commandTemplate.obtainIdleInstance(*commandStreamReceiver.getTagAddress()) == nullptr &&
+        commandTemplate.getInstancesCount() >= CommandTemplate::maxInstancesCount) {
+        waitUntilComplete(commandTemplate.getOldestInstanceTaskCount(), flushStamp->peekStamp(), false);
+    }
+
+    flushDependenciesFromOtherCsrs(numEventsInWaitList, eventWaitList);
+    auto commandStreamReceiverOwnership = commandStreamReceiver.obtainUniqueOwnership();
+    TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
+
+    // other thread could block the queue before ownership was taken, replay must not pass its blocked command
+    blockQueue = isQueueBlocked() || (getTaskLevelFromWaitList(this->taskLevel, numEventsInWaitList, eventWaitList) == Event::eventNotReady);
+    if (blockQueue) {
+        queueOwnership.unlock();
+        commandStreamReceiverOwnership.unlock();
+        return enqueueCommandTemplateKernels(commandTemplate, numEventsInWaitList, eventWaitList, event);
+    }
+
+    auto preemptionMode = device->getPreemptionMode();
+    uint32_t requiredScratchSize = 0;
+    auto slmUsed = false;
+    auto requiresCoherency = false;
+    auto mediaSamplerRequired = false;
+    uint32_t numGrfRequired = GrfConfig::DefaultGrfNumber;
+    for (auto &command : commandTemplate.getCommands()) {
+        auto &kernel = *command->kernel;
+        if (kernel.isUsingSharedObjArgs()) {
+            kernel.resetSharedObjectsPatchAddresses();
+        }
+        preemptionMode = std::min(preemptionMode, PreemptionHelper::taskPreemptionMode(*device, *command->multiDispatchInfo));
+        requiredScratchSize = std::max(requiredScratchSize, command->multiDispatchInfo->getRequiredScratchSize());
+        slmUsed |= command->multiDispatchInfo->usesSlm();
+        requiresCoherency |= kernel.requiresCoherency();
+        mediaSamplerRequired |= kernel.isVmeKernel();
+        numGrfRequired = std::max(numGrfRequired, kernel.getKernelInfo().patchInfo.executionEnvironment->NumGRFRequired);
+    }
+
+    auto instance = commandTemplate.obtainIdleInstance(*commandStreamReceiver.getTagAddress());
+    if (instance) {
+        dispatchCommandTemplate(commandTemplate, *instance, preemptionMode, false);
+    } else {
+        auto newInstance = createCommandTemplateInstance(commandTemplate);
+        if (!newInstance) {
+            queueOwnership.unlock();
+            commandStreamReceiverOwnership.unlock();
+            return enqueueCommandTemplateKernels(commandTemplate, numEventsInWaitList, eventWaitList, event);
+        }
+        instance = commandTemplate.addInstance(std::move(newInstance));
+        dispatchCommandTemplate(commandTemplate, *instance, preemptionMode, true);
+    }
+
+    EventBuilder eventBuilder;
+    if (event) {
+        eventBuilder.create<Event>(this, CL_COMMAND_NDRANGE_KERNEL, Event::eventNotReady, 0);
+        *event = eventBuilder.getEvent();
+    }
+
+    auto taskLevel = 0u;
+    obtainTaskLevelAndBlockedStatus(taskLevel, numEventsInWaitList, eventWaitList, blockQueue, CL_COMMAND_NDRANGE_KERNEL);
+    DEBUG_BREAK_IF(blockQueue);
+
+    // whole recorded sequence is executed as second level batch buffer
+    auto &commandStream = getCS(sizeof(MI_BATCH_BUFFER_START));
+    auto commandStreamStart = commandStream.getUsed();
+    auto batchBufferStart = commandStream.getSpaceForCmd<MI_BATCH_BUFFER_START>();
+    auto commandStreamReceiverHw = reinterpret_cast<CommandStreamReceiverHw<GfxFamily> *>(&commandStreamReceiver);
+    commandStreamReceiverHw->addBatchBufferStart(batchBufferStart, instance->commandStream->getGraphicsAllocation()->getGpuAddress(), true);
+
+    commandStreamReceiver.makeResident(*instance->commandStream->getGraphicsAllocation());
+    for (auto &command : commandTemplate.getCommands()) {
+        command->kernel->makeResident(commandStreamReceiver);
+    }
+    commandStreamReceiver.setRequiredScratchSize(requiredScratchSize);
+    commandStreamReceiver.requestThreadArbitrationPolicy(commandTemplate.getCommands().front()->kernel->getThreadArbitrationPolicy<GfxFamily>());
+
+    DispatchFlags dispatchFlags;
+    dispatchFlags.useSLM = slmUsed;
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.GSBA32BitRequired = true;
+    dispatchFlags.mediaSamplerRequired = mediaSamplerRequired;
+    dispatchFlags.requiresCoherency = requiresCoherency;
+    dispatchFlags.lowPriority = priority == QueuePriority::LOW;
+    dispatchFlags.flushStampReference = this->flushStamp->getStampReference();
+    dispatchFlags.preemptionMode = preemptionMode;
+    dispatchFlags.outOfOrderExecutionAllowed = !eventBuilder.getEvent() || commandStreamReceiver.isNTo1SubmissionModelEnabled();
+    EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
+    if (hasDependenciesFromOtherCsrs(numEventsInWaitList, eventWaitList)) {
+        dispatchFlags.outOfDeviceDependencies = &eventsRequest;
+    }
+    dispatchFlags.numGrfRequired = numGrfRequired;
+    if (blitterDependencyPending) {
+        dispatchFlags.blitterDependencyTagAllocation = device->getBlitterCommandStreamReceiver()->getTagAllocation();
+        dispatchFlags.blitterDependencyTaskCount = blitterTaskCount;
+        blitterDependencyPending = false;
+    }
+
+    auto completionStamp = commandStreamReceiver.flushTask(
+        commandStream,
+        commandStreamStart,
+        *instance->dsh,
+        *instance->ioh,
+        *instance->ssh,
+        taskLevel,
+        dispatchFlags,
+        *device);
+    instance->taskCount = completionStamp.taskCount;
+
+    updateFromCompletionStamp(completionStamp);
+    if (eventBuilder.getEvent()) {
+        eventBuilder.getEvent()->flushStamp->replaceStampObject(this->flushStamp->getStampReference());
+        eventBuilder.getEvent()->updateCompletionStamp(completionStamp.taskCount, completionStamp.taskLevel, completionStamp.flushStamp);
+    }
+    return CL_SUCCESS;
+}
+
+template <typename GfxFamily>
+bool CommandQueueHw<GfxFamily>::isCommandTemplatePrebuiltReplayAllowed(const CommandTemplate &commandTemplate, cl_event *event) {
+    // commands wrapping walkers with timestamps, counters or instrumentation are programmed per enqueue
+    if (device->getCommandStreamReceiver().peekTimestampPacketWriteEnabled() ||
+        (event && (isProfilingEnabled() || isPerfCountersEnabled())) ||
+        gtpinIsGTPinInitialized() ||
+        DebugManager.flags.AUBDumpSubCaptureMode.get() ||
+        DebugManager.flags.AddPatchInfoCommentsForAUBDump.get()) {
+        return false;
+    }
+
+    for (auto &command : commandTemplate.getCommands()) {
+        auto &kernel = *command->kernel;
+        if (kernel.hasPrintfOutput() || kernel.hasCompressedBufferArgs() || kernel.getProgram()->isKernelDebugEnabled()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::enqueueCommandTemplateKernels(const CommandTemplate &commandTemplate,
+                                                                cl_uint numEventsInWaitList,
+                                                                const cl_event *eventWaitList,
+                                                                cl_event *event) {
+    auto &commands = commandTemplate.getCommands();
+    for (size_t i = 0; i < commands.size(); i++) {
+        auto &command = *commands[i];
+        auto firstCommand = (i == 0);
+        auto lastCommand = (i + 1 == commands.size());
+        auto retVal = enqueueKernel(command.kernel,
+                                    command.workDim,
+                                    command.globalWorkOffset,
+                                    command.globalWorkSize,
+                                    command.localWorkSizeSpecified ? command.localWorkSize : nullptr,
+                                    firstCommand ? numEventsInWaitList : 0,
+                                    firstCommand ? eventWaitList : nullptr,
+                                    lastCommand ? event : nullptr);
+        if (retVal != CL_SUCCESS) {
+            return retVal;
+        }
+    }
+    return CL_SUCCESS;
+}
+
+template <typename GfxFamily>
+std::unique_ptr<CommandTemplate::Instance> CommandQueueHw<GfxFamily>::createCommandTemplateInstance(const CommandTemplate &commandTemplate) {
+    using INTERFACE_DESCRIPTOR_DATA = typename GfxFamily::INTERFACE_DESCRIPTOR_DATA;
+    using MI_BATCH_BUFFER_END = typename GfxFamily::MI_BATCH_BUFFER_END;
+    using KCH = KernelCommandsHelper<GfxFamily>;
+
+    // heaps are packed tightly, there is single surface state base address for whole recorded sequence
+    size_t commandStreamSize = sizeof(MI_BATCH_BUFFER_END);
+    size_t dshSize = 0;
+    size_t iohSize = 0;
+    size_t sshSize = 0;
+    for (auto &command : commandTemplate.getCommands()) {
+        auto &multiDispatchInfo = *command->multiDispatchInfo;
+        dshSize += KCH::alignInterfaceDescriptorData + sizeof(INTERFACE_DESCRIPTOR_DATA) * multiDispatchInfo.size();
+        for (auto &dispatchInfo : multiDispatchInfo) {
+            auto &kernel = *dispatchInfo.getKernel();
+            commandStreamSize += EnqueueOperation<GfxFamily>::getSizeRequiredCS(CL_COMMAND_NDRANGE_KERNEL, false, false, *this, &kernel);
+            dshSize += KCH::getSizeRequiredDSH(kernel);
+            iohSize += KCH::getSizeRequiredIOH(kernel, Math::computeTotalElementsCount(dispatchInfo.getLocalWorkgroupSize()));
+            sshSize += KCH::getSizeRequiredSSH(kernel);
+        }
+    }
+
+    auto &commandStreamReceiver = device->getCommandStreamReceiver();
+    if (sshSize > commandStreamReceiver.defaultSshSize - MemoryConstants::pageSize) {
+        return nullptr;
+    }
+
+    auto instance = std::make_unique<CommandTemplate::Instance>();
+    auto memoryManager = device->getMemoryManager();
+    commandStreamSize = alignUp(commandStreamSize, MemoryConstants::pageSize);
+    auto requiredSize = commandStreamSize + CSRequirements::csOverfetchSize;
+    auto allocation = memoryManager->obtainReusableAllocation(requiredSize, false).release();
+    if (!allocation) {
+        allocation = memoryManager->allocateGraphicsMemory(requiredSize);
+    }
+    allocation->setAllocationType(GraphicsAllocation::AllocationType::LINEAR_STREAM);
+    instance->commandStream.reset(new LinearStream(allocation->getUnderlyingBuffer(), commandStreamSize));
+    instance->commandStream->replaceGraphicsAllocation(allocation);
+
+    IndirectHeap *dsh = nullptr, *ioh = nullptr, *ssh = nullptr;
+    allocateHeapMemory(IndirectHeap::DYNAMIC_STATE, dshSize, dsh);
+    allocateHeapMemory(IndirectHeap::INDIRECT_OBJECT, iohSize, ioh);
+    allocateHeapMemory(IndirectHeap::SURFACE_STATE, sshSize, ssh);
+    instance->dsh.reset(dsh);
+    instance->ioh.reset(ioh);
+    instance->ssh.reset(ssh);
+    return instance;
+}
+
+template <typename GfxFamily>
+void CommandQueueHw<GfxFamily>::dispatchCommandTemplate(const CommandTemplate &commandTemplate,
+                                                        CommandTemplate::Instance &instance,
+                                                        PreemptionMode preemptionMode,
+                                                        bool programCommands) {
+    using INTERFACE_DESCRIPTOR_DATA = typename GfxFamily::INTERFACE_DESCRIPTOR_DATA;
+    using KCH = KernelCommandsHelper<GfxFamily>;
+
+    // Indirect state is rebuilt at the same offsets on every replay, so walkers in command buffer stay valid.
+    // Commands sent along with indirect state are needed only when programming the buffer, otherwise they are dropped.
+    uint64_t droppedCommands[16];
+    LinearStream droppedCommandStream(droppedCommands, sizeof(droppedCommands));
+    WALKER_TYPE<GfxFamily> droppedWalker;
+
+    auto &commandStream = *instance.commandStream;
+    auto &commandStreamReceiver = device->getCommandStreamReceiver();
+    for (auto heap : {instance.dsh.get(), instance.ioh.get(), instance.ssh.get()}) {
+        heap->replaceBuffer(heap->getCpuBase(), heap->getMaxAvailableSpace());
+    }
+
+    auto &commands = commandTemplate.getCommands();
+    for (auto &command : commands) {
+        auto &multiDispatchInfo = *command->multiDispatchInfo;
+
+        instance.dsh->align(KCH::alignInterfaceDescriptorData);
+        const size_t offsetInterfaceDescriptorTable = instance.dsh->getUsed();
+        size_t totalInterfaceDescriptorTableSize = sizeof(INTERFACE_DESCRIPTOR_DATA) * multiDispatchInfo.size();
+        instance.dsh->getSpace(totalInterfaceDescriptorTableSize);
+        if (programCommands) {
+            KCH::sendMediaInterfaceDescriptorLoad(commandStream, offsetInterfaceDescriptorTable, totalInterfaceDescriptorTableSize);
+        }
+
+        uint32_t interfaceDescriptorIndex = 0;
+        for (auto &dispatchInfo : multiDispatchInfo) {
+            auto &kernel = *dispatchInfo.getKernel();
+            uint32_t simd = kernel.getKernelInfo().getMaxSimdSize();
+            uint32_t dim = dispatchInfo.getDim();
+            Vec3<size_t> lws = dispatchInfo.getLocalWorkgroupSize();
+            Vec3<size_t> gws = dispatchInfo.getGWS();
+            size_t localWorkSizes[3] = {lws.x, lws.y, lws.z};
+            size_t globalWorkSizes[3] = {gws.x, gws.y, gws.z};
+
+            HardwareInterface<GfxFamily>::patchKernelConstants(multiDispatchInfo, dispatchInfo);
+
+            WALKER_TYPE<GfxFamily> *walkerCmd = nullptr;
+            if (programCommands) {
+                HardwareInterface<GfxFamily>::dispatchWorkarounds(&commandStream, *this, kernel, true);
+                walkerCmd = HardwareInterface<GfxFamily>::allocateWalkerSpace(commandStream, kernel);
+            } else {
+                droppedCommandStream.replaceBuffer(droppedCommands, sizeof(droppedCommands));
+                droppedWalker = GfxFamily::cmdInitGpgpuWalker;
+                walkerCmd = &droppedWalker;
+            }
+            auto idd = HardwareInterface<GfxFamily>::obtainInterfaceDescriptorData(walkerCmd);
+
+            bool localIdsGenerationByRuntime = KCH::isRuntimeLocalIdsGenerationRequired(dim, globalWorkSizes, localWorkSizes);
+            bool inlineDataProgrammingRequired = KCH::inlineDataProgrammingRequired(kernel);
+            bool kernelUsesLocalIds = KCH::kernelUsesLocalIds(kernel);
+            KCH::sendIndirectState(
+                programCommands ? commandStream : droppedCommandStream,
+                *instance.dsh,
+                *instance.ioh,
+                *instance.ssh,
+                kernel,
+                simd,
+                localWorkSizes,
+                offsetInterfaceDescriptorTable,
+                interfaceDescriptorIndex,
+                preemptionMode,
+                walkerCmd,
+                idd,
+                localIdsGenerationByRuntime,
+                kernelUsesLocalIds,
+                inlineDataProgrammingRequired);
+
+            if (programCommands) {
+                Vec3<size_t> offset = dispatchInfo.getOffset();
+                Vec3<size_t> swgs = dispatchInfo.getStartOfWorkgroups();
+                Vec3<size_t> nwgs = (dispatchInfo.getNumberOfWorkgroups().x > 0) ? dispatchInfo.getNumberOfWorkgroups()
+                                                                                 : generateWorkgroupsNumber(gws, lws);
+                size_t globalOffsets[3] = {offset.x, offset.y, offset.z};
+                size_t startWorkGroups[3] = {swgs.x, swgs.y, swgs.z};
+                size_t numWorkGroups[3] = {nwgs.x, nwgs.y, nwgs.z};
+                GpgpuWalkerHelper<GfxFamily>::setGpgpuWalkerThreadData(walkerCmd, globalOffsets, startWorkGroups,
+                                                                       numWorkGroups, localWorkSizes, simd, dim,
+                                                                       localIdsGenerationByRuntime, inlineDataProgrammingRequired,
+                                                                       *kernel.getKernelInfo().patchInfo.threadPayload);
+                HardwareInterface<GfxFamily>::dispatchWorkarounds(&commandStream, *this, kernel, false);
+            }
+        }
+
+        // in-order queue, next recorded kernel starts after previous one completes
+        if (programCommands && &command != &commands.back()) {
+            commandStreamReceiver.addPipeControl(commandStream, false);
+        }
+    }
+
+    if (programCommands) {
+        CommandStreamReceiverHw<GfxFamily>::addBatchBufferEnd(commandStream, nullptr);
+    }
+}
+} // namespace OCLRT
@@ -49,20 +49,11 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCount
     if (kernel == nullptr) {
         enqueueHandler<commandType>(surfaces, blocking, MultiDispatchInfo(), numEventsInWaitList, eventWaitList, event);
     } else {
-        BuiltInOwnershipWrapper builtInLock;
         MultiDispatchInfo multiDispatchInfo(kernel);
 
         if (DebugManager.flags.ForceDispatchScheduler.get()) {
             forceDispatchScheduler(multiDispatchInfo);
         } else {
-            BuffersForAuxTranslation buffersForAuxTranslation;
-            if (kernel->isAuxTranslationRequired()) {
-                auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::AuxTranslation, getContext(), getDevice());
-                builtInLock.takeOwnership(builder, this->context);
-                kernel->fillWithBuffersForAuxTranslation(buffersForAuxTranslation);
-                dispatchAuxTranslation(multiDispatchInfo, buffersForAuxTranslation, AuxTranslationDirection::AuxToNonAux);
-            }
-
             if (kernel->getKernelInfo().builtinDispatchBuilder == nullptr) {
                 DispatchInfoBuilder<SplitDispatch::Dim::d3D, SplitDispatch::SplitMode::WalkerSplit> builder;
                 builder.setDispatchGeometry(workDim, workItems, localWorkSizesIn, globalOffsets);
@@ -76,15 +67,6 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCount
                     return;
                 }
             }
-            if (kernel->isAuxTranslationRequired()) {
-                if (kernel->isParentKernel) {
-                    for (auto &buffer : buffersForAuxTranslation) {
-                        buffer->getGraphicsAllocation()->setAllocationType(GraphicsAllocation::AllocationType::BUFFER);
-                    }
-                } else {
-                    dispatchAuxTranslation(multiDispatchInfo, buffersForAuxTranslation, AuxTranslationDirection::NonAuxToAux);
-                }
-            }
         }
 
         enqueueHandler<commandType>(surfaces, blocking, multiDispatchInfo, numEventsInWaitList, eventWaitList, event);
@@ -117,17 +99,64 @@ void CommandQueueHw<GfxFamily>::forceDispatchScheduler(OCLRT::MultiDispatchInfo
     multiDispatchInfo.push(dispatchInfo);
 }
 
+template <typename GfxFamily>
+bool CommandQueueHw<GfxFamily>::isAuxTranslationStateUpdateAllowed(cl_uint numEventsInWaitList, const cl_event *eventWaitList) {
+    // commands of out of order queues may run concurrently and blocked commands are submitted after enqueues following them,
+    // so translations done by them can't be tracked in the aux translation state
+    return !isOOQEnabled() && !isQueueBlocked() &&
+           getTaskLevelFromWaitList(this->taskLevel, numEventsInWaitList, eventWaitList) != Event::eventNotReady;
+}
+
+template <typename GfxFamily>
+void CommandQueueHw<GfxFamily>::planAuxTranslations(AuxTranslations &auxTranslations, const BuffersForAuxTranslation &nonAuxBuffers,
+                                                   const BuffersForAuxTranslation &resolvedBuffers, bool stateUpdateAllowed) {
+    // Translation back is deferred until a buffer is accessed in the other mode, so consecutive commands working
+    // on the same buffers in the same mode don't translate them again. When the state can't be updated, buffers
+    // are translated back right after the command.
+    for (auto &buffer : nonAuxBuffers) {
+        auto graphicsAllocation = buffer->getGraphicsAllocation();
+        if (graphicsAllocation->getAuxTranslationState() == GraphicsAllocation::AuxTranslationState::Compressed) {
+            auxTranslations.resolveBefore.insert(buffer);
+            if (!stateUpdateAllowed || graphicsAllocation->isAuxTranslationStatePinned()) {
+                auxTranslations.compressAfter.insert(buffer);
+            }
+        }
+    }
+    for (auto &buffer : resolvedBuffers) {
+        if (nonAuxBuffers.find(buffer) == nonAuxBuffers.end()) {
+            auxTranslations.compressBefore.insert(buffer);
+            if (!stateUpdateAllowed || buffer->getGraphicsAllocation()->isAuxTranslationStatePinned()) {
+                auxTranslations.resolveAfter.insert(buffer);
+            }
+        }
+    }
+}
+
+template <typename GfxFamily>
+void CommandQueueHw<GfxFamily>::commitAuxTranslations(const AuxTranslations &auxTranslations) {
+    for (auto &buffer : auxTranslations.resolveBefore) {
+        if (auxTranslations.compressAfter.find(buffer) == auxTranslations.compressAfter.end()) {
+            buffer->getGraphicsAllocation()->setAuxTranslationState(GraphicsAllocation::AuxTranslationState::Resolved);
+        }
+    }
+    for (auto &buffer : auxTranslations.compressBefore) {
+        if (auxTranslations.resolveAfter.find(buffer) == auxTranslations.resolveAfter.end()) {
+            buffer->getGraphicsAllocation()->setAuxTranslationState(GraphicsAllocation::AuxTranslationState::Compressed);
+        }
+    }
+}
+
 template <typename GfxFamily>
 template <uint32_t commandType>
 void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
                                                size_t numSurfaceForResidency,
                                                bool blocking,
-                                               const MultiDispatchInfo &multiDispatchInfo,
+                                               const MultiDispatchInfo &requestedMultiDispatchInfo,
                                                cl_uint numEventsInWaitList,
                                                const cl_event *eventWaitList,
                                                cl_event *event) {
-    if (multiDispatchInfo.empty() && !isCommandWithoutKernel(commandType)) {
-        enqueueHandler<CL_COMMAND_MARKER>(surfacesForResidency, numSurfaceForResidency, blocking, multiDispatchInfo,
+    if (requestedMultiDispatchInfo.empty() && !isCommandWithoutKernel(commandType)) {
+        enqueueHandler<CL_COMMAND_MARKER>(surfacesForResidency, numSurfaceForResidency, blocking, requestedMultiDispatchInfo,
                                           numEventsInWaitList, eventWaitList, event);
         if (event) {
             castToObjectOrAbort<Event>(*event)->setCmdType(commandType);
@@ -135,14 +164,72 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
         return;
     }
 
-    Kernel *parentKernel = multiDispatchInfo.peekParentKernel();
-    auto devQueue = this->getContext().getDefaultDeviceQueue();
-    DeviceQueueHw<GfxFamily> *devQueueHw = castToObject<DeviceQueueHw<GfxFamily>>(devQueue);
+    if (commandType == CL_COMMAND_NDRANGE_KERNEL && isKernelFastPathAllowed(requestedMultiDispatchInfo, numEventsInWaitList, event) &&
+        enqueueKernelFastPath(surfacesForResidency, numSurfaceForResidency, blocking, requestedMultiDispatchInfo)) {
+        return;
+    }
+
+    Kernel *parentKernel = requestedMultiDispatchInfo.peekParentKernel();
+    DeviceQueueHw<GfxFamily> *devQueueHw = nullptr;
+    if (parentKernel) {
+        devQueueHw = castToObject<DeviceQueueHw<GfxFamily>>(this->getContext().getDefaultDeviceQueue());
+    }
 
     HwTimeStamps *hwTimeStamps = nullptr;
+    flushDependenciesFromOtherCsrs(numEventsInWaitList, eventWaitList);
     auto &commandStreamReceiver = device->getCommandStreamReceiver();
     auto commandStreamRecieverOwnership = commandStreamReceiver.obtainUniqueOwnership();
 
+    // aux translation state of compressed buffers is shared by queues on the device, it is checked and updated in submission order
+    BuiltInOwnershipWrapper auxTranslationBuilderLock;
+    std::unique_ptr<MultiDispatchInfo> auxTranslatedMultiDispatchInfo;
+    BuffersForAuxTranslation buffersForAuxTranslation;
+    BuffersForAuxTranslation resolvedBuffers;
+    for (auto &dispatchInfo : requestedMultiDispatchInfo) {
+        auto kernel = dispatchInfo.getKernel();
+        if (kernel->hasCompressedBufferArgs()) {
+            if (kernel->isAuxTranslationRequired()) {
+                kernel->fillWithBuffersForAuxTranslation(buffersForAuxTranslation);
+            }
+            kernel->fillWithResolvedBuffers(resolvedBuffers);
+        }
+    }
+    if (!buffersForAuxTranslation.empty() || !resolvedBuffers.empty()) {
+        AuxTranslations auxTranslations;
+        // parent kernels leave their buffers in non-aux mode for good
+        auto stateUpdateAllowed = parentKernel || isAuxTranslationStateUpdateAllowed(numEventsInWaitList, eventWaitList);
+        planAuxTranslations(auxTranslations, buffersForAuxTranslation, resolvedBuffers, stateUpdateAllowed);
+
+        if (!auxTranslations.empty()) {
+            auxTranslationBuilderLock.takeOwnership(getBuiltinDispatchInfoBuilder(EBuiltInOps::AuxTranslation), this->context);
+            auxTranslatedMultiDispatchInfo = std::make_unique<MultiDispatchInfo>(requestedMultiDispatchInfo.peekMainKernel());
+            auto &translatedMultiDispatchInfo = *auxTranslatedMultiDispatchInfo;
+            if (!auxTranslations.compressBefore.empty()) {
+                dispatchAuxTranslation(translatedMultiDispatchInfo, auxTranslations.compressBefore, AuxTranslationDirection::NonAuxToAux);
+            }
+            if (!auxTranslations.resolveBefore.empty()) {
+                dispatchAuxTranslation(translatedMultiDispatchInfo, auxTranslations.resolveBefore, AuxTranslationDirection::AuxToNonAux);
+            }
+            for (auto &dispatchInfo : requestedMultiDispatchInfo) {
+                translatedMultiDispatchInfo.push(dispatchInfo);
+            }
+            if (!parentKernel && !auxTranslations.compressAfter.empty()) {
+                dispatchAuxTranslation(translatedMultiDispatchInfo, auxTranslations.compressAfter, AuxTranslationDirection::NonAuxToAux);
+            }
+            if (!parentKernel && !auxTranslations.resolveAfter.empty()) {
+                dispatchAuxTranslation(translatedMultiDispatchInfo, auxTranslations.resolveAfter, AuxTranslationDirection::AuxToNonAux);
+            }
+        }
+        commitAuxTranslations(auxTranslations);
+
+        if (parentKernel) {
+            for (auto &buffer : buffersForAuxTranslation) {
+                buffer->getGraphicsAllocation()->setAllocationType(GraphicsAllocation::AllocationType::BUFFER);
+            }
+        }
+    }
+    const MultiDispatchInfo &multiDispatchInfo = auxTranslatedMultiDispatchInfo ? *auxTranslatedMultiDispatchInfo : requestedMultiDispatchInfo;
+
     TimeStampData queueTimeStamp;
     if (isProfilingEnabled() && event) {
         this->getDevice().getOSTime()->getCpuGpuTime(&queueTimeStamp);
@@ -181,11 +268,6 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
 
     DBG_LOG(EventsDebugEnable, "blockQueue", blockQueue, "virtualEvent", virtualEvent, "taskLevel", taskLevel);
 
-    if (parentKernel && !blockQueue) {
-        while (!devQueueHw->isEMCriticalSectionFree())
-            ;
-    }
-
     enqueueHandlerHook(commandType, multiDispatchInfo);
 
     if (DebugManager.flags.AUBDumpSubCaptureMode.get()) {
@@ -234,6 +316,12 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
         }
 
         if (parentKernel) {
+            // Host-side preparation above does not touch device queue resources,
+            // so it overlaps with the previous parent kernel still draining on GPU
+            if (!blockQueue) {
+                while (!devQueueHw->isEMCriticalSectionFree())
+                    ;
+            }
             parentKernel->createReflectionSurface();
             parentKernel->patchDefaultDeviceQueue(context->getDefaultDeviceQueue());
             parentKernel->patchEventPool(context->getDefaultDeviceQueue());
@@ -283,6 +371,11 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
         }
     }
 
+    if (blockQueue || isCommandWithoutKernel(commandType)) {
+        // no render engine command buffer to carry semaphore on blitter work
+        waitForBlitterDependency();
+    }
+
     CompletionStamp completionStamp;
     if (!blockQueue) {
         if (parentKernel) {
@@ -343,6 +436,7 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
                 eventBuilder,
                 taskLevel,
                 slmUsed,
+                preemption,
                 printfHandler.get());
 
             if (eventBuilder.getEvent()) {
@@ -438,7 +532,103 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
             }
             commandStreamReceiver.waitForTaskCountAndCleanAllocationList(completionStamp.taskCount, TEMPORARY_ALLOCATION);
         }
+    } else if (printfHandler && !blockQueue) {
+        device->getAsyncPrintfOutputHandler().registerOutput(std::move(printfHandler), completionStamp.taskCount, completionStamp.flushStamp);
+    }
+}
+
+template <typename GfxFamily>
+bool CommandQueueHw<GfxFamily>::isKernelFastPathAllowed(const MultiDispatchInfo &multiDispatchInfo, cl_uint numEventsInWaitList, cl_event *event) {
+    // without events there is nothing to profile, wait for or signal
+    if (numEventsInWaitList > 0 || event != nullptr || multiDispatchInfo.peekParentKernel() || multiDispatchInfo.usesStatelessPrintfSurface()) {
+        return false;
+    }
+    if (timestampPacketContainer || device->getCommandStreamReceiver().peekTimestampPacketWriteEnabled() ||
+        DebugManager.flags.AUBDumpSubCaptureMode.get() || DebugManager.flags.AddPatchInfoCommentsForAUBDump.get()) {
+        return false;
+    }
+    for (auto &dispatchInfo : multiDispatchInfo) {
+        auto kernel = dispatchInfo.getKernel();
+        if (kernel->hasCompressedBufferArgs() || kernel->getProgram()->isKernelDebugEnabled()) {
+            return false;
+        }
     }
+    return true;
+}
+
+template <typename GfxFamily>
+bool CommandQueueHw<GfxFamily>::enqueueKernelFastPath(Surface **surfacesForResidency, size_t numSurfaceForResidency, bool blocking, const MultiDispatchInfo &multiDispatchInfo) {
+    auto &commandStreamReceiver = device->getCommandStreamReceiver();
+    auto commandStreamRecieverOwnership = commandStreamReceiver.obtainUniqueOwnership();
+    TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
+
+    // a queue gets blocked only under its ownership, so it can't become blocked after this check
+    if (isQueueBlocked()) {
+        queueOwnership.unlock();
+        commandStreamRecieverOwnership.unlock();
+        return false;
+    }
+
+    cl_uint numEventsInWaitList = 0;
+    const cl_event *eventWaitList = nullptr;
+    auto blockQueue = false;
+    auto taskLevel = 0u;
+    obtainTaskLevelAndBlockedStatus(taskLevel, numEventsInWaitList, eventWaitList, blockQueue, CL_COMMAND_NDRANGE_KERNEL);
+    DEBUG_BREAK_IF(blockQueue);
+
+    auto preemption = PreemptionHelper::taskPreemptionMode(*device, multiDispatchInfo);
+    auto &commandStream = getCommandStream<GfxFamily, CL_COMMAND_NDRANGE_KERNEL>(*this, 0, false, false, multiDispatchInfo);
+    auto commandStreamStart = commandStream.getUsed();
+
+    enqueueHandlerHook(CL_COMMAND_NDRANGE_KERNEL, multiDispatchInfo);
+    DebugManager.dumpKernelArgs(&multiDispatchInfo);
+
+    if (DebugManager.flags.MakeEachEnqueueBlocking.get()) {
+        blocking = true;
+    }
+
+    HardwareInterface<GfxFamily>::dispatchWalker(
+        *this,
+        multiDispatchInfo,
+        0,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        preemption,
+        false,
+        CL_COMMAND_NDRANGE_KERNEL);
+
+    commandStreamReceiver.setRequiredScratchSize(multiDispatchInfo.getRequiredScratchSize());
+
+    EventsRequest eventsRequest(0, nullptr, nullptr);
+    EventBuilder eventBuilder;
+    auto completionStamp = enqueueNonBlocked<CL_COMMAND_NDRANGE_KERNEL>(
+        surfacesForResidency,
+        numSurfaceForResidency,
+        commandStream,
+        commandStreamStart,
+        blocking,
+        multiDispatchInfo,
+        nullptr,
+        eventsRequest,
+        eventBuilder,
+        taskLevel,
+        multiDispatchInfo.usesSlm(),
+        preemption,
+        nullptr);
+    updateFromCompletionStamp(completionStamp);
+
+    queueOwnership.unlock();
+    commandStreamRecieverOwnership.unlock();
+
+    if (blocking) {
+        waitUntilComplete(taskCount, flushStamp->peekStamp(), false);
+        commandStreamReceiver.waitForTaskCountAndCleanAllocationList(completionStamp.taskCount, TEMPORARY_ALLOCATION);
+    }
+    return true;
 }
 
 template <typename GfxFamily>
@@ -498,6 +688,7 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
     EventBuilder &eventBuilder,
     uint32_t taskLevel,
     bool slmUsed,
+    PreemptionMode preemptionMode,
     PrintfHandler *printfHandler) {
 
     UNRECOVERABLE_IF(multiDispatchInfo.empty());
@@ -506,7 +697,12 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
     auto implicitFlush = false;
 
     if (printfHandler) {
-        blocking = true;
+        if (DebugManager.flags.EnableAsyncPrintfOutput.get()) {
+            // output is printed in the background, it only has to reach the GPU
+            implicitFlush = true;
+        } else {
+            blocking = true;
+        }
         printfHandler->makeResident(commandStreamReceiver);
     }
     if (timestampPacketContainer) {
@@ -578,12 +774,17 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
     dispatchFlags.lowPriority = priority == QueuePriority::LOW;
     dispatchFlags.implicitFlush = implicitFlush;
     dispatchFlags.flushStampReference = this->flushStamp->getStampReference();
-    dispatchFlags.preemptionMode = PreemptionHelper::taskPreemptionMode(*device, multiDispatchInfo);
+    dispatchFlags.preemptionMode = preemptionMode;
     dispatchFlags.outOfOrderExecutionAllowed = !eventBuilder.getEvent() || commandStreamReceiver.isNTo1SubmissionModelEnabled();
-    if (commandStreamReceiver.peekTimestampPacketWriteEnabled()) {
+    if (commandStreamReceiver.peekTimestampPacketWriteEnabled() || hasDependenciesFromOtherCsrs(eventsRequest.numEventsInWaitList, eventsRequest.eventWaitList)) {
         dispatchFlags.outOfDeviceDependencies = &eventsRequest;
     }
     dispatchFlags.numGrfRequired = numGrfRequired;
+    if (blitterDependencyPending) {
+        dispatchFlags.blitterDependencyTagAllocation = device->getBlitterCommandStreamReceiver()->getTagAllocation();
+        dispatchFlags.blitterDependencyTaskCount = blitterTaskCount;
+        blitterDependencyPending = false;
+    }
     DEBUG_BREAK_IF(taskLevel >= Event::eventNotReady);
 
     if (gtpinIsGTPinInitialized()) {
@@ -670,6 +871,12 @@ void CommandQueueHw<GfxFamily>::enqueueBlocked(
         for (auto &surface : CreateRange(surfaces, surfaceCount)) {
             allSurfaces.push_back(surface->duplicate());
         }
+        BuffersForAuxTranslation compressedBuffers;
+        for (auto &dispatchInfo : multiDispatchInfo) {
+            if (dispatchInfo.getKernel()->hasCompressedBufferArgs()) {
+                dispatchInfo.getKernel()->fillWithCompressedBuffers(compressedBuffers);
+            }
+        }
         PreemptionMode preemptionMode = PreemptionHelper::taskPreemptionMode(*device, multiDispatchInfo);
         auto kernelOperation = std::unique_ptr<KernelOperation>(blockedCommandsData); // marking ownership
         auto cmd = std::make_unique<CommandComputeKernel>(
@@ -688,6 +895,7 @@ void CommandQueueHw<GfxFamily>::enqueueBlocked(
             cmd->setTimestampPacketNode(*timestampPacketContainer, *previousTimestampPacketNodes);
         }
         cmd->setEventsRequest(eventsRequest);
+        cmd->pinAuxTranslationState(compressedBuffers);
         eventBuilder->getEvent()->setCommand(std::move(cmd));
     }
 
@@ -10,6 +10,7 @@
 #include "runtime/command_queue/command_queue_hw.h"
 #include "runtime/command_queue/enqueue_common.h"
 #include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/helpers/blit_commands_helper.h"
 #include "runtime/helpers/kernel_commands.h"
 #include "runtime/mem_obj/buffer.h"
 #include "runtime/memory_manager/surface.h"
@@ -29,10 +30,20 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyBuffer(
     const cl_event *eventWaitList,
     cl_event *event) {
 
+    if (isBlitEnqueueAllowed(numEventsInWaitList, event, *srcBuffer->getGraphicsAllocation(), *dstBuffer->getGraphicsAllocation())) {
+        BlitProperties blitProperties;
+        blitProperties.srcAllocation = srcBuffer->getGraphicsAllocation();
+        blitProperties.dstAllocation = dstBuffer->getGraphicsAllocation();
+        blitProperties.srcOffset = srcBuffer->getOffset() + srcOffset;
+        blitProperties.dstOffset = dstBuffer->getOffset() + dstOffset;
+        blitProperties.copySize = size;
+        enqueueBlit(blitProperties, false);
+        return CL_SUCCESS;
+    }
+
     MultiDispatchInfo dispatchInfo;
 
-    auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer,
-                                                                                                        this->getContext(), this->getDevice());
+    auto &builder = getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer);
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
     BuiltinDispatchInfoBuilder::BuiltinOpParams dc;
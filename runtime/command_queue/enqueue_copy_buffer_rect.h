@@ -33,8 +33,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyBufferRect(
 
     MultiDispatchInfo dispatchInfo;
 
-    auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferRect,
-                                                                                                        this->getContext(), this->getDevice());
+    auto &builder = getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferRect);
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
     MemObjSurface srcBufferSurf(srcBuffer);
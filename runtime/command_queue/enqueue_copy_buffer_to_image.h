@@ -33,8 +33,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyBufferToImage(
 
     MultiDispatchInfo di;
 
-    auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToImage3d,
-                                                                                                        this->getContext(), this->getDevice());
+    auto &builder = getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToImage3d);
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
     MemObjSurface srcBufferSurf(srcBuffer);
@@ -33,8 +33,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyImageToBuffer(
 
     MultiDispatchInfo di;
 
-    auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyImage3dToBuffer,
-                                                                                                        this->getContext(), this->getDevice());
+    auto &builder = getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyImage3dToBuffer);
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
     MemObjSurface srcImgSurf(srcImage);
@@ -28,6 +28,20 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillBuffer(
     cl_uint numEventsInWaitList,
     const cl_event *eventWaitList,
     cl_event *event) {
+    auto cpuFillMode = DebugManager.flags.DoCpuFillOnFillBuffer.get();
+    bool cpuFillRequired = cpuFillMode == 1 ? numEventsInWaitList == 0 && buffer->isFillOnCpuPossible()
+                                            : cpuFillMode == -1 && buffer->isFillOnCpuAllowed(numEventsInWaitList, size) && isCompleted(taskCount);
+    if (cpuFillRequired &&
+        context->getDevice(0)->getDeviceInfo().cpuCopyAllowed &&
+        !isQueueBlocked()) {
+        cl_int retVal = CL_SUCCESS;
+        TransferProperties transferProperties(buffer, CL_COMMAND_FILL_BUFFER, 0, true, &offset, &size, const_cast<void *>(pattern));
+        transferProperties.patternSize = patternSize;
+        EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
+        cpuDataTransferHandler(transferProperties, eventsRequest, retVal);
+        return retVal;
+    }
+
     auto memoryManager = getDevice().getMemoryManager();
     DEBUG_BREAK_IF(nullptr == memoryManager);
 
@@ -46,8 +60,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillBuffer(
 
     MultiDispatchInfo dispatchInfo;
 
-    auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer,
-                                                                                                        this->getContext(), this->getDevice());
+    auto &builder = getBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer);
 
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
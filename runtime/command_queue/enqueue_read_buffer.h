@@ -10,6 +10,7 @@
 #include "runtime/command_queue/command_queue_hw.h"
 #include "runtime/command_queue/enqueue_common.h"
 #include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/helpers/blit_commands_helper.h"
 #include "runtime/helpers/cache_policy.h"
 #include "runtime/helpers/kernel_commands.h"
 #include "runtime/mem_obj/buffer.h"
@@ -79,8 +80,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
 
         return CL_SUCCESS;
     }
-    auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer,
-                                                                                                        this->getContext(), this->getDevice());
+    auto &builder = getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer);
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
     void *dstPtr = ptr;
@@ -95,6 +95,18 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
             return CL_OUT_OF_RESOURCES;
         }
         dstPtr = reinterpret_cast<void *>(hostPtrSurf.getAllocation()->getGpuAddressToPatch());
+
+        if (blockingRead == CL_TRUE && isBlitEnqueueAllowed(numEventsInWaitList, event, *buffer->getGraphicsAllocation(), *hostPtrSurf.getAllocation())) {
+            BlitProperties blitProperties;
+            blitProperties.srcAllocation = buffer->getGraphicsAllocation();
+            blitProperties.dstAllocation = hostPtrSurf.getAllocation();
+            blitProperties.srcOffset = buffer->getOffset() + offset;
+            blitProperties.copySize = size;
+            enqueueBlit(blitProperties, true);
+            // blitter already finished with host memory, temporary allocation may be released
+            hostPtrSurf.getAllocation()->taskCount = taskCount;
+            return CL_SUCCESS;
+        }
     }
 
     BuiltinDispatchInfoBuilder::BuiltinOpParams dc;
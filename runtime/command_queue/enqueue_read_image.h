@@ -66,8 +66,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadImage(
         return CL_SUCCESS;
     }
 
-    auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyImage3dToBuffer,
-                                                                                                        this->getContext(), this->getDevice());
+    auto &builder = getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyImage3dToBuffer);
 
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
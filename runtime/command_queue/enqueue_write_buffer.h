@@ -9,6 +9,7 @@
 #include "hw_cmds.h"
 #include "runtime/command_queue/command_queue_hw.h"
 #include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/helpers/blit_commands_helper.h"
 #include "runtime/helpers/kernel_commands.h"
 #include "runtime/helpers/string.h"
 #include "runtime/mem_obj/buffer.h"
@@ -77,8 +78,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
 
         return CL_SUCCESS;
     }
-    auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer,
-                                                                                                        this->getContext(), this->getDevice());
+    auto &builder = getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer);
 
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
@@ -94,6 +94,18 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
             return CL_OUT_OF_RESOURCES;
         }
         srcPtr = reinterpret_cast<void *>(hostPtrSurf.getAllocation()->getGpuAddressToPatch());
+
+        if (blockingWrite == CL_TRUE && isBlitEnqueueAllowed(numEventsInWaitList, event, *hostPtrSurf.getAllocation(), *buffer->getGraphicsAllocation())) {
+            BlitProperties blitProperties;
+            blitProperties.srcAllocation = hostPtrSurf.getAllocation();
+            blitProperties.dstAllocation = buffer->getGraphicsAllocation();
+            blitProperties.dstOffset = buffer->getOffset() + offset;
+            blitProperties.copySize = size;
+            enqueueBlit(blitProperties, true);
+            // blitter already finished with host memory, temporary allocation may be released
+            hostPtrSurf.getAllocation()->taskCount = taskCount;
+            return CL_SUCCESS;
+        }
     }
 
     BuiltinDispatchInfoBuilder::BuiltinOpParams dc;
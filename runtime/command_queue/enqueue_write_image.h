@@ -61,8 +61,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteImage(
 
         return CL_SUCCESS;
     }
-    auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToImage3d,
-                                                                                                        this->getContext(), this->getDevice());
+    auto &builder = getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToImage3d);
 
     BuiltInOwnershipWrapper lock(builder, this->context);
 
@@ -27,6 +27,7 @@ cl_int CommandQueueHw<GfxFamily>::finish(bool dcFlush) {
 
     // Stall until HW reaches CQ taskCount
     waitUntilComplete(taskCountToWaitFor, flushStampToWaitFor, false);
+    device->getAsyncPrintfOutputHandler().waitForOutputs(taskCountToWaitFor);
 
     commandStreamReceiver.waitForTaskCountAndCleanAllocationList(taskCountToWaitFor, TEMPORARY_ALLOCATION);
 
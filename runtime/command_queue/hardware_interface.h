@@ -80,6 +80,10 @@ class HardwareInterface {
         LinearStream *commandStream,
         CommandQueue &commandQueue);
 
+    static void patchKernelConstants(
+        const MultiDispatchInfo &multiDispatchInfo,
+        const DispatchInfo &dispatchInfo);
+
     static WALKER_TYPE<GfxFamily> *allocateWalkerSpace(LinearStream &commandStream,
                                                        const Kernel &kernel);
 };
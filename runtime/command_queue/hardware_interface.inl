@@ -136,43 +136,13 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
 
         // Compute local workgroup sizes
         Vec3<size_t> lws = dispatchInfo.getLocalWorkgroupSize();
-        Vec3<size_t> elws = (dispatchInfo.getEnqueuedWorkgroupSize().x > 0) ? dispatchInfo.getEnqueuedWorkgroupSize() : lws;
 
         // Compute number of work groups
         Vec3<size_t> twgs = (dispatchInfo.getTotalNumberOfWorkgroups().x > 0) ? dispatchInfo.getTotalNumberOfWorkgroups()
                                                                               : generateWorkgroupsNumber(gws, lws);
         Vec3<size_t> nwgs = (dispatchInfo.getNumberOfWorkgroups().x > 0) ? dispatchInfo.getNumberOfWorkgroups() : twgs;
 
-        // Patch our kernel constants
-        *kernel.globalWorkOffsetX = static_cast<uint32_t>(offset.x);
-        *kernel.globalWorkOffsetY = static_cast<uint32_t>(offset.y);
-        *kernel.globalWorkOffsetZ = static_cast<uint32_t>(offset.z);
-
-        *kernel.globalWorkSizeX = static_cast<uint32_t>(gws.x);
-        *kernel.globalWorkSizeY = static_cast<uint32_t>(gws.y);
-        *kernel.globalWorkSizeZ = static_cast<uint32_t>(gws.z);
-
-        if ((&kernel == multiDispatchInfo.peekMainKernel()) || (kernel.localWorkSizeX2 == &Kernel::dummyPatchLocation)) {
-            *kernel.localWorkSizeX = static_cast<uint32_t>(lws.x);
-            *kernel.localWorkSizeY = static_cast<uint32_t>(lws.y);
-            *kernel.localWorkSizeZ = static_cast<uint32_t>(lws.z);
-        }
-
-        *kernel.localWorkSizeX2 = static_cast<uint32_t>(lws.x);
-        *kernel.localWorkSizeY2 = static_cast<uint32_t>(lws.y);
-        *kernel.localWorkSizeZ2 = static_cast<uint32_t>(lws.z);
-
-        *kernel.enqueuedLocalWorkSizeX = static_cast<uint32_t>(elws.x);
-        *kernel.enqueuedLocalWorkSizeY = static_cast<uint32_t>(elws.y);
-        *kernel.enqueuedLocalWorkSizeZ = static_cast<uint32_t>(elws.z);
-
-        if (&kernel == multiDispatchInfo.peekMainKernel()) {
-            *kernel.numWorkGroupsX = static_cast<uint32_t>(twgs.x);
-            *kernel.numWorkGroupsY = static_cast<uint32_t>(twgs.y);
-            *kernel.numWorkGroupsZ = static_cast<uint32_t>(twgs.z);
-        }
-
-        *kernel.workDim = dim;
+        patchKernelConstants(multiDispatchInfo, dispatchInfo);
 
         // Send our indirect object data
         size_t localWorkSizes[3] = {lws.x, lws.y, lws.z};
@@ -232,4 +202,50 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
     dispatchProfilingPerfEndCommands(hwTimeStamps, hwPerfCounter, commandStream, commandQueue);
 }
 
+template <typename GfxFamily>
+void HardwareInterface<GfxFamily>::patchKernelConstants(
+    const MultiDispatchInfo &multiDispatchInfo,
+    const DispatchInfo &dispatchInfo) {
+
+    auto &kernel = *dispatchInfo.getKernel();
+    uint32_t dim = dispatchInfo.getDim();
+    Vec3<size_t> gws = dispatchInfo.getGWS();
+    Vec3<size_t> offset = dispatchInfo.getOffset();
+    Vec3<size_t> lws = dispatchInfo.getLocalWorkgroupSize();
+    Vec3<size_t> elws = (dispatchInfo.getEnqueuedWorkgroupSize().x > 0) ? dispatchInfo.getEnqueuedWorkgroupSize() : lws;
+    Vec3<size_t> twgs = (dispatchInfo.getTotalNumberOfWorkgroups().x > 0) ? dispatchInfo.getTotalNumberOfWorkgroups()
+                                                                          : generateWorkgroupsNumber(gws, lws);
+
+    // Patch our kernel constants
+    *kernel.globalWorkOffsetX = static_cast<uint32_t>(offset.x);
+    *kernel.globalWorkOffsetY = static_cast<uint32_t>(offset.y);
+    *kernel.globalWorkOffsetZ = static_cast<uint32_t>(offset.z);
+
+    *kernel.globalWorkSizeX = static_cast<uint32_t>(gws.x);
+    *kernel.globalWorkSizeY = static_cast<uint32_t>(gws.y);
+    *kernel.globalWorkSizeZ = static_cast<uint32_t>(gws.z);
+
+    if ((&kernel == multiDispatchInfo.peekMainKernel()) || (kernel.localWorkSizeX2 == &Kernel::dummyPatchLocation)) {
+        *kernel.localWorkSizeX = static_cast<uint32_t>(lws.x);
+        *kernel.localWorkSizeY = static_cast<uint32_t>(lws.y);
+        *kernel.localWorkSizeZ = static_cast<uint32_t>(lws.z);
+    }
+
+    *kernel.localWorkSizeX2 = static_cast<uint32_t>(lws.x);
+    *kernel.localWorkSizeY2 = static_cast<uint32_t>(lws.y);
+    *kernel.localWorkSizeZ2 = static_cast<uint32_t>(lws.z);
+
+    *kernel.enqueuedLocalWorkSizeX = static_cast<uint32_t>(elws.x);
+    *kernel.enqueuedLocalWorkSizeY = static_cast<uint32_t>(elws.y);
+    *kernel.enqueuedLocalWorkSizeZ = static_cast<uint32_t>(elws.z);
+
+    if (&kernel == multiDispatchInfo.peekMainKernel()) {
+        *kernel.numWorkGroupsX = static_cast<uint32_t>(twgs.x);
+        *kernel.numWorkGroupsY = static_cast<uint32_t>(twgs.y);
+        *kernel.numWorkGroupsZ = static_cast<uint32_t>(twgs.z);
+    }
+
+    *kernel.workDim = dim;
+}
+
 } // namespace OCLRT
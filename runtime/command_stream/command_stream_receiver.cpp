@@ -111,6 +111,8 @@ void CommandStreamReceiver::waitForTaskCountAndCleanAllocationList(uint32_t requ
             ;
     }
 
+    getMemoryManager()->getScratchSpaceManager()->trimIdle();
+
     auto &allocationList = (allocationType == TEMPORARY_ALLOCATION) ? temporaryAllocations : allocationsForReuse;
     if (allocationList.peekIsEmpty()) {
         return;
@@ -160,8 +162,10 @@ void CommandStreamReceiver::cleanupResources() {
     waitForTaskCountAndCleanAllocationList(this->latestFlushedTaskCount, TEMPORARY_ALLOCATION);
     waitForTaskCountAndCleanAllocationList(this->latestFlushedTaskCount, REUSABLE_ALLOCATION);
 
+    auto scratchSpaceManager = getMemoryManager()->getScratchSpaceManager();
+    scratchSpaceManager->releaseCompletionTag(getTagAddress());
     if (scratchAllocation) {
-        getMemoryManager()->freeGraphicsMemory(scratchAllocation);
+        scratchSpaceManager->releaseScratchSpace(scratchAllocation, nullptr, 0);
         scratchAllocation = nullptr;
     }
 
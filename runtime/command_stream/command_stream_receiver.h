@@ -22,6 +22,7 @@
 #include <cstdint>
 
 namespace OCLRT {
+struct BlitProperties;
 class Device;
 class EventBuilder;
 class ExecutionEnvironment;
@@ -62,6 +63,8 @@ class CommandStreamReceiver {
 
     virtual void flushBatchedSubmissions() = 0;
 
+    virtual uint32_t blitBuffer(const BlitProperties &blitProperties, OsContext &osContext) = 0;
+
     virtual void makeCoherent(GraphicsAllocation &gfxAllocation){};
     virtual void makeResident(GraphicsAllocation &gfxAllocation);
     virtual void makeNonResident(GraphicsAllocation &gfxAllocation);
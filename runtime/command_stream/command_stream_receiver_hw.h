@@ -36,6 +36,8 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
 
     void flushBatchedSubmissions() override;
 
+    uint32_t blitBuffer(const BlitProperties &blitProperties, OsContext &osContext) override;
+
     void addPipeControl(LinearStream &commandStream, bool dcFlush) override;
     int getRequiredPipeControlSize() const;
 
@@ -78,6 +80,7 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
     void programPipelineSelect(LinearStream &csr, DispatchFlags &dispatchFlags);
     void programMediaSampler(LinearStream &csr, DispatchFlags &dispatchFlags);
     void handleEventsTimestampPacketTags(LinearStream &csr, DispatchFlags &dispatchFlags, Device &currentDevice);
+    void handleEventsCsrTags(LinearStream &csr, DispatchFlags &dispatchFlags);
     virtual void programVFEState(LinearStream &csr, DispatchFlags &dispatchFlags);
     virtual void initPageTableManagerRegisters(LinearStream &csr){};
     void createScratchSpaceAllocation(size_t requiredScratchSizeInBytes);
@@ -10,6 +10,7 @@
 #include "runtime/command_stream/linear_stream.h"
 #include "runtime/device/device.h"
 #include "runtime/gtpin/gtpin_notify.h"
+#include "runtime/helpers/blit_commands_helper.h"
 #include "runtime/helpers/cache_policy.h"
 #include "runtime/helpers/flat_batch_buffer_helper_hw.h"
 #include "runtime/helpers/hw_helper.h"
@@ -23,6 +24,7 @@
 #include "runtime/command_stream/preemption.h"
 #include "runtime/command_queue/gpgpu_walker.h"
 #include "runtime/utilities/tag_allocator.h"
+#include "runtime/utilities/telemetry.h"
 #include "command_stream_receiver_hw.h"
 
 namespace OCLRT {
@@ -146,6 +148,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     typedef typename GfxFamily::MI_BATCH_BUFFER_END MI_BATCH_BUFFER_END;
     typedef typename GfxFamily::PIPE_CONTROL PIPE_CONTROL;
     typedef typename GfxFamily::STATE_BASE_ADDRESS STATE_BASE_ADDRESS;
+    TelemetryScope telemetryScope(TelemetryCounter::FlushTask);
 
     DEBUG_BREAK_IF(&commandStreamTask == &commandStream);
     DEBUG_BREAK_IF(!(dispatchFlags.preemptionMode == PreemptionMode::Disabled ? device.getPreemptionMode() == PreemptionMode::Disabled : true));
@@ -246,8 +249,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
 
     if (requiredScratchSize && (!scratchAllocation || scratchAllocation->getUnderlyingBufferSize() < requiredScratchSizeInBytes)) {
         if (scratchAllocation) {
-            scratchAllocation->taskCount = this->taskCount;
-            getMemoryManager()->storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchAllocation), TEMPORARY_ALLOCATION);
+            getMemoryManager()->getScratchSpaceManager()->releaseScratchSpace(scratchAllocation, getTagAddress(), this->taskCount);
         }
         createScratchSpaceAllocation(requiredScratchSizeInBytes);
         overrideMediaVFEStateDirty(true);
@@ -261,6 +263,13 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
 
     if (dispatchFlags.outOfDeviceDependencies) {
         handleEventsTimestampPacketTags(commandStreamCSR, dispatchFlags, device);
+        handleEventsCsrTags(commandStreamCSR, dispatchFlags);
+    }
+    if (dispatchFlags.blitterDependencyTagAllocation) {
+        KernelCommandsHelper<GfxFamily>::programMiSemaphoreWait(commandStreamCSR, dispatchFlags.blitterDependencyTagAllocation->getGpuAddress(),
+                                                                dispatchFlags.blitterDependencyTaskCount,
+                                                                GfxFamily::MI_SEMAPHORE_WAIT::COMPARE_OPERATION::COMPARE_OPERATION_SAD_GREATER_THAN_OR_EQUAL_SDD);
+        makeResident(*dispatchFlags.blitterDependencyTagAllocation);
     }
     if (stallingPipeControlOnNextFlushRequired) {
         stallingPipeControlOnNextFlushRequired = false;
@@ -583,6 +592,60 @@ inline void CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
     }
 }
 
+template <typename GfxFamily>
+uint32_t CommandStreamReceiverHw<GfxFamily>::blitBuffer(const BlitProperties &blitProperties, OsContext &osContext) {
+    using MI_FLUSH_DW = typename GfxFamily::MI_FLUSH_DW;
+    using MI_BATCH_BUFFER_END = typename GfxFamily::MI_BATCH_BUFFER_END;
+
+    auto lock = obtainUniqueOwnership();
+
+    auto requiredSize = BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(blitProperties) +
+                        sizeof(MI_FLUSH_DW) + sizeof(MI_BATCH_BUFFER_END) + MemoryConstants::cacheLineSize;
+    if (commandStream.getCpuBase() && commandStream.getAvailableSpace() < requiredSize) {
+        // exhausted command buffer is recycled through lists tracked with render engine task counts
+        waitForCompletionWithTimeout(false, 0, taskCount);
+    }
+    auto &commandStream = getCS(requiredSize);
+    auto commandStreamStart = commandStream.getUsed();
+    auto newTaskCount = taskCount + 1;
+    latestSentTaskCount = newTaskCount;
+
+    BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsForBuffer(blitProperties, commandStream);
+
+    auto miFlushDwCmd = commandStream.getSpaceForCmd<MI_FLUSH_DW>();
+    *miFlushDwCmd = MI_FLUSH_DW::sInit();
+    miFlushDwCmd->setPostSyncOperation(MI_FLUSH_DW::POST_SYNC_OPERATION_WRITE_IMMEDIATE_DATA_QWORD);
+    miFlushDwCmd->setDestinationAddress(tagAllocation->getGpuAddress());
+    miFlushDwCmd->setImmediateData(newTaskCount);
+
+    addBatchBufferEnd(commandStream, nullptr);
+    alignToCacheLine(commandStream);
+
+    ResidencyContainer allocationsForResidency = {blitProperties.srcAllocation, blitProperties.dstAllocation, tagAllocation};
+    if (blitProperties.dependencyTagAllocation) {
+        allocationsForResidency.push_back(blitProperties.dependencyTagAllocation);
+    }
+
+    // allocations are shared with the render engine CSR of the same device, keep its residency tracking intact
+    std::vector<int> residencyTaskCounts;
+    residencyTaskCounts.reserve(allocationsForResidency.size());
+    for (auto &allocation : allocationsForResidency) {
+        residencyTaskCounts.push_back(allocation->residencyTaskCount[this->deviceIndex]);
+    }
+
+    BatchBuffer batchBuffer{commandStream.getGraphicsAllocation(), commandStreamStart, 0, nullptr, false, false, QueueThrottle::MEDIUM, commandStream.getUsed(), &commandStream};
+    flushStamp->setStamp(this->flush(batchBuffer, EngineType::ENGINE_BCS, allocationsForResidency, osContext));
+
+    for (size_t i = 0; i < allocationsForResidency.size(); i++) {
+        allocationsForResidency[i]->residencyTaskCount[this->deviceIndex] = residencyTaskCounts[i];
+    }
+
+    latestFlushedTaskCount = newTaskCount;
+    taskCount = newTaskCount;
+
+    return taskCount;
+}
+
 template <typename GfxFamily>
 void CommandStreamReceiverHw<GfxFamily>::addPipeControl(LinearStream &commandStream, bool dcFlush) {
     typedef typename GfxFamily::PIPE_CONTROL PIPE_CONTROL;
@@ -659,6 +722,9 @@ size_t CommandStreamReceiverHw<GfxFamily>::getRequiredCmdStreamSize(const Dispat
     if (dispatchFlags.outOfDeviceDependencies) {
         size += dispatchFlags.outOfDeviceDependencies->numEventsInWaitList * sizeof(typename GfxFamily::MI_SEMAPHORE_WAIT);
     }
+    if (dispatchFlags.blitterDependencyTagAllocation) {
+        size += sizeof(typename GfxFamily::MI_SEMAPHORE_WAIT);
+    }
     if (stallingPipeControlOnNextFlushRequired) {
         size += sizeof(typename GfxFamily::PIPE_CONTROL);
     }
@@ -675,6 +741,7 @@ inline void CommandStreamReceiverHw<GfxFamily>::emitNoop(LinearStream &commandSt
 
 template <typename GfxFamily>
 inline void CommandStreamReceiverHw<GfxFamily>::waitForTaskCountWithKmdNotifyFallback(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep, OsContext &osContext) {
+    TelemetryScope telemetryScope(TelemetryCounter::WaitForTaskCount);
     int64_t waitTimeout = 0;
     bool enableTimeout = kmdNotifyHelper->obtainTimeoutParams(waitTimeout, useQuickKmdSleep, *getTagAddress(), taskCountToWait, flushStampToWait);
 
@@ -799,6 +866,9 @@ void CommandStreamReceiverHw<GfxFamily>::handleEventsTimestampPacketTags(LinearS
         }
 
         auto timestmapPacketContainer = event->getTimestampPacketNodes();
+        if (!timestmapPacketContainer) {
+            continue;
+        }
         timestmapPacketContainer->makeResident(*this);
 
         if (&event->getCommandQueue()->getDevice() != &currentDevice) {
@@ -809,8 +879,26 @@ void CommandStreamReceiverHw<GfxFamily>::handleEventsTimestampPacketTags(LinearS
     }
 }
 
+template <typename GfxFamily>
+void CommandStreamReceiverHw<GfxFamily>::handleEventsCsrTags(LinearStream &csr, DispatchFlags &dispatchFlags) {
+    for (cl_uint i = 0; i < dispatchFlags.outOfDeviceDependencies->numEventsInWaitList; i++) {
+        auto event = castToObjectOrAbort<Event>(dispatchFlags.outOfDeviceDependencies->eventWaitList[i]);
+        if (event->isUserEvent() || !event->getCommandQueue() || event->getTimestampPacketNodes() || event->peekTaskCount() == Event::eventNotReady) {
+            continue;
+        }
+
+        // work of other receiver is ordered with semaphore on its tag instead of waiting for it on host
+        auto &eventCsr = event->getCommandQueue()->getDevice().getCommandStreamReceiver();
+        if (&eventCsr != this) {
+            KernelCommandsHelper<GfxFamily>::programMiSemaphoreWait(csr, eventCsr.getTagAllocation()->getGpuAddress(), event->peekTaskCount(),
+                                                                    GfxFamily::MI_SEMAPHORE_WAIT::COMPARE_OPERATION::COMPARE_OPERATION_SAD_GREATER_THAN_OR_EQUAL_SDD);
+            makeResident(*eventCsr.getTagAllocation());
+        }
+    }
+}
+
 template <typename GfxFamily>
 void CommandStreamReceiverHw<GfxFamily>::createScratchSpaceAllocation(size_t requiredScratchSizeInBytes) {
-    scratchAllocation = getMemoryManager()->allocateGraphicsMemoryInPreferredPool(AllocationFlags(true), 0, nullptr, requiredScratchSizeInBytes, GraphicsAllocation::AllocationType::SCRATCH_SURFACE);
+    scratchAllocation = getMemoryManager()->getScratchSpaceManager()->obtainScratchSpace(requiredScratchSizeInBytes);
 }
 } // namespace OCLRT
@@ -13,6 +13,7 @@
 #include <limits>
 
 namespace OCLRT {
+class GraphicsAllocation;
 struct FlushStampTrackingObj;
 
 namespace CSRequirements {
@@ -45,6 +46,8 @@ struct DispatchFlags {
     PreemptionMode preemptionMode = PreemptionMode::Disabled;
     EventsRequest *outOfDeviceDependencies = nullptr;
     uint32_t numGrfRequired = GrfConfig::DefaultGrfNumber;
+    GraphicsAllocation *blitterDependencyTagAllocation = nullptr;
+    uint32_t blitterDependencyTaskCount = 0;
 };
 
 struct CsrSizeRequestFlags {
@@ -71,6 +71,7 @@ Device::Device(const HardwareInfo &hwInfo, ExecutionEnvironment *executionEnviro
     name.reserve(100);
     preemptionMode = PreemptionHelper::getDefaultPreemptionMode(hwInfo);
     engineType = getChosenEngineType(hwInfo);
+    asyncPrintfOutputHandler = std::make_unique<AsyncPrintfOutputHandler>(*this);
 
     if (!getSourceLevelDebugger()) {
         this->executionEnvironment->initSourceLevelDebugger(hwInfo);
@@ -81,6 +82,7 @@ Device::Device(const HardwareInfo &hwInfo, ExecutionEnvironment *executionEnviro
 }
 
 Device::~Device() {
+    asyncPrintfOutputHandler->waitForAllOutputs();
     CompilerInterface::shutdown();
     DEBUG_BREAK_IF(nullptr == executionEnvironment->memoryManager.get());
     if (performanceCounters) {
@@ -123,6 +125,16 @@ bool Device::createDeviceImpl(const HardwareInfo *pHwInfo, Device &outDevice) {
         return false;
     }
 
+    if (DebugManager.flags.EnableBlitterOperationsForBuffers.get()) {
+        if (!executionEnvironment->initializeBlitterCommandStreamReceiver(pHwInfo, outDevice.getDeviceIndex())) {
+            return false;
+        }
+        outDevice.blitterCommandStreamReceiver = executionEnvironment->blitterCommandStreamReceivers[outDevice.getDeviceIndex()].get();
+        if (!outDevice.blitterCommandStreamReceiver->initializeTagAllocation()) {
+            return false;
+        }
+    }
+
     auto pDevice = &outDevice;
     if (!pDevice->osTime) {
         pDevice->osTime = OSTime::create(outDevice.commandStreamReceiver->getOSInterface());
@@ -14,6 +14,7 @@
 #include "runtime/helpers/engine_node.h"
 #include "runtime/memory_manager/memory_constants.h"
 #include "runtime/os_interface/performance_counters.h"
+#include "runtime/program/async_printf_output_handler.h"
 #include <vector>
 
 namespace OCLRT {
@@ -118,6 +119,8 @@ class Device : public BaseObject<_cl_device_id> {
     ExecutionEnvironment *getExecutionEnvironment() const { return executionEnvironment; }
     const HardwareCapabilities &getHardwareCapabilities() const { return hardwareCapabilities; }
     OsContext *getOsContext() const { return osContext; }
+    CommandStreamReceiver *getBlitterCommandStreamReceiver() const { return blitterCommandStreamReceiver; }
+    AsyncPrintfOutputHandler &getAsyncPrintfOutputHandler() { return *asyncPrintfOutputHandler; }
     uint32_t getDeviceIndex() { return deviceIndex; }
     bool isFullRangeSvm() {
         return getHardwareInfo().capabilityTable.gpuAddressSpace == MemoryConstants::max48BitAddress;
@@ -153,6 +156,7 @@ class Device : public BaseObject<_cl_device_id> {
     std::unique_ptr<OSTime> osTime;
     std::unique_ptr<DriverInfo> driverInfo;
     std::unique_ptr<PerformanceCounters> performanceCounters;
+    std::unique_ptr<AsyncPrintfOutputHandler> asyncPrintfOutputHandler;
 
     OsContext *osContext = nullptr;
 
@@ -165,6 +169,7 @@ class Device : public BaseObject<_cl_device_id> {
     ExecutionEnvironment *executionEnvironment = nullptr;
     uint32_t deviceIndex = 0u;
     CommandStreamReceiver *commandStreamReceiver = nullptr;
+    CommandStreamReceiver *blitterCommandStreamReceiver = nullptr;
 };
 
 template <cl_device_info Param>
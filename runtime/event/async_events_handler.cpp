@@ -9,6 +9,7 @@
 #include "runtime/event/event.h"
 #include "runtime/helpers/timestamp_packet.h"
 #include "runtime/os_interface/os_thread.h"
+#include "runtime/utilities/worker_pool.h"
 #include <iterator>
 
 namespace OCLRT {
@@ -57,6 +58,8 @@ Event *AsyncEventsHandler::processList() {
 
 void *AsyncEventsHandler::asyncProcess(void *arg) {
     auto self = reinterpret_cast<AsyncEventsHandler *>(arg);
+    // polls events in a loop for its whole lifetime, runs on a dedicated thread placed like worker pool threads
+    BackgroundThreadPolicy::get().applyToCurrentThread();
     std::unique_lock<std::mutex> lock(self->asyncMtx, std::defer_lock);
     Event *sleepCandidate = nullptr;
 
@@ -22,13 +22,31 @@
 #include "runtime/utilities/range.h"
 #include "runtime/utilities/stackvec.h"
 #include "runtime/utilities/tag_allocator.h"
+#include "runtime/utilities/trace_recorder.h"
 #include "runtime/platform/platform.h"
 #include "runtime/event/async_events_handler.h"
 
+#include <deque>
+
 namespace OCLRT {
 
 const cl_uint Event::eventNotReady = 0xFFFFFFF0;
 
+namespace {
+struct PendingUnblock {
+    Event *parent;
+    IFNodeRef<Event> *childEventRef;
+    uint32_t taskLevel;
+    int32_t transitionStatus;
+};
+
+// When a child event being unblocked propagates to its own children, the work is queued
+// to the unblock in progress instead of recursing, so deep dependency chains
+// are resolved iteratively with constant stack depth.
+thread_local std::deque<PendingUnblock> *pendingUnblocks = nullptr;
+thread_local Event *eventBeingUnblocked = nullptr;
+} // namespace
+
 Event::Event(
     Context *ctx,
     CommandQueue *cmdQueue,
@@ -123,6 +141,9 @@ Event::~Event() {
     }
 
     if (cmdQueue != nullptr) {
+        if (TraceRecorder::isEnabled() && cmdQueue->isCompleted(getCompletionStamp())) {
+            traceGpuExecution();
+        }
         cmdQueue->decRefInternal();
     }
 
@@ -298,6 +319,19 @@ bool Event::calcProfilingData() {
     return dataCalculated;
 }
 
+void Event::traceGpuExecution() {
+    if (!timeStampNode || profilingCpuPath || DebugManager.flags.ReturnRawGpuTimestamps.get() || !calcProfilingData()) {
+        return;
+    }
+    uint64_t cpuTime = 0;
+    if (!cmdQueue->getDevice().getOSTime()->getCpuTime(&cpuTime)) {
+        return;
+    }
+    // profiling timestamps use OS timer, move them to the trace clock
+    auto traceTime = TraceRecorder::getTimestamp();
+    TraceRecorder::recordGpuSpan(cmdType, reinterpret_cast<uintptr_t>(cmdQueue), startTimeStamp + traceTime - cpuTime, endTimeStamp - startTimeStamp);
+}
+
 inline bool Event::wait(bool blocking, bool useQuickKmdSleep) {
     while (this->taskCount == Event::eventNotReady) {
         if (blocking == false) {
@@ -342,7 +376,7 @@ void Event::updateExecutionStatus() {
         // Note : Intentional fallthrough (no return) to check for CL_COMPLETE
     }
 
-    if ((cmdQueue != nullptr) && (cmdQueue->isCompleted(getCompletionStamp()))) {
+    if ((cmdQueue != nullptr) && cmdQueue->isCompleted(getCompletionStamp()) && cmdQueue->isBlitterCompleted(blitterTaskCount)) {
         transitionExecutionStatus(CL_COMPLETE);
         executeCallbacks(CL_COMPLETE);
         unblockEventsBlockedByThis(CL_COMPLETE);
@@ -385,10 +419,41 @@ void Event::unblockEventsBlockedByThis(int32_t transitionStatus) {
     }
 
     auto childEventRef = childEventsToNotify.detachNodes();
+    if (childEventRef == nullptr) {
+        return;
+    }
+
+    if (pendingUnblocks != nullptr && this == eventBeingUnblocked) {
+        this->incRefInternal();
+        pendingUnblocks->push_back({this, childEventRef, taskLevelToPropagate, transitionStatus});
+        return;
+    }
+
+    // any other caller gets its whole subtree resolved before returning
+    std::deque<PendingUnblock> unblocksQueue;
+    auto previousPendingUnblocks = pendingUnblocks;
+    auto previousEventBeingUnblocked = eventBeingUnblocked;
+    pendingUnblocks = &unblocksQueue;
+
+    unblockChildEvents(*this, childEventRef, taskLevelToPropagate, transitionStatus);
+    while (!unblocksQueue.empty()) {
+        auto pendingUnblock = unblocksQueue.front();
+        unblocksQueue.pop_front();
+        unblockChildEvents(*pendingUnblock.parent, pendingUnblock.childEventRef, pendingUnblock.taskLevel, pendingUnblock.transitionStatus);
+        pendingUnblock.parent->decRefInternal();
+    }
+
+    pendingUnblocks = previousPendingUnblocks;
+    eventBeingUnblocked = previousEventBeingUnblocked;
+}
+
+void Event::unblockChildEvents(Event &parent, IFNodeRef<Event> *childEventRef, uint32_t taskLevel, int32_t transitionStatus) {
     while (childEventRef != nullptr) {
         auto childEvent = childEventRef->ref;
 
-        childEvent->unblockEventBy(*this, taskLevelToPropagate, transitionStatus);
+        eventBeingUnblocked = childEvent;
+        childEvent->unblockEventBy(parent, taskLevel, transitionStatus);
+        eventBeingUnblocked = nullptr;
 
         if (childEvent->getCommandQueue() && childEvent->isCurrentCmdQVirtualEvent()) {
             // Check virtual event state and delete it if possible.
@@ -464,7 +529,8 @@ void Event::submitCommand(bool abortTasks) {
                 this->cmdQueue->getDevice().getCommandStreamReceiver().makeResident(*perfCounterNode->getGraphicsAllocation());
             }
         }
-        auto &complStamp = cmdToProcess->submit(taskLevel, abortTasks);
+        auto &complStamp = this->cmdQueue ? this->cmdQueue->submitUnblockedCommand(*cmdToProcess, taskLevel, abortTasks)
+                                           : cmdToProcess->submit(taskLevel, abortTasks);
         if (profilingCpuPath && this->isProfilingEnabled() && (this->cmdQueue != nullptr)) {
             setEndTimeStamp();
         }
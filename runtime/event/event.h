@@ -94,6 +94,7 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     cl_ulong getDelta(cl_ulong startTime,
                       cl_ulong endTime);
     bool calcProfilingData();
+    void traceGpuExecution();
     void setCPUProfilingPath(bool isCPUPath) { this->profilingCpuPath = isCPUPath; }
     bool isCPUProfilingPath() {
         return profilingCpuPath;
@@ -277,6 +278,14 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
         return this->taskCount;
     }
 
+    // blitter engine task the event has to wait for in addition to its render task count
+    void setBlitterTaskCount(uint32_t blitterTaskCount) {
+        this->blitterTaskCount = blitterTaskCount;
+    }
+    uint32_t peekBlitterTaskCount() const {
+        return this->blitterTaskCount;
+    }
+
     void setQueueTimeStamp(TimeStampData *queueTimeStamp) {
         this->queueTimeStamp = *queueTimeStamp;
     };
@@ -333,6 +342,7 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     //vector storing events that needs to be notified when this event is ready to go
     IFRefList<Event, true, true> childEventsToNotify;
     void unblockEventsBlockedByThis(int32_t transitionStatus);
+    static void unblockChildEvents(Event &parent, IFNodeRef<Event> *childEventRef, uint32_t taskLevel, int32_t transitionStatus);
     void submitCommand(bool abortBlockedTasks);
 
     bool currentCmdQVirtualEvent;
@@ -373,5 +383,6 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
   private:
     // can be accessed only with updateTaskCount
     std::atomic<uint32_t> taskCount;
+    uint32_t blitterTaskCount = 0;
 };
 } // namespace OCLRT
@@ -52,6 +52,22 @@ bool ExecutionEnvironment::initializeCommandStreamReceiver(const HardwareInfo *p
     this->commandStreamReceivers[deviceIndex] = std::move(commandStreamReceiver);
     return true;
 }
+bool ExecutionEnvironment::initializeBlitterCommandStreamReceiver(const HardwareInfo *pHwInfo, uint32_t deviceIndex) {
+    if (deviceIndex + 1 > blitterCommandStreamReceivers.size()) {
+        blitterCommandStreamReceivers.resize(deviceIndex + 1);
+    }
+
+    if (this->blitterCommandStreamReceivers[deviceIndex]) {
+        return true;
+    }
+    std::unique_ptr<CommandStreamReceiver> commandStreamReceiver(createCommandStream(pHwInfo, *this));
+    if (!commandStreamReceiver) {
+        return false;
+    }
+    commandStreamReceiver->setDeviceIndex(deviceIndex);
+    this->blitterCommandStreamReceivers[deviceIndex] = std::move(commandStreamReceiver);
+    return true;
+}
 void ExecutionEnvironment::initializeMemoryManager(bool enable64KBpages, bool enableLocalMemory, uint32_t deviceIndex) {
     if (this->memoryManager) {
         return;
@@ -38,6 +38,7 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     void initAubCenter();
     void initGmm(const HardwareInfo *hwInfo);
     bool initializeCommandStreamReceiver(const HardwareInfo *pHwInfo, uint32_t deviceIndex);
+    bool initializeBlitterCommandStreamReceiver(const HardwareInfo *pHwInfo, uint32_t deviceIndex);
     void initializeMemoryManager(bool enable64KBpages, bool enableLocalMemory, uint32_t deviceIndex);
     void initSourceLevelDebugger(const HardwareInfo &hwInfo);
 
@@ -49,6 +50,7 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     std::unique_ptr<MemoryManager> memoryManager;
     std::unique_ptr<AubCenter> aubCenter;
     std::vector<std::unique_ptr<CommandStreamReceiver>> commandStreamReceivers;
+    std::vector<std::unique_ptr<CommandStreamReceiver>> blitterCommandStreamReceivers;
     std::unique_ptr<BuiltIns> builtins;
     std::unique_ptr<CompilerInterface> compilerInterface;
     std::unique_ptr<SourceLevelDebugger> sourceLevelDebugger;
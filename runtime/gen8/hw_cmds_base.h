@@ -19,6 +19,7 @@ namespace OCLRT {
 struct GEN8 {
 #include "runtime/gen8/hw_cmds_generated.h"
 #include "runtime/gen8/hw_cmds_generated_patched.h"
+#include "runtime/gen_common/hw_cmds_generated_blitter.h"
 };
 struct BDWFamily : public GEN8 {
     using PARSE = BdwParse;
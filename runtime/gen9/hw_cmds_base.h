@@ -18,6 +18,7 @@ namespace OCLRT {
 
 struct GEN9 {
 #include "runtime/gen9/hw_cmds_generated_patched.h"
+#include "runtime/gen_common/hw_cmds_generated_blitter.h"
 #include "runtime/gen9/hw_cmds_generated.h"
 };
 
@@ -7,6 +7,7 @@
 
 #include "runtime/accelerators/intel_accelerator.h"
 #include "runtime/command_queue/command_queue.h"
+#include "runtime/command_queue/command_template.h"
 #include "runtime/context/context.h"
 #include "runtime/device/device.h"
 #include "runtime/device_queue/device_queue.h"
@@ -47,6 +48,7 @@ void BaseObject<B>::operator delete(void *ptr, const std::nothrow_t &tag) noexce
 
 template class BaseObject<_cl_accelerator_intel>;
 template class BaseObject<_cl_command_queue>;
+template class BaseObject<_cl_command_template_intel>;
 template class BaseObject<_device_queue>;
 template class BaseObject<_cl_context>;
 template class BaseObject<_cl_device_id>;
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/command_stream/linear_stream.h"
+#include "runtime/helpers/kernel_commands.h"
+#include "runtime/memory_manager/graphics_allocation.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace OCLRT {
+struct BlitProperties {
+    GraphicsAllocation *srcAllocation = nullptr;
+    GraphicsAllocation *dstAllocation = nullptr;
+    size_t srcOffset = 0;
+    size_t dstOffset = 0;
+    uint64_t copySize = 0;
+
+    // blitter waits until value under this tag allocation reaches dependencyTaskCount
+    GraphicsAllocation *dependencyTagAllocation = nullptr;
+    uint32_t dependencyTaskCount = 0;
+};
+
+template <typename GfxFamily>
+struct BlitCommandsHelper {
+    using XY_SRC_COPY_BLT = typename GfxFamily::XY_SRC_COPY_BLT;
+    using MI_SEMAPHORE_WAIT = typename GfxFamily::MI_SEMAPHORE_WAIT;
+
+    // 8bpp blits operate on rectangles, pitch has to fit into signed 16 bits
+    static constexpr uint64_t maxBlitWidth = 0x4000;
+    static constexpr uint64_t maxBlitHeight = 0x4000;
+
+    static uint32_t getBlitCommandsCount(uint64_t copySize) {
+        uint32_t count = 0;
+        while (copySize != 0) {
+            auto width = std::min(copySize, maxBlitWidth);
+            auto height = std::min(copySize / width, maxBlitHeight);
+            copySize -= width * height;
+            count++;
+        }
+        return count;
+    }
+
+    static size_t estimateBlitCommandsSize(const BlitProperties &blitProperties) {
+        size_t size = getBlitCommandsCount(blitProperties.copySize) * sizeof(XY_SRC_COPY_BLT);
+        if (blitProperties.dependencyTagAllocation) {
+            size += sizeof(MI_SEMAPHORE_WAIT);
+        }
+        return size;
+    }
+
+    static void dispatchBlitCommandsForBuffer(const BlitProperties &blitProperties, LinearStream &linearStream) {
+        if (blitProperties.dependencyTagAllocation) {
+            KernelCommandsHelper<GfxFamily>::programMiSemaphoreWait(linearStream, blitProperties.dependencyTagAllocation->getGpuAddress(), blitProperties.dependencyTaskCount,
+                                                                    MI_SEMAPHORE_WAIT::COMPARE_OPERATION::COMPARE_OPERATION_SAD_GREATER_THAN_OR_EQUAL_SDD);
+        }
+
+        // getGpuAddress includes allocationOffset, so host ptr allocations starting mid-page are addressed from the host ptr
+        auto srcAddress = blitProperties.srcAllocation->getGpuAddress() + blitProperties.srcOffset;
+        auto dstAddress = blitProperties.dstAllocation->getGpuAddress() + blitProperties.dstOffset;
+
+        uint64_t offset = 0;
+        auto sizeToBlit = blitProperties.copySize;
+        while (sizeToBlit != 0) {
+            auto width = std::min(sizeToBlit, maxBlitWidth);
+            auto height = std::min(sizeToBlit / width, maxBlitHeight);
+
+            auto bltCmd = linearStream.getSpaceForCmd<XY_SRC_COPY_BLT>();
+            *bltCmd = XY_SRC_COPY_BLT::sInit();
+            bltCmd->setDestinationX2CoordinateRight(static_cast<uint32_t>(width));
+            bltCmd->setDestinationY2CoordinateBottom(static_cast<uint32_t>(height));
+            bltCmd->setDestinationPitch(static_cast<uint32_t>(width));
+            bltCmd->setSourcePitch(static_cast<uint32_t>(width));
+            bltCmd->setDestinationBaseAddress(dstAddress + offset);
+            bltCmd->setSourceBaseAddress(srcAddress + offset);
+
+            offset += width * height;
+            sizeToBlit -= width * height;
+        }
+    }
+};
+
+template <typename GfxFamily>
+constexpr uint64_t BlitCommandsHelper<GfxFamily>::maxBlitWidth;
+template <typename GfxFamily>
+constexpr uint64_t BlitCommandsHelper<GfxFamily>::maxBlitHeight;
+} // namespace OCLRT
@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace OCLRT {
+// Replicates pattern over dst by doubling already filled region,
+// so bulk of the work is done by (vectorized) memcpy instead of per-element loop
+inline void fillMemoryWithPattern(void *dst, size_t size, const void *pattern, size_t patternSize) {
+    auto dstBytes = reinterpret_cast<uint8_t *>(dst);
+    size_t filled = std::min(size, patternSize);
+    memcpy(dstBytes, pattern, filled);
+    while (filled < size) {
+        auto chunk = std::min(filled, size - filled);
+        memcpy(dstBytes + filled, dstBytes, chunk);
+        filled += chunk;
+    }
+}
+} // namespace OCLRT
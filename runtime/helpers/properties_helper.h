@@ -57,6 +57,7 @@ struct TransferProperties {
     void *ptr = nullptr;
     uint32_t mipLevel = 0;
     uint32_t mipPtrOffset = 0;
+    size_t patternSize = 0;
 };
 
 struct MapInfo {
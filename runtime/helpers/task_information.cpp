@@ -16,6 +16,7 @@
 #include "runtime/helpers/aligned_memory.h"
 #include "runtime/helpers/string.h"
 #include "runtime/helpers/task_information.h"
+#include "runtime/mem_obj/buffer.h"
 #include "runtime/mem_obj/mem_obj.h"
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/memory_manager/surface.h"
@@ -103,6 +104,7 @@ CommandComputeKernel::CommandComputeKernel(CommandQueue &commandQueue, std::uniq
 }
 
 CommandComputeKernel::~CommandComputeKernel() {
+    unpinAuxTranslationState();
     for (auto surface : surfaces) {
         delete surface;
     }
@@ -115,6 +117,7 @@ CommandComputeKernel::~CommandComputeKernel() {
 
 CompletionStamp &CommandComputeKernel::submit(uint32_t taskLevel, bool terminated) {
     if (terminated) {
+        unpinAuxTranslationState();
         return completionStamp;
     }
     auto &commandStreamReceiver = commandQueue.getDevice().getCommandStreamReceiver();
@@ -219,6 +222,8 @@ CompletionStamp &CommandComputeKernel::submit(uint32_t taskLevel, bool terminate
                                                       taskLevel,
                                                       dispatchFlags,
                                                       commandQueue.getDevice());
+    // translations of this command are ordered with later submissions now
+    unpinAuxTranslationState();
     commandQueue.waitUntilComplete(completionStamp.taskCount, completionStamp.flushStamp, false);
     if (printfHandler) {
         printfHandler.get()->printEnqueueOutput();
@@ -227,6 +232,21 @@ CompletionStamp &CommandComputeKernel::submit(uint32_t taskLevel, bool terminate
     return completionStamp;
 }
 
+void CommandComputeKernel::pinAuxTranslationState(const BuffersForAuxTranslation &compressedBuffers) {
+    for (auto &buffer : compressedBuffers) {
+        auto graphicsAllocation = buffer->getGraphicsAllocation();
+        graphicsAllocation->pinAuxTranslationState();
+        auxTranslationStatePins.push_back(graphicsAllocation);
+    }
+}
+
+void CommandComputeKernel::unpinAuxTranslationState() {
+    for (auto graphicsAllocation : auxTranslationStatePins) {
+        graphicsAllocation->unpinAuxTranslationState();
+    }
+    auxTranslationStatePins.clear();
+}
+
 void CommandComputeKernel::setTimestampPacketNode(TimestampPacketContainer &current, TimestampPacketContainer &previous) {
     currentTimestampPacketNodes = std::make_unique<TimestampPacketContainer>(commandQueue.getDevice().getMemoryManager());
     currentTimestampPacketNodes->assignAndIncrementNodesRefCounts(current);
@@ -13,12 +13,14 @@
 #include "runtime/helpers/hw_info.h"
 #include "runtime/helpers/properties_helper.h"
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
 namespace OCLRT {
 class CommandQueue;
 class CommandStreamReceiver;
+class GraphicsAllocation;
 class Kernel;
 class MemObj;
 class Surface;
@@ -42,8 +44,17 @@ class Command : public IFNode<Command> {
     virtual LinearStream *getCommandStream() {
         return nullptr;
     }
+    // blocking commands wait for completion inside submit and are never submitted on behalf of another thread
+    virtual bool isBlocking() const {
+        return false;
+    }
     HwTimeStamps *timestamp = nullptr;
     CompletionStamp completionStamp = {};
+
+    // submission arguments and state while the command waits on a command queue's ready-list
+    uint32_t readyTaskLevel = 0;
+    bool readyTerminated = false;
+    std::atomic<bool> submitted{false};
 };
 
 class CommandMapUnmap : public Command {
@@ -52,6 +63,9 @@ class CommandMapUnmap : public Command {
                     CommandStreamReceiver &csr, CommandQueue &cmdQ);
     ~CommandMapUnmap() override;
     CompletionStamp &submit(uint32_t taskLevel, bool terminated) override;
+    bool isBlocking() const override {
+        return true;
+    }
 
   private:
     MemObj &memObj;
@@ -97,8 +111,11 @@ class CommandComputeKernel : public Command {
 
     void setTimestampPacketNode(TimestampPacketContainer &current, TimestampPacketContainer &previous);
     void setEventsRequest(EventsRequest &eventsRequest) { this->eventsRequest = eventsRequest; }
+    void pinAuxTranslationState(const BuffersForAuxTranslation &compressedBuffers);
 
   private:
+    void unpinAuxTranslationState();
+
     CommandQueue &commandQueue;
     std::unique_ptr<KernelOperation> kernelOperation;
     std::vector<Surface *> surfaces;
@@ -112,6 +129,7 @@ class CommandComputeKernel : public Command {
     std::unique_ptr<TimestampPacketContainer> currentTimestampPacketNodes;
     std::unique_ptr<TimestampPacketContainer> previousTimestampPacketNodes;
     EventsRequest eventsRequest = {0, nullptr, nullptr};
+    std::vector<GraphicsAllocation *> auxTranslationStatePins;
 };
 
 class CommandMarker : public Command {
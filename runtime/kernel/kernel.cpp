@@ -781,6 +781,41 @@ uint32_t Kernel::getScratchSizeValueToProgramMediaVfeState(int scratchSize) {
 }
 
 cl_int Kernel::setArg(uint32_t argIndex, size_t argSize, const void *argVal) {
+    auto retVal = patchArg(argIndex, argSize, argVal);
+    if (retVal == CL_SUCCESS) {
+        resolveArgs();
+    }
+    return retVal;
+}
+
+cl_int Kernel::setArgs(uint32_t numArgs, const uint32_t *argIndices, const size_t *argSizes, const void *const *argValues) {
+    cl_int retVal = CL_SUCCESS;
+    bool argsPatched = false;
+    for (uint32_t i = 0; i < numArgs; i++) {
+        auto argIndex = argIndices[i];
+        if (argIndex >= getKernelInfo().kernelArgInfo.size()) {
+            retVal = CL_INVALID_ARG_INDEX;
+            break;
+        }
+        retVal = checkCorrectImageAccessQualifier(argIndex, argSizes[i], argValues[i]);
+        if (retVal != CL_SUCCESS) {
+            unsetArg(argIndex);
+            break;
+        }
+        retVal = patchArg(argIndex, argSizes[i], argValues[i]);
+        if (retVal != CL_SUCCESS) {
+            break;
+        }
+        argsPatched = true;
+    }
+    // image transformation depends on the whole argument set, resolve it once per batch
+    if (argsPatched) {
+        resolveArgs();
+    }
+    return retVal;
+}
+
+cl_int Kernel::patchArg(uint32_t argIndex, size_t argSize, const void *argVal) {
     cl_int retVal = CL_SUCCESS;
     bool updateExposedKernel = true;
     if (getKernelInfo().builtinDispatchBuilder != nullptr) {
@@ -798,7 +833,6 @@ cl_int Kernel::setArg(uint32_t argIndex, size_t argSize, const void *argVal) {
             patchedArgumentsNum++;
             kernelArguments[argIndex].isPatched = true;
         }
-        resolveArgs();
     }
     return retVal;
 }
@@ -896,6 +930,10 @@ void Kernel::storeKernelArg(uint32_t argIndex, kernelArgType argType, void *argO
     kernelArguments[argIndex].size = argSize;
     kernelArguments[argIndex].pSvmAlloc = argSvmAlloc;
     kernelArguments[argIndex].svmFlags = argSvmFlags;
+    if (kernelArguments[argIndex].isCompressedBuffer) {
+        kernelArguments[argIndex].isCompressedBuffer = false;
+        compressedBufferArgsCount--;
+    }
 }
 
 const void *Kernel::getKernelArg(uint32_t argIndex) const {
@@ -1100,6 +1138,11 @@ cl_int Kernel::setArgBuffer(uint32_t argIndex,
             usingSharedObjArgs = true;
         }
 
+        if (buffer->getGraphicsAllocation()->getAllocationType() == GraphicsAllocation::AllocationType::BUFFER_COMPRESSED) {
+            kernelArguments[argIndex].isCompressedBuffer = true;
+            compressedBufferArgsCount++;
+        }
+
         auto patchLocation = ptrOffset(getCrossThreadData(),
                                        kernelArgInfo.kernelArgPatchInfoVector[0].crossthreadOffset);
 
@@ -2122,4 +2165,24 @@ void Kernel::fillWithBuffersForAuxTranslation(BuffersForAuxTranslation &buffersF
         }
     }
 }
+
+void Kernel::fillWithResolvedBuffers(BuffersForAuxTranslation &resolvedBuffers) {
+    for (uint32_t i = 0; i < getKernelArgsNumber(); i++) {
+        if (BUFFER_OBJ == kernelArguments.at(i).type && kernelInfo.kernelArgInfo.at(i).pureStatefulBufferAccess) {
+            auto buffer = castToObject<Buffer>(getKernelArg(i));
+            if (buffer && buffer->getGraphicsAllocation()->getAllocationType() == GraphicsAllocation::AllocationType::BUFFER_COMPRESSED &&
+                buffer->getGraphicsAllocation()->getAuxTranslationState() == GraphicsAllocation::AuxTranslationState::Resolved) {
+                resolvedBuffers.insert(buffer);
+            }
+        }
+    }
+}
+
+void Kernel::fillWithCompressedBuffers(BuffersForAuxTranslation &compressedBuffers) {
+    for (uint32_t i = 0; i < getKernelArgsNumber(); i++) {
+        if (kernelArguments.at(i).isCompressedBuffer) {
+            compressedBuffers.insert(castToObject<Buffer>(getKernelArg(i)));
+        }
+    }
+}
 } // namespace OCLRT
@@ -57,6 +57,7 @@ class Kernel : public BaseObject<_cl_kernel> {
         GraphicsAllocation *pSvmAlloc;
         cl_mem_flags svmFlags;
         bool isPatched = false;
+        bool isCompressedBuffer = false;
     };
 
     typedef int32_t (Kernel::*KernelArgHandler)(uint32_t argIndex,
@@ -103,6 +104,7 @@ class Kernel : public BaseObject<_cl_kernel> {
     }
 
     bool isAuxTranslationRequired() const { return auxTranslationRequired; }
+    bool hasCompressedBufferArgs() const { return compressedBufferArgsCount > 0; }
 
     char *getCrossThreadData() const {
         return crossThreadData;
@@ -121,6 +123,7 @@ class Kernel : public BaseObject<_cl_kernel> {
 
     // API entry points
     cl_int setArg(uint32_t argIndex, size_t argSize, const void *argVal);
+    cl_int setArgs(uint32_t numArgs, const uint32_t *argIndices, const size_t *argSizes, const void *const *argValues);
     cl_int setArgSvm(uint32_t argIndex, size_t svmAllocSize, void *svmPtr, GraphicsAllocation *svmAlloc = nullptr, cl_mem_flags svmFlags = 0);
     cl_int setArgSvmAlloc(uint32_t argIndex, void *svmPtr, GraphicsAllocation *svmAlloc);
 
@@ -372,6 +375,9 @@ class Kernel : public BaseObject<_cl_kernel> {
     }
 
     void fillWithBuffersForAuxTranslation(BuffersForAuxTranslation &buffersForAuxTranslation);
+    // compressed buffers accessed in aux mode while their contents are left in non-aux layout by previous kernels
+    void fillWithResolvedBuffers(BuffersForAuxTranslation &resolvedBuffers);
+    void fillWithCompressedBuffers(BuffersForAuxTranslation &compressedBuffers);
 
   protected:
     struct ObjectCounts {
@@ -456,6 +462,8 @@ class Kernel : public BaseObject<_cl_kernel> {
 
     void patchBlocksCurbeWithConstantValues();
 
+    // Patches a single argument without resolving the whole argument set
+    cl_int patchArg(uint32_t argIndex, size_t argSize, const void *argVal);
     void resolveArgs();
 
     void reconfigureKernel();
@@ -485,6 +493,7 @@ class Kernel : public BaseObject<_cl_kernel> {
     bool usingSharedObjArgs;
     bool usingImagesOnly = false;
     bool auxTranslationRequired = false;
+    uint32_t compressedBufferArgsCount = 0;
     uint32_t patchedArgumentsNum = 0;
     uint32_t startOffset = 0;
 
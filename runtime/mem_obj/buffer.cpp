@@ -20,6 +20,7 @@
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/memory_manager/svm_memory_manager.h"
 #include "runtime/os_interface/debug_settings_manager.h"
+#include "public/cl_ext_private.h"
 
 namespace OCLRT {
 
@@ -278,7 +279,9 @@ void Buffer::checkMemory(cl_mem_flags flags,
 
 GraphicsAllocation::AllocationType Buffer::getGraphicsAllocationType(cl_mem_flags flags, bool sharedContext, bool renderCompressedBuffers) {
     GraphicsAllocation::AllocationType type = GraphicsAllocation::AllocationType::BUFFER;
-    if (renderCompressedBuffers) {
+    if (flags & CL_MEM_READ_ONLY_HOST_PTR_INTEL) {
+        type = GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY;
+    } else if (renderCompressedBuffers) {
         type = GraphicsAllocation::AllocationType::BUFFER_COMPRESSED;
     } else if ((flags & CL_MEM_USE_HOST_PTR) || (flags & CL_MEM_ALLOC_HOST_PTR)) {
         type = GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY;
@@ -393,6 +396,17 @@ bool Buffer::isReadWriteOnCpuAllowed(cl_bool blocking, cl_uint numEventsInWaitLi
            MemoryPool::isSystemMemoryPool(graphicsAllocation->getMemoryPool());
 }
 
+bool Buffer::isFillOnCpuAllowed(cl_uint numEventsInWaitList, size_t size) {
+    return numEventsInWaitList == 0 && size != 0 && size <= maxBufferSizeForFillOnCpu && isFillOnCpuPossible();
+}
+
+bool Buffer::isFillOnCpuPossible() {
+    return !forceDisallowCPUCopy && graphicsAllocation->peekSharedHandle() == 0 && isMemObjZeroCopy() &&
+           !graphicsAllocation->isReadOnlyHostMemory() &&
+           !(graphicsAllocation->gmm && graphicsAllocation->gmm->isRenderCompressed) &&
+           MemoryPool::isSystemMemoryPool(graphicsAllocation->getMemoryPool());
+}
+
 Buffer *Buffer::createBufferHw(Context *context,
                                cl_mem_flags flags,
                                size_t size,
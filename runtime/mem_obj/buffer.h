@@ -35,6 +35,7 @@ extern BufferFuncs bufferFactory[IGFX_MAX_CORE];
 class Buffer : public MemObj {
   public:
     const static size_t maxBufferSizeForReadWriteOnCpu = 10 * MB;
+    const static size_t maxBufferSizeForFillOnCpu = 4 * KB;
     const static cl_ulong maskMagic = 0xFFFFFFFFFFFFFFFFLL;
     static const cl_ulong objectMagic = MemObj::objectMagic | 0x02;
     bool forceDisallowCPUCopy = false;
@@ -101,6 +102,8 @@ class Buffer : public MemObj {
     void transferDataFromHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) override;
 
     bool isReadWriteOnCpuAllowed(cl_bool blocking, cl_uint numEventsInWaitList, void *ptr, size_t size);
+    bool isFillOnCpuAllowed(cl_uint numEventsInWaitList, size_t size);
+    bool isFillOnCpuPossible();
 
   protected:
     Buffer(Context *context,
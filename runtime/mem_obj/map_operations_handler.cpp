@@ -11,12 +11,12 @@
 using namespace OCLRT;
 
 size_t MapOperationsHandler::size() const {
-    std::lock_guard<std::mutex> lock(mtx);
+    std::shared_lock<std::shared_timed_mutex> lock(mtx);
     return mappedPointers.size();
 }
 
 bool MapOperationsHandler::add(void *ptr, size_t ptrLength, cl_map_flags &mapFlags, MemObjSizeArray &size, MemObjOffsetArray &offset, uint32_t mipLevel) {
-    std::lock_guard<std::mutex> lock(mtx);
+    std::unique_lock<std::shared_timed_mutex> lock(mtx);
     MapInfo mapInfo(ptr, ptrLength, size, offset, mipLevel);
     mapInfo.readOnly = (mapFlags == CL_MAP_READ);
 
@@ -24,50 +24,75 @@ bool MapOperationsHandler::add(void *ptr, size_t ptrLength, cl_map_flags &mapFla
         return false;
     }
 
-    mappedPointers.push_back(mapInfo);
+    mappedPointers.emplace(ptr, mapInfo);
+    updateMappedRanges(mapInfo, true);
     return true;
 }
 
 bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
-    if (inputMapInfo.readOnly) {
+    if (inputMapInfo.readOnly || mappedRanges.empty()) {
         return false;
     }
     auto inputStartPtr = inputMapInfo.ptr;
     auto inputEndPtr = ptrOffset(inputStartPtr, inputMapInfo.ptrLength);
 
-    for (auto &mapInfo : mappedPointers) {
-        auto mappedStartPtr = mapInfo.ptr;
-        auto mappedEndPtr = ptrOffset(mappedStartPtr, mapInfo.ptrLength);
+    // Requested ptr starts inside existing ptr range
+    auto nextRange = mappedRanges.upper_bound(inputStartPtr);
+    if (nextRange != mappedRanges.begin() && std::prev(nextRange)->second > 0) {
+        return true;
+    }
+    // Requested ptr starts before existing ptr range and overlapping its start
+    return nextRange != mappedRanges.end() && nextRange->first <= inputEndPtr && nextRange->second > 0;
+}
 
-        // Requested ptr starts before or inside existing ptr range and overlapping end
-        if (inputStartPtr < mappedEndPtr && inputEndPtr >= mappedStartPtr) {
-            return true;
+std::map<const void *, uint32_t>::iterator MapOperationsHandler::splitMappedRanges(const void *ptr) {
+    auto nextRange = mappedRanges.upper_bound(ptr);
+    if (nextRange != mappedRanges.begin()) {
+        auto range = std::prev(nextRange);
+        if (range->first == ptr) {
+            return range;
         }
+        return mappedRanges.emplace_hint(nextRange, ptr, range->second);
+    }
+    return mappedRanges.emplace_hint(nextRange, ptr, 0u);
+}
+
+void MapOperationsHandler::updateMappedRanges(const MapInfo &mapInfo, bool mapped) {
+    if (mapInfo.ptrLength == 0) {
+        return;
+    }
+    auto startRange = splitMappedRanges(mapInfo.ptr);
+    auto endRange = splitMappedRanges(ptrOffset(mapInfo.ptr, mapInfo.ptrLength));
+    for (auto range = startRange; range != endRange; range++) {
+        range->second = mapped ? range->second + 1 : range->second - 1;
+    }
+
+    // Merge boundaries that no longer separate different counts
+    if (std::prev(endRange)->second == endRange->second) {
+        mappedRanges.erase(endRange);
+    }
+    if (startRange == mappedRanges.begin() ? startRange->second == 0 : std::prev(startRange)->second == startRange->second) {
+        mappedRanges.erase(startRange);
     }
-    return false;
 }
 
 bool MapOperationsHandler::find(void *mappedPtr, MapInfo &outMapInfo) {
-    std::lock_guard<std::mutex> lock(mtx);
+    std::shared_lock<std::shared_timed_mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        if (mapInfo.ptr == mappedPtr) {
-            outMapInfo = mapInfo;
-            return true;
-        }
+    auto it = mappedPointers.lower_bound(mappedPtr);
+    if (it == mappedPointers.end() || it->first != mappedPtr) {
+        return false;
     }
-    return false;
+    outMapInfo = it->second;
+    return true;
 }
 
 void MapOperationsHandler::remove(void *mappedPtr) {
-    std::lock_guard<std::mutex> lock(mtx);
+    std::unique_lock<std::shared_timed_mutex> lock(mtx);
 
-    auto endIter = mappedPointers.end();
-    for (auto it = mappedPointers.begin(); it != endIter; it++) {
-        if (it->ptr == mappedPtr) {
-            std::iter_swap(it, mappedPointers.end() - 1);
-            mappedPointers.pop_back();
-            break;
-        }
+    auto it = mappedPointers.lower_bound(mappedPtr);
+    if (it != mappedPointers.end() && it->first == mappedPtr) {
+        updateMappedRanges(it->second, false);
+        mappedPointers.erase(it);
     }
 }
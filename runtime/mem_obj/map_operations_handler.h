@@ -8,8 +8,9 @@
 #pragma once
 #include "runtime/helpers/properties_helper.h"
 
-#include <vector>
+#include <map>
 #include <mutex>
+#include <shared_mutex>
 
 namespace OCLRT {
 
@@ -24,8 +25,15 @@ class MapOperationsHandler {
 
   protected:
     bool isOverlapping(MapInfo &inputMapInfo);
-    std::vector<MapInfo> mappedPointers;
-    mutable std::mutex mtx;
+    void updateMappedRanges(const MapInfo &mapInfo, bool mapped);
+    std::map<const void *, uint32_t>::iterator splitMappedRanges(const void *ptr);
+
+    std::multimap<const void *, MapInfo> mappedPointers;
+    // Number of mappings covering the range from each key up to the next one.
+    // Adjacent ranges never share a count, so an unmapped range is always followed by a mapped one
+    // and overlap checks only need the range containing the requested start and its successor.
+    std::map<const void *, uint32_t> mappedRanges;
+    mutable std::shared_timed_mutex mtx;
 };
 
 } // namespace OCLRT
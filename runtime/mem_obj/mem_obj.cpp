@@ -15,6 +15,7 @@
 #include "runtime/helpers/aligned_memory.h"
 #include "runtime/helpers/get_info.h"
 #include "runtime/command_stream/command_stream_receiver.h"
+#include "public/cl_ext_private.h"
 #include <algorithm>
 
 namespace OCLRT {
@@ -66,6 +67,7 @@ MemObj::~MemObj() {
             if (needWait && graphicsAllocation->taskCount != ObjectNotUsed) {
                 waitForCsrCompletion();
             }
+            waitForBlitterCompletion();
             destroyGraphicsAllocation(graphicsAllocation, doAsyncDestrucions);
             graphicsAllocation = nullptr;
         }
@@ -247,6 +249,16 @@ bool MemObj::writeMemObjFlagsInvalid() {
     return false;
 }
 
+bool MemObj::deviceWriteMemObjFlagsInvalid() {
+    // memory imported as read-only host ptr is not writable by GPU commands either, sub-buffers share its allocation
+    if ((this->getFlags() & CL_MEM_READ_ONLY_HOST_PTR_INTEL) ||
+        (graphicsAllocation && graphicsAllocation->isReadOnlyHostMemory())) {
+        return true;
+    }
+
+    return false;
+}
+
 bool MemObj::mapMemObjFlagsInvalid(cl_map_flags mapFlags) {
     if ((this->getFlags() & (CL_MEM_HOST_READ_ONLY | CL_MEM_HOST_NO_ACCESS) && (mapFlags & CL_MAP_WRITE)) ||
         (this->getFlags() & (CL_MEM_HOST_WRITE_ONLY | CL_MEM_HOST_NO_ACCESS) && (mapFlags & CL_MAP_READ))) {
@@ -292,6 +304,14 @@ void MemObj::waitForCsrCompletion() {
     }
 }
 
+void MemObj::waitForBlitterCompletion() {
+    if (graphicsAllocation == nullptr || graphicsAllocation->blitterTaskCount == 0 || executionEnvironment == nullptr ||
+        executionEnvironment->blitterCommandStreamReceivers.empty() || !executionEnvironment->blitterCommandStreamReceivers[0]) {
+        return;
+    }
+    executionEnvironment->blitterCommandStreamReceivers[0]->waitForCompletionWithTimeout(false, TimeoutControls::maxTimeout, graphicsAllocation->blitterTaskCount);
+}
+
 void MemObj::destroyGraphicsAllocation(GraphicsAllocation *allocation, bool asyncDestroy) {
     if (asyncDestroy && allocation->taskCount != ObjectNotUsed) {
         auto currentTag = *memoryManager->getCommandStreamReceiver(0)->getTagAddress();
@@ -82,6 +82,7 @@ class MemObj : public BaseObject<_cl_mem> {
     bool readMemObjFlagsInvalid();
     bool writeMemObjFlagsInvalid();
     bool mapMemObjFlagsInvalid(cl_map_flags mapFlags);
+    bool deviceWriteMemObjFlagsInvalid();
 
     virtual bool allowTiling() const { return false; }
 
@@ -98,6 +99,7 @@ class MemObj : public BaseObject<_cl_mem> {
     Context *getContext() const { return context; }
 
     void waitForCsrCompletion();
+    void waitForBlitterCompletion();
     void destroyGraphicsAllocation(GraphicsAllocation *allocation, bool asyncDestroy);
     bool checkIfMemoryTransferIsRequired(size_t offsetInMemObjest, size_t offsetInHostPtr, const void *ptr, cl_command_type cmdType);
     bool mappingOnCpuAllowed() const;
@@ -6,15 +6,18 @@
  */
 
 #include "runtime/mem_obj/mem_obj_helper.h"
+#include "public/cl_ext_private.h"
 
 namespace OCLRT {
 
 bool MemObjHelper::checkExtraMemFlagsForBuffer(cl_mem_flags flags) {
-    return false;
+    return flags == CL_MEM_READ_ONLY_HOST_PTR_INTEL;
 }
 
 AllocationFlags MemObjHelper::getAllocationFlags(cl_mem_flags flags, bool allocateMemory) {
-    return AllocationFlags(allocateMemory);
+    AllocationFlags allocationFlags(allocateMemory);
+    allocationFlags.flags.readOnlyHostPtr = !!(flags & CL_MEM_READ_ONLY_HOST_PTR_INTEL);
+    return allocationFlags;
 }
 
 DevicesBitfield MemObjHelper::getDevicesBitfield(cl_mem_flags flags) {
@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <vector>
@@ -47,6 +48,7 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
 
   public:
     uint32_t taskCount = ObjectNotUsed;
+    uint32_t blitterTaskCount = 0; // last blitter engine task accessing this allocation, 0 if never blitted
     OsHandleStorage fragmentsStorage;
     bool is32BitAllocation = false;
     uint64_t gpuBaseAddress = 0;
@@ -81,6 +83,12 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
         SHARED_RESOURCE,
     };
 
+    // layout of BUFFER_COMPRESSED contents, switched by aux translation built-in
+    enum class AuxTranslationState {
+        Compressed, // valid in aux mode
+        Resolved    // translated for non-aux access, aux view is stale until translated back
+    };
+
     virtual ~GraphicsAllocation() = default;
     GraphicsAllocation &operator=(const GraphicsAllocation &) = delete;
     GraphicsAllocation(const GraphicsAllocation &) = delete;
@@ -125,12 +133,23 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     void setAllocationType(AllocationType allocationType) { this->allocationType = allocationType; }
     AllocationType getAllocationType() const { return allocationType; }
 
+    // aux translation state is shared by all queues on the device, it is accessed only under command stream receiver ownership
+    void setAuxTranslationState(AuxTranslationState state) { auxTranslationState = state; }
+    AuxTranslationState getAuxTranslationState() const { return auxTranslationState; }
+    // blocked enqueues translate relative to the state seen at enqueue time, it can't change until they are submitted
+    void pinAuxTranslationState() { auxTranslationStatePins++; }
+    void unpinAuxTranslationState() { auxTranslationStatePins--; }
+    bool isAuxTranslationStatePinned() const { return auxTranslationStatePins > 0; }
+
     void setAubWritable(bool writable) { aubWritable = writable; }
     bool isAubWritable() const { return aubWritable; }
     void setAllocDumpable(bool dumpable) { allocDumpable = dumpable; }
     bool isAllocDumpable() const { return allocDumpable; }
     bool isMemObjectsAllocationWithWritableFlags() const { return memObjectsAllocationWithWritableFlags; }
     void setMemObjectsAllocationWithWritableFlags(bool newValue) { memObjectsAllocationWithWritableFlags = newValue; }
+    // wraps host memory imported as read-only, nothing may write through it
+    void setReadOnlyHostMemory(bool readOnly) { readOnlyHostMemory = readOnly; }
+    bool isReadOnlyHostMemory() const { return readOnlyHostMemory; }
 
     bool isL3Capable();
     void setEvictable(bool evictable) { this->evictable = evictable; }
@@ -152,8 +171,11 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     friend class SubmissionAggregator;
     uint32_t inspectionId = 0;
     AllocationType allocationType = AllocationType::UNKNOWN;
+    AuxTranslationState auxTranslationState = AuxTranslationState::Compressed;
+    std::atomic<uint32_t> auxTranslationStatePins{0};
     bool aubWritable = true;
     bool allocDumpable = false;
     bool memObjectsAllocationWithWritableFlags = false;
+    bool readOnlyHostMemory = false;
 };
 } // namespace OCLRT
@@ -20,6 +20,7 @@
 #include "runtime/os_interface/os_context.h"
 #include "runtime/utilities/stackvec.h"
 #include "runtime/utilities/tag_allocator.h"
+#include "runtime/utilities/telemetry.h"
 
 #include <algorithm>
 
@@ -60,7 +61,9 @@ GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *,
 MemoryManager::MemoryManager(bool enable64kbpages, bool enableLocalMemory,
                              ExecutionEnvironment &executionEnvironment) : allocator32Bit(nullptr), enable64kbpages(enable64kbpages),
                                                                            localMemorySupported(enableLocalMemory),
-                                                                           executionEnvironment(executionEnvironment){};
+                                                                           executionEnvironment(executionEnvironment) {
+    scratchSpaceManager = std::make_unique<ScratchSpaceManager>(*this);
+}
 
 MemoryManager::~MemoryManager() {
     for (auto osContext : registeredOsContexts) {
@@ -166,6 +169,7 @@ void MemoryManager::setForce32BitAllocations(bool newValue) {
 }
 
 void MemoryManager::applyCommonCleanup() {
+    scratchSpaceManager->cleanUpResources();
     if (this->paddingAllocation) {
         this->freeGraphicsMemory(this->paddingAllocation);
     }
@@ -303,6 +307,7 @@ bool MemoryManager::getAllocationData(AllocationData &allocationData, const Allo
     allocationData.flags.forcePin = forcePin;
     allocationData.flags.uncacheable = uncacheable;
     allocationData.flags.flushL3 = flags.flags.flushL3RequiredForRead | flags.flags.flushL3RequiredForWrite;
+    allocationData.flags.readOnlyHostPtr = flags.flags.readOnlyHostPtr;
 
     if (allocationData.flags.mustBeZeroCopy) {
         allocationData.flags.useSystemMemory = true;
@@ -315,11 +320,13 @@ bool MemoryManager::getAllocationData(AllocationData &allocationData, const Allo
 
     if (allocationData.flags.allocateMemory) {
         allocationData.hostPtr = nullptr;
+        allocationData.flags.readOnlyHostPtr = false;
     }
     return true;
 }
 
 GraphicsAllocation *MemoryManager::allocateGraphicsMemoryInPreferredPool(AllocationFlags flags, DevicesBitfield devicesBitfield, const void *hostPtr, size_t size, GraphicsAllocation::AllocationType type) {
+    TelemetryScope telemetryScope(TelemetryCounter::Allocation);
     AllocationData allocationData;
     AllocationStatus status = AllocationStatus::Error;
 
@@ -335,6 +342,26 @@ GraphicsAllocation *MemoryManager::allocateGraphicsMemoryInPreferredPool(Allocat
 }
 
 GraphicsAllocation *MemoryManager::allocateGraphicsMemory(const AllocationData &allocationData) {
+    if (allocationData.flags.readOnlyHostPtr) {
+        // host pages are mapped at their own address, 32-bit GPU addressing requires a copy instead
+        if (force32bitAllocations && allocationData.flags.allow32Bit && is64bit) {
+            return nullptr;
+        }
+        // pages already wrapped by another allocation can't get second userptr object, contents are copied then
+        OverlapStatus overlapStatus;
+        hostPtrManager.getFragmentAndCheckForOverlaps(alignDown(allocationData.hostPtr, MemoryConstants::pageSize),
+                                                      alignSizeWholePage(allocationData.hostPtr, allocationData.size), overlapStatus);
+        if (overlapStatus != OverlapStatus::FRAGMENT_NOT_OVERLAPING_WITH_ANY_OTHER) {
+            return nullptr;
+        }
+        auto allocation = allocateGraphicsMemoryForReadOnlyHostPtr(allocationData.size, allocationData.hostPtr);
+        if (allocation) {
+            allocation->setReadOnlyHostMemory(true);
+            // later host ptr allocations within imported pages reuse it, overlapping imports are copied
+            addAllocationToHostPtrManager(allocation);
+        }
+        return allocation;
+    }
     if (force32bitAllocations && allocationData.flags.allow32Bit && is64bit) {
         return allocate32BitGraphicsMemory(allocationData.size, allocationData.hostPtr, AllocationOrigin::EXTERNAL_ALLOCATION);
     }
@@ -10,6 +10,7 @@
 #include "runtime/memory_manager/graphics_allocation.h"
 #include "runtime/memory_manager/host_ptr_defines.h"
 #include "runtime/memory_manager/host_ptr_manager.h"
+#include "runtime/memory_manager/scratch_space_manager.h"
 #include "runtime/os_interface/32bit_memory.h"
 
 #include <cstdint>
@@ -55,7 +56,8 @@ struct AllocationFlags {
             uint32_t allocateMemory : 1;
             uint32_t flushL3RequiredForRead : 1;
             uint32_t flushL3RequiredForWrite : 1;
-            uint32_t reserved : 29;
+            uint32_t readOnlyHostPtr : 1;
+            uint32_t reserved : 28;
         } flags;
         uint32_t allFlags;
     };
@@ -87,7 +89,8 @@ struct AllocationData {
             uint32_t forcePin : 1;
             uint32_t uncacheable : 1;
             uint32_t flushL3 : 1;
-            uint32_t reserved : 24;
+            uint32_t readOnlyHostPtr : 1;
+            uint32_t reserved : 23;
         } flags;
         uint32_t allFlags = 0;
     };
@@ -133,6 +136,8 @@ class MemoryManager {
 
     virtual GraphicsAllocation *allocateGraphicsMemory64kb(size_t size, size_t alignment, bool forcePin, bool preferRenderCompressed) = 0;
     virtual GraphicsAllocation *allocateGraphicsMemoryForNonSvmHostPtr(size_t size, void *cpuPtr) = 0;
+    // wraps host memory the GPU may only read, without tracking it in host ptr manager; nullptr when not supported
+    virtual GraphicsAllocation *allocateGraphicsMemoryForReadOnlyHostPtr(size_t size, const void *ptr) { return nullptr; }
 
     virtual GraphicsAllocation *allocateGraphicsMemory(size_t size, const void *ptr) {
         return MemoryManager::allocateGraphicsMemory(size, ptr, false);
@@ -210,6 +215,7 @@ class MemoryManager {
     TagAllocator<HwTimeStamps> *getEventTsAllocator();
     TagAllocator<HwPerfCounter> *getEventPerfCountAllocator();
     TagAllocator<TimestampPacket> *getTimestampPacketAllocator();
+    ScratchSpaceManager *getScratchSpaceManager() const { return scratchSpaceManager.get(); }
 
     MOCKABLE_VIRTUAL std::unique_ptr<GraphicsAllocation> obtainReusableAllocation(size_t requiredSize, bool isInternalAllocationRequired);
 
@@ -260,6 +266,7 @@ class MemoryManager {
     std::unique_ptr<TagAllocator<HwTimeStamps>> profilingTimeStampAllocator;
     std::unique_ptr<TagAllocator<HwPerfCounter>> perfCounterAllocator;
     std::unique_ptr<TagAllocator<TimestampPacket>> timestampPacketAllocator;
+    std::unique_ptr<ScratchSpaceManager> scratchSpaceManager;
     bool force32bitAllocations = false;
     bool virtualPaddingAvailable = false;
     GraphicsAllocation *paddingAllocation = nullptr;
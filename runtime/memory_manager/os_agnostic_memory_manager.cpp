@@ -118,8 +118,8 @@ GraphicsAllocation *OsAgnosticMemoryManager::createGraphicsAllocationFromSharedH
 void OsAgnosticMemoryManager::addAllocationToHostPtrManager(GraphicsAllocation *gfxAllocation) {
     FragmentStorage fragment = {};
     fragment.driverAllocation = true;
-    fragment.fragmentCpuPointer = gfxAllocation->getUnderlyingBuffer();
-    fragment.fragmentSize = alignUp(gfxAllocation->getUnderlyingBufferSize(), MemoryConstants::pageSize);
+    fragment.fragmentCpuPointer = alignDown(gfxAllocation->getUnderlyingBuffer(), MemoryConstants::pageSize);
+    fragment.fragmentSize = alignSizeWholePage(gfxAllocation->getUnderlyingBuffer(), gfxAllocation->getUnderlyingBufferSize());
     fragment.osInternalStorage = new OsHandle();
     fragment.residency = new ResidencyData();
     hostPtrManager.storeFragment(fragment);
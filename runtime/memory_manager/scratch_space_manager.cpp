@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/memory_manager/scratch_space_manager.h"
+#include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/debug_helpers.h"
+#include "runtime/memory_manager/memory_manager.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+
+#include <algorithm>
+
+namespace OCLRT {
+constexpr size_t ScratchSpaceManager::minSizeClass;
+constexpr size_t ScratchSpaceManager::subclassesCount;
+
+ScratchSpaceManager::ScratchSpaceManager(MemoryManager &memoryManager) : memoryManager(memoryManager),
+                                                                         idleTime(DebugManager.flags.ScratchSpaceIdleTimeMs.get()) {}
+
+ScratchSpaceManager::~ScratchSpaceManager() {
+    DEBUG_BREAK_IF(!pool.empty());
+}
+
+size_t ScratchSpaceManager::getSizeClass(size_t requiredSize) {
+    if (requiredSize <= minSizeClass) {
+        return minSizeClass;
+    }
+    size_t powerOfTwoRange = minSizeClass;
+    while (powerOfTwoRange <= requiredSize / 2) {
+        powerOfTwoRange *= 2;
+    }
+    return alignUp(requiredSize, powerOfTwoRange / subclassesCount);
+}
+
+GraphicsAllocation *ScratchSpaceManager::obtainScratchSpace(size_t requiredSize) {
+    auto sizeClass = getSizeClass(requiredSize);
+    auto force32BitAllocations = memoryManager.peekForce32BitAllocations();
+
+    std::unique_lock<std::mutex> lock(mtx);
+    trimIdleLocked(Clock::now());
+
+    // don't hand out scratch much bigger than needed, it would be held by receiver for its whole life
+    auto bestFit = pool.end();
+    for (auto it = pool.begin(); it != pool.end(); it++) {
+        auto size = it->allocation->getUnderlyingBufferSize();
+        if (size < requiredSize || size > 2 * sizeClass || it->allocation->is32BitAllocation != force32BitAllocations || !isCompleted(*it)) {
+            continue;
+        }
+        if (bestFit == pool.end() || size < bestFit->allocation->getUnderlyingBufferSize()) {
+            bestFit = it;
+        }
+    }
+
+    if (bestFit != pool.end()) {
+        auto allocation = bestFit->allocation;
+        pool.erase(bestFit);
+        statistics.pooledSize -= allocation->getUnderlyingBufferSize();
+        statistics.usedSize += allocation->getUnderlyingBufferSize();
+        statistics.reusesCount++;
+        return allocation;
+    }
+    lock.unlock();
+
+    auto allocation = memoryManager.allocateGraphicsMemoryInPreferredPool(AllocationFlags(true), 0, nullptr, sizeClass, GraphicsAllocation::AllocationType::SCRATCH_SURFACE);
+    if (allocation) {
+        lock.lock();
+        statistics.usedSize += allocation->getUnderlyingBufferSize();
+        statistics.peakSize = std::max(statistics.peakSize, statistics.usedSize + statistics.pooledSize);
+        statistics.allocationsCount++;
+    }
+    return allocation;
+}
+
+void ScratchSpaceManager::releaseScratchSpace(GraphicsAllocation *allocation, volatile uint32_t *completionTag, uint32_t taskCount) {
+    if (!allocation) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    PooledScratch scratch;
+    scratch.allocation = allocation;
+    scratch.completionTag = completionTag;
+    scratch.taskCount = taskCount;
+    scratch.releaseTime = Clock::now();
+    pool.push_back(scratch);
+
+    statistics.usedSize -= allocation->getUnderlyingBufferSize();
+    statistics.pooledSize += allocation->getUnderlyingBufferSize();
+    trimIdleLocked(scratch.releaseTime);
+}
+
+void ScratchSpaceManager::releaseCompletionTag(volatile uint32_t *completionTag) {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &scratch : pool) {
+        if (scratch.completionTag == completionTag) {
+            scratch.completionTag = nullptr;
+        }
+    }
+}
+
+void ScratchSpaceManager::trimIdle(Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(mtx);
+    trimIdleLocked(now);
+}
+
+void ScratchSpaceManager::trimIdleLocked(Clock::time_point now) {
+    if (idleTime.count() < 0) {
+        return;
+    }
+    auto it = pool.begin();
+    while (it != pool.end()) {
+        if (now - it->releaseTime >= idleTime && isCompleted(*it)) {
+            statistics.pooledSize -= it->allocation->getUnderlyingBufferSize();
+            statistics.trimsCount++;
+            memoryManager.freeGraphicsMemory(it->allocation);
+            it = pool.erase(it);
+        } else {
+            it++;
+        }
+    }
+}
+
+void ScratchSpaceManager::cleanUpResources() {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &scratch : pool) {
+        DEBUG_BREAK_IF(!isCompleted(scratch));
+        statistics.pooledSize -= scratch.allocation->getUnderlyingBufferSize();
+        memoryManager.freeGraphicsMemory(scratch.allocation);
+    }
+    pool.clear();
+}
+
+ScratchSpaceStatistics ScratchSpaceManager::getStatistics() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return statistics;
+}
+} // namespace OCLRT
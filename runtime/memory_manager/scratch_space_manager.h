@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/memory_manager/memory_constants.h"
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace OCLRT {
+class GraphicsAllocation;
+class MemoryManager;
+
+struct ScratchSpaceStatistics {
+    uint64_t usedSize = 0;   // held by command stream receivers
+    uint64_t pooledSize = 0; // released, waiting for reuse or trim
+    uint64_t peakSize = 0;   // highest used + pooled size so far
+    uint64_t allocationsCount = 0;
+    uint64_t reusesCount = 0;
+    uint64_t trimsCount = 0;
+};
+
+// Scratch space shared by all command stream receivers of memory manager. Scratch is allocated in size classes,
+// so growing requirements don't reallocate on every step. Scratch released by one command stream receiver is
+// reused by any other once GPU finished work using it and is freed after staying unused for ScratchSpaceIdleTimeMs.
+class ScratchSpaceManager {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t minSizeClass = MemoryConstants::pageSize64k;
+    // every power of two range is split into that many classes, so rounding wastes at most 25%
+    static constexpr size_t subclassesCount = 4;
+
+    ScratchSpaceManager(MemoryManager &memoryManager);
+    ~ScratchSpaceManager();
+
+    static size_t getSizeClass(size_t requiredSize);
+
+    GraphicsAllocation *obtainScratchSpace(size_t requiredSize);
+    // GPU is done with released scratch when completionTag reaches taskCount, nullptr tag means it is already done
+    void releaseScratchSpace(GraphicsAllocation *allocation, volatile uint32_t *completionTag, uint32_t taskCount);
+    // called by command stream receiver going away, after all its work completed
+    void releaseCompletionTag(volatile uint32_t *completionTag);
+
+    void trimIdle() { trimIdle(Clock::now()); }
+    void trimIdle(Clock::time_point now);
+    void cleanUpResources();
+
+    ScratchSpaceStatistics getStatistics();
+
+  protected:
+    struct PooledScratch {
+        GraphicsAllocation *allocation = nullptr;
+        volatile uint32_t *completionTag = nullptr;
+        uint32_t taskCount = 0;
+        Clock::time_point releaseTime;
+    };
+
+    static bool isCompleted(const PooledScratch &scratch) {
+        return scratch.completionTag == nullptr || *scratch.completionTag >= scratch.taskCount;
+    }
+    void trimIdleLocked(Clock::time_point now);
+
+    MemoryManager &memoryManager;
+    std::mutex mtx;
+    std::vector<PooledScratch> pool;
+    std::chrono::milliseconds idleTime;
+    ScratchSpaceStatistics statistics;
+};
+} // namespace OCLRT
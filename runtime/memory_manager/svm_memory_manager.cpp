@@ -25,6 +25,8 @@
 #include "runtime/helpers/aligned_memory.h"
 #include "runtime/command_stream/command_stream_receiver.h"
 
+#include <algorithm>
+
 namespace OCLRT {
 
 void SVMAllocsManager::MapBasedAllocationTracker::insert(GraphicsAllocation &ga) {
@@ -61,7 +63,45 @@ GraphicsAllocation *SVMAllocsManager::MapBasedAllocationTracker::get(const void
     return nullptr;
 }
 
+SVMAllocsManager::SortedAllocationsSnapshot::SortedAllocationsSnapshot(const MapBasedAllocationTracker &tracker) {
+    ranges.reserve(tracker.allocs.size());
+    for (auto &alloc : tracker.allocs) {
+        ranges.push_back({alloc.first, alloc.second->getUnderlyingBufferSize(), alloc.second});
+    }
+}
+
+GraphicsAllocation *SVMAllocsManager::SortedAllocationsSnapshot::get(const void *ptr) const {
+    if (ptr == nullptr) {
+        return nullptr;
+    }
+    auto next = std::upper_bound(ranges.begin(), ranges.end(), ptr,
+                                 [](const void *ptr, const Range &range) { return ptr < range.start; });
+    if (next == ranges.begin()) {
+        return nullptr;
+    }
+    auto &range = *(next - 1);
+    if (ptr < static_cast<const char *>(range.start) + range.size) {
+        return range.allocation;
+    }
+    return nullptr;
+}
+
 SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager) : memoryManager(memoryManager) {
+    publishSnapshot();
+}
+
+void SVMAllocsManager::publishSnapshot() {
+    if (currentSnapshot) {
+        retiredSnapshots.push_back(std::move(currentSnapshot));
+    }
+    currentSnapshot.reset(new SortedAllocationsSnapshot(SVMAllocs));
+    snapshot.store(currentSnapshot.get());
+
+    // Lookups that start after the store see the new snapshot, so retired ones are unreachable
+    // once no lookup is in flight
+    if (activeReaders.load() == 0) {
+        retiredSnapshots.clear();
+    }
 }
 
 void *SVMAllocsManager::createSVMAlloc(size_t size, bool coherent) {
@@ -74,20 +114,24 @@ void *SVMAllocsManager::createSVMAlloc(size_t size, bool coherent) {
         return nullptr;
     }
     this->SVMAllocs.insert(*GA);
+    publishSnapshot();
 
     return GA->getUnderlyingBuffer();
 }
 
 GraphicsAllocation *SVMAllocsManager::getSVMAlloc(const void *ptr) {
-    std::unique_lock<std::mutex> lock(mtx);
-    return SVMAllocs.get(ptr);
+    activeReaders.fetch_add(1);
+    auto allocation = snapshot.load()->get(ptr);
+    activeReaders.fetch_sub(1);
+    return allocation;
 }
 
 void SVMAllocsManager::freeSVMAlloc(void *ptr) {
-    GraphicsAllocation *GA = getSVMAlloc(ptr);
+    std::unique_lock<std::mutex> lock(mtx);
+    GraphicsAllocation *GA = SVMAllocs.get(ptr);
     if (GA) {
-        std::unique_lock<std::mutex> lock(mtx);
         SVMAllocs.remove(*GA);
+        publishSnapshot();
         memoryManager->freeGraphicsMemory(GA);
     }
 }
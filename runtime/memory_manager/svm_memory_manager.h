@@ -21,9 +21,12 @@
  */
 
 #pragma once
+#include <atomic>
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace OCLRT {
 class Device;
@@ -33,6 +36,8 @@ class MemoryManager;
 
 class SVMAllocsManager {
   public:
+    class SortedAllocationsSnapshot;
+
     class MapBasedAllocationTracker {
       public:
         void insert(GraphicsAllocation &);
@@ -41,9 +46,27 @@ class SVMAllocsManager {
         size_t getNumAllocs() const { return allocs.size(); };
 
       protected:
+        friend class SortedAllocationsSnapshot;
         std::map<const void *, GraphicsAllocation *> allocs;
     };
 
+    // Immutable copy of the tracked allocations sorted by address, republished on every
+    // create/free so lookups only need an atomic pointer load.
+    class SortedAllocationsSnapshot {
+      public:
+        struct Range {
+            const void *start;
+            size_t size;
+            GraphicsAllocation *allocation;
+        };
+
+        SortedAllocationsSnapshot(const MapBasedAllocationTracker &tracker);
+        GraphicsAllocation *get(const void *ptr) const;
+
+      protected:
+        std::vector<Range> ranges;
+    };
+
     SVMAllocsManager(MemoryManager *memoryManager);
     void *createSVMAlloc(size_t size, bool coherent = false);
     GraphicsAllocation *getSVMAlloc(const void *ptr);
@@ -51,8 +74,16 @@ class SVMAllocsManager {
     size_t getNumAllocs() const { return SVMAllocs.getNumAllocs(); }
 
   protected:
+    void publishSnapshot();
+
     MapBasedAllocationTracker SVMAllocs;
     MemoryManager *memoryManager;
     std::mutex mtx;
+
+    std::atomic<const SortedAllocationsSnapshot *> snapshot;
+    std::atomic<uint32_t> activeReaders{0};
+    // Replaced snapshots are kept until no lookup is in flight
+    std::unique_ptr<const SortedAllocationsSnapshot> currentSnapshot;
+    std::vector<std::unique_ptr<const SortedAllocationsSnapshot>> retiredSnapshots;
 };
 } // namespace OCLRT
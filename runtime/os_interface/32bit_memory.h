@@ -22,6 +22,7 @@
 
 #pragma once
 #include "runtime/utilities/heap_allocator.h"
+#include "runtime/utilities/va_arena_allocator.h"
 #include <stdint.h>
 #include <memory>
 
@@ -41,10 +42,12 @@ class Allocator32bit {
     uint64_t allocate(size_t &size);
     uintptr_t getBase();
     int free(uint64_t ptr, size_t size);
+    VaArenaAllocator *getVaArenaAllocator() const { return vaArenaAllocator.get(); }
 
   protected:
     std::unique_ptr<OsInternals> osInternals;
     std::unique_ptr<HeapAllocator> heapAllocator;
+    std::unique_ptr<VaArenaAllocator> vaArenaAllocator;
     uint64_t base = 0;
     uint64_t size = 0;
 };
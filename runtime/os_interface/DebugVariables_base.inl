@@ -34,6 +34,7 @@ DECLARE_DEBUG_VARIABLE(bool, FlushAllCaches, false, "pipe controls between enque
 DECLARE_DEBUG_VARIABLE(bool, MakeEachEnqueueBlocking, false, "equivalent of finish after each enqueue")
 DECLARE_DEBUG_VARIABLE(bool, DoCpuCopyOnReadBuffer, false, "triggers CPU copy path for Read Buffer calls, only supported for some basic use cases ( no events, not blocked calls )")
 DECLARE_DEBUG_VARIABLE(bool, DoCpuCopyOnWriteBuffer, false, "triggers CPU copy path for Write Buffer calls, only supported for some basic use cases ( no events, not blocked calls )")
+DECLARE_DEBUG_VARIABLE(int32_t, DoCpuFillOnFillBuffer, -1, "-1: default - CPU fill of small zero copy buffers on idle command queue, 0: disable, 1: force CPU fill of any zero copy buffer")
 DECLARE_DEBUG_VARIABLE(bool, DisableResourceRecycling, false, "when set to true disables resource recycling optimization")
 DECLARE_DEBUG_VARIABLE(bool, ForceDispatchScheduler, false, "dispatches scheduler kernel instead of kernel enqueued")
 DECLARE_DEBUG_VARIABLE(bool, TrackParentEvents, false, "events track their parents")
@@ -66,10 +67,21 @@ DECLARE_DEBUG_VARIABLE(bool, ForceCsrReprogramming, false, "Forces reprogramming
 DECLARE_DEBUG_VARIABLE(bool, DisableStatelessToStatefulOptimization, false, "Disables stateless to stateful optimization for buffers")
 DECLARE_DEBUG_VARIABLE(bool, DisableConcurrentBlockExecution, 0, "disables concurrent block kernel execution")
 DECLARE_DEBUG_VARIABLE(bool, UseNewHeapAllocator, true, "Custom 4GB heap allocator is used")
+DECLARE_DEBUG_VARIABLE(bool, UseVaArenaAllocator, false, "Linux only, custom 4GB heap keeps small and medium allocations in per size class 2MB slabs")
 DECLARE_DEBUG_VARIABLE(bool, UseNoRingFlushesKmdMode, true, "Windows only, passes flag to KMD that informs KMD to not emit any ring buffer flushes.")
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForUseHostPtr, false, "When active all buffer allocations created with CL_MEM_USE_HOST_PTR flag will not share memory with CPU.")
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForBuffers, false, "When active all buffer allocations will not share memory with CPU.")
 
+/*RELEASE FLAGS*/
+DECLARE_DEBUG_VARIABLE(bool, EnableTelemetry, false, "Enables hot path latency counters")
+DECLARE_DEBUG_VARIABLE(std::string, TelemetryDumpFile, std::string("unk"), "Name of file periodically overwritten with collected telemetry")
+DECLARE_DEBUG_VARIABLE(int32_t, TelemetryDumpIntervalMs, 1000, "Interval between telemetry dumps in milliseconds")
+DECLARE_DEBUG_VARIABLE(std::string, ChromeTraceFile, std::string("unk"), "Name of file to save Chrome trace of API calls, submissions and profiled GPU commands into")
+DECLARE_DEBUG_VARIABLE(int32_t, WorkerPoolThreadsCount, -1, "-1: default (up to 2), N: number of threads in worker pool shared by background runtime services")
+DECLARE_DEBUG_VARIABLE(std::string, BackgroundThreadsCpuList, std::string("unk"), "CPUs background runtime threads are pinned to in cpuset list format, e.g. 0-7,16-23")
+DECLARE_DEBUG_VARIABLE(int32_t, BackgroundThreadsNumaNode, -1, "-1: no pinning, N: pin background runtime threads to CPUs of NUMA node N when BackgroundThreadsCpuList is not set")
+DECLARE_DEBUG_VARIABLE(int32_t, BackgroundThreadsPriorityDecrease, 0, "0: default priority, N: lower priority of background runtime threads by N nice levels (below normal on Windows)")
+
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
 DECLARE_DEBUG_VARIABLE(bool, EnablePackedYuv, true, "Enables cl_packed_yuv extension")
@@ -78,6 +90,7 @@ DECLARE_DEBUG_VARIABLE(bool, EnableIntelAdvancedVme, true, "Enables cl_intel_adv
 DECLARE_DEBUG_VARIABLE(bool, EnableDeferredDeleter, true, "Enables async deleter")
 DECLARE_DEBUG_VARIABLE(bool, EnableAsyncDestroyAllocations, true, "Enables async destroying graphics allocations in mem obj destructor")
 DECLARE_DEBUG_VARIABLE(bool, EnableAsyncEventsHandler, true, "Enables async events handler")
+DECLARE_DEBUG_VARIABLE(bool, EnableAsyncPrintfOutput, false, "Enables printing kernel printf output from a background thread, enqueues using printf are no longer made blocking")
 DECLARE_DEBUG_VARIABLE(bool, EnableForcePin, true, "Enables early pinning for memory object")
 DECLARE_DEBUG_VARIABLE(bool, EnableComputeWorkSizeND, true, "Enables diffrent algorithm to compute local work size")
 DECLARE_DEBUG_VARIABLE(bool, EnableComputeWorkSizeSquared, false, "Enables algorithm to compute the most squared work group as possible")
@@ -88,6 +101,9 @@ DECLARE_DEBUG_VARIABLE(int32_t, EnableStatelessToStatefulBufferOffsetOpt, -1, "-
 DECLARE_DEBUG_VARIABLE(int32_t, CreateMultipleDevices, 0, "0: default - disable, 1+: Driver will create multiple (N) devices during initialization.")
 DECLARE_DEBUG_VARIABLE(int32_t, LimitAmountOfReturnedDevices, 0, "0: default - disable, 1+: Driver will limit the number of devices returned from clGetDeviceIds to N.")
 DECLARE_DEBUG_VARIABLE(int32_t, Enable64kbpages, -1, "-1: default behaviour, 0 Disables, 1 Enables support for 64KB pages for driver allocated fine grain svm buffers")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHugePages, -1, "Linux only, -1: default behaviour (transparent, only for allocations where rounding to 2MB wastes at most 1/8 of the size, not for the 32-bit heap), 0: disabled, 1: transparent 2MB pages (MADV_HUGEPAGE), 2: explicit 2MB pages (MAP_HUGETLB) falling back to transparent ones, 1 and 2 also advise the 32-bit heap")
+DECLARE_DEBUG_VARIABLE(int32_t, GemCloseWorkerMaxQueueDepth, 4096, "Linux only, 0: no limit, N: thread releasing memory waits while more than N buffer objects are pending in gem close worker")
+DECLARE_DEBUG_VARIABLE(int32_t, ScratchSpaceIdleTimeMs, 1000, "-1: never free, >=0: time in milliseconds after which scratch space not used by any command stream receiver is freed")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableKmdNotify, -1, "-1: dont override, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideKmdNotifyDelayMicroseconds, -1, "-1: dont override, 0: infinite timeout, >0: timeout in microseconds")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableQuickKmdSleep, -1, "-1: dont override, 0: disable, 1: enable. It works only when Kmd Notify is enabled.")
@@ -105,5 +121,6 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideThreadArbitrationPolicy, -1, "-1 (dont o
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideAubDeviceId, -1, "-1 dont override, any other: use this value for AUB generation device id")
 DECLARE_DEBUG_VARIABLE(bool, UseMaxSimdSizeToDeduceMaxWorkgroupSize, false, "With this flag on, max workgroup size is deduced using SIMD32 instead of SIMD8, this causes the max wkg size " "to be 4 times bigger")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableTimestampPacket, -1, "-1: default, 0: disable, 1:enable. Write Timestamp Packet for each set of gpu walkers")
+DECLARE_DEBUG_VARIABLE(bool, EnableBlitterOperationsForBuffers, false, "Offload buffer copies and blocking buffer transfers to blitter engine (Linux and AUB/TBX only)")
 DECLARE_DEBUG_VARIABLE(bool, ReturnRawGpuTimestamps, false, "Driver returns raw GPU tiemstamps instead of calculated ones.")
 // clang-format on
@@ -24,6 +24,7 @@ class Allocator32bit::OsInternals {
     uintptr_t lowerRangeAddress = lowerRangeStart;
     decltype(&mmap) mmapFunction = mmap;
     decltype(&munmap) munmapFunction = munmap;
+    decltype(&madvise) madviseFunction = madvise;
     void *heapBasePtr = (void *)0;
     size_t heapSize = 0;
 
@@ -82,7 +83,11 @@ bool OCLRT::is32BitOsAllocatorAvailable = true;
 Allocator32bit::Allocator32bit(uint64_t base, uint64_t size) {
     this->base = base;
     this->size = size;
-    heapAllocator = std::unique_ptr<HeapAllocator>(new HeapAllocator(base, size));
+    if (DebugManager.flags.UseVaArenaAllocator.get()) {
+        vaArenaAllocator = std::make_unique<VaArenaAllocator>(base, size);
+    } else {
+        heapAllocator = std::unique_ptr<HeapAllocator>(new HeapAllocator(base, size));
+    }
 }
 
 OCLRT::Allocator32bit::Allocator32bit() : Allocator32bit(new OsInternals) {
@@ -112,6 +117,10 @@ OCLRT::Allocator32bit::Allocator32bit(Allocator32bit::OsInternals *osInternalsIn
         if (ptr == MAP_FAILED) {
             ptr = nullptr;
             sizeToMap = 0;
+        } else if (DebugManager.flags.EnableHugePages.get() > 0) {
+            // the heap is mostly small allocations, so 2MB pages could waste more than the default 1/8 limit allows,
+            // they are used only on explicit request, reservation itself stays lazy
+            this->osInternals->madviseFunction(ptr, sizeToMap, MADV_HUGEPAGE);
         }
 
         osInternals->heapBasePtr = (void *)ptr;
@@ -119,13 +128,22 @@ OCLRT::Allocator32bit::Allocator32bit(Allocator32bit::OsInternals *osInternalsIn
         base = (uint64_t)ptr;
         size = sizeToMap;
 
-        heapAllocator = std::unique_ptr<HeapAllocator>(new HeapAllocator(base, sizeToMap));
+        if (DebugManager.flags.UseVaArenaAllocator.get()) {
+            vaArenaAllocator = std::make_unique<VaArenaAllocator>(base, sizeToMap);
+        } else {
+            heapAllocator = std::unique_ptr<HeapAllocator>(new HeapAllocator(base, sizeToMap));
+        }
     } else {
         this->osInternals->drmAllocator = new Allocator32bit::OsInternals::Drm32BitAllocator(*this->osInternals);
     }
 }
 
 OCLRT::Allocator32bit::~Allocator32bit() {
+    if (vaArenaAllocator) {
+        auto statistics = vaArenaAllocator->getStatistics();
+        DebugManager.log(DebugManager.flags.PrintDebugMessages.get(), __FUNCTION__, "Allocator heap fragmentation == ", statistics.getHeapFragmentation(),
+                         " slabs fragmentation == ", statistics.getSlabsFragmentation(), " slabs count == ", statistics.slabsCount, "\n");
+    }
     if (this->osInternals.get() != nullptr) {
         if (this->osInternals->heapBasePtr != (void *)0)
             this->osInternals->munmapFunction(this->osInternals->heapBasePtr, this->osInternals->heapSize);
@@ -138,7 +156,16 @@ OCLRT::Allocator32bit::~Allocator32bit() {
 uint64_t OCLRT::Allocator32bit::allocate(size_t &size) {
     uint64_t ptr = 0llu;
     if (DebugManager.flags.UseNewHeapAllocator.get()) {
-        ptr = this->heapAllocator->allocate(size);
+        if (vaArenaAllocator) {
+            ptr = vaArenaAllocator->allocate(size);
+            if (ptr == 0llu) {
+                auto statistics = vaArenaAllocator->getStatistics();
+                DebugManager.log(DebugManager.flags.PrintDebugMessages.get(), __FUNCTION__, "Allocator failed, free size == ", statistics.freeSize,
+                                 " largest free chunk == ", statistics.largestFreeChunkSize, "\n");
+            }
+        } else {
+            ptr = this->heapAllocator->allocate(size);
+        }
     } else {
         ptr = reinterpret_cast<uint64_t>(this->osInternals->drmAllocator->allocate(size));
     }
@@ -150,7 +177,11 @@ int Allocator32bit::free(uint64_t ptr, size_t size) {
         return 0;
 
     if (DebugManager.flags.UseNewHeapAllocator.get()) {
-        this->heapAllocator->free(ptr, size);
+        if (vaArenaAllocator) {
+            vaArenaAllocator->free(ptr, size);
+        } else {
+            this->heapAllocator->free(ptr, size);
+        }
     } else {
         return this->osInternals->drmAllocator->free(reinterpret_cast<void *>(ptr), size);
     }
@@ -130,7 +130,7 @@ void BufferObject::processRelocs(int &idx) {
 int BufferObject::exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, bool lowPriority) {
     drm_i915_gem_execbuffer2 execbuf = {};
 
-    int idx = 0;
+    int idx = static_cast<int>(prefilledExecObjectsCount);
     processRelocs(idx);
     this->fillExecObject(execObjectsStorage[idx]);
     idx++;
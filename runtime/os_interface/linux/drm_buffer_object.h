@@ -67,14 +67,22 @@ class BufferObject {
     void swapResidencyVector(ResidencyVector *residencyVect) {
         std::swap(this->residency, *residencyVect);
     }
-    void setExecObjectsStorage(drm_i915_gem_exec_object2 *storage) {
+    // storage may already hold exec objects of other resident BOs, these are submitted as they are
+    void setExecObjectsStorage(drm_i915_gem_exec_object2 *storage, size_t prefilledObjectsCount = 0) {
         execObjectsStorage = storage;
+        prefilledExecObjectsCount = prefilledObjectsCount;
     }
     ResidencyVector *getResidency() { return &residency; }
     StorageAllocatorType peekAllocationType() const { return storageAllocatorType; }
     void setAllocationType(StorageAllocatorType allocatorType) { this->storageAllocatorType = allocatorType; }
     bool peekIsResident() const { return isResident; }
     void setIsResident(bool isResident) { this->isResident = isResident; }
+    const void *peekResidencySetOwner() const { return residencySetOwner; }
+    size_t peekResidencySetIndex() const { return residencySetIndex; }
+    void setResidencySetPosition(const void *owner, size_t index) {
+        residencySetOwner = owner;
+        residencySetIndex = index;
+    }
 
   protected:
     bool isResident;
@@ -86,6 +94,11 @@ class BufferObject {
 
     ResidencyVector residency;
     drm_i915_gem_exec_object2 *execObjectsStorage;
+    size_t prefilledExecObjectsCount = 0;
+
+    // command stream receiver keeping this BO in its persistent residency set and BO's slot in that set
+    const void *residencySetOwner = nullptr;
+    size_t residencySetIndex = 0;
 
     int handle; // i915 gem object handle
     bool isSoftpin;
@@ -50,11 +50,24 @@ class DrmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
     }
 
   protected:
+    struct ResidencySetEntry {
+        BufferObject *bo;
+        uint64_t generation;
+    };
+
     void makeResident(BufferObject *bo);
+    void addToResidencySet(BufferObject *bo);
+    void removeStaleResidencySetEntries();
     void programVFEState(LinearStream &csr, DispatchFlags &dispatchFlags) override;
 
+    // BOs made resident for the next submission
     std::vector<BufferObject *> residency;
+
+    // BOs submitted recently, execObjectsStorage holds their exec objects in the same order.
+    // Entries not tagged with current generation are stale, their BOs may be already destroyed.
+    std::vector<ResidencySetEntry> residencySet;
     std::vector<drm_i915_gem_exec_object2> execObjectsStorage;
+    uint64_t residencyGeneration = 1;
     Drm *drm;
     gemCloseWorkerMode gemCloseWorkerOperationMode;
     bool mediaVfeStateLowPriorityDirty = true;
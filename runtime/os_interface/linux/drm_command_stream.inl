@@ -18,6 +18,7 @@
 #include "runtime/os_interface/linux/drm_memory_manager.h"
 #include "runtime/os_interface/linux/drm_neo.h"
 #include "runtime/os_interface/linux/os_interface.h"
+#include "runtime/utilities/telemetry.h"
 #include "runtime/platform/platform.h"
 #include <cstdlib>
 #include <cstring>
@@ -37,6 +38,7 @@ DrmCommandStreamReceiver<GfxFamily>::DrmCommandStreamReceiver(const HardwareInfo
                         : Drm::get(0);
     }
     residency.reserve(512);
+    residencySet.reserve(512);
     execObjectsStorage.reserve(512);
 
     executionEnvironment.osInterface->get()->setDrm(this->drm);
@@ -47,6 +49,7 @@ DrmCommandStreamReceiver<GfxFamily>::DrmCommandStreamReceiver(const HardwareInfo
 
 template <typename GfxFamily>
 FlushStamp DrmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBuffer, EngineType engineType, ResidencyContainer &allocationsForResidency, OsContext &osContext) {
+    TelemetryScope telemetryScope(TelemetryCounter::Flush);
     unsigned int engineFlag = 0xFF;
     bool ret = DrmEngineMapper<GfxFamily>::engineNodeMap(engineType, engineFlag);
     UNRECOVERABLE_IF(!(ret));
@@ -61,25 +64,25 @@ FlushStamp DrmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBuffer,
     if (bb) {
         flushStamp = bb->peekHandle();
         this->processResidency(allocationsForResidency, osContext);
-        // Residency hold all allocation except command buffer, hence + 1
-        auto requiredSize = this->residency.size() + 1;
-        if (requiredSize > this->execObjectsStorage.size()) {
-            this->execObjectsStorage.resize(requiredSize);
-        }
+        removeStaleResidencySetEntries();
 
-        bb->swapResidencyVector(&this->residency);
-        bb->setExecObjectsStorage(this->execObjectsStorage.data());
-        this->residency.reserve(512);
+        // Residency set holds all allocations except command buffer, hence + 1
+        auto residentObjectsCount = this->residencySet.size();
+        if (residentObjectsCount + 1 > this->execObjectsStorage.size()) {
+            this->execObjectsStorage.resize(residentObjectsCount + 1);
+        }
+        bb->setExecObjectsStorage(this->execObjectsStorage.data(), residentObjectsCount);
 
         bb->exec(static_cast<uint32_t>(alignUp(batchBuffer.usedSize - batchBuffer.startOffset, 8)),
                  alignedStart, engineFlag | I915_EXEC_NO_RELOC,
                  batchBuffer.requiresCoherency,
                  batchBuffer.low_priority);
 
-        for (auto &surface : *(bb->getResidency())) {
+        for (auto &surface : this->residency) {
             surface->setIsResident(false);
         }
-        bb->getResidency()->clear();
+        this->residency.clear();
+        this->residencyGeneration++;
 
         if (this->gemCloseWorkerOperationMode == gemCloseWorkerActive) {
             bb->reference();
@@ -104,11 +107,54 @@ void DrmCommandStreamReceiver<GfxFamily>::makeResident(BufferObject *bo) {
     if (bo && !bo->peekIsResident()) {
         bo->setIsResident(true);
         residency.push_back(bo);
+        addToResidencySet(bo);
+    }
+}
+
+template <typename GfxFamily>
+void DrmCommandStreamReceiver<GfxFamily>::addToResidencySet(BufferObject *bo) {
+    auto index = bo->peekResidencySetIndex();
+    if (bo->peekResidencySetOwner() == this && index < residencySet.size() && residencySet[index].bo == bo) {
+        // exec object filled during one of previous submissions is reused
+        residencySet[index].generation = residencyGeneration;
+        return;
+    }
+
+    index = residencySet.size();
+    residencySet.push_back({bo, residencyGeneration});
+    if (index + 1 > execObjectsStorage.size()) {
+        execObjectsStorage.resize(index + 1);
+    }
+    bo->fillExecObject(execObjectsStorage[index]);
+    bo->setResidencySetPosition(this, index);
+}
+
+template <typename GfxFamily>
+void DrmCommandStreamReceiver<GfxFamily>::removeStaleResidencySetEntries() {
+    // every BO made resident has exactly one entry tagged with current generation
+    if (residencySet.size() == residency.size()) {
+        return;
+    }
+
+    // stale entries are dropped without touching their BOs, remaining entries keep their order
+    size_t liveEntries = 0;
+    for (size_t i = 0; i < residencySet.size(); i++) {
+        if (residencySet[i].generation != residencyGeneration) {
+            continue;
+        }
+        if (i != liveEntries) {
+            residencySet[liveEntries] = residencySet[i];
+            execObjectsStorage[liveEntries] = execObjectsStorage[i];
+            residencySet[liveEntries].bo->setResidencySetPosition(this, liveEntries);
+        }
+        liveEntries++;
     }
+    residencySet.resize(liveEntries);
 }
 
 template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::processResidency(ResidencyContainer &inputAllocationsForResidency, OsContext &osContext) {
+    TelemetryScope telemetryScope(TelemetryCounter::Residency);
     for (auto &alloc : inputAllocationsForResidency) {
         auto drmAlloc = static_cast<DrmAllocation *>(alloc);
         if (drmAlloc->fragmentsStorage.fragmentCount) {
@@ -134,6 +180,7 @@ void DrmCommandStreamReceiver<GfxFamily>::makeNonResident(GraphicsAllocation &gf
         }
         if (this->residency.size() != 0) {
             this->residency.clear();
+            this->residencyGeneration++;
         }
         if (gfxAllocation.fragmentsStorage.fragmentCount) {
             for (auto fragmentId = 0u; fragmentId < gfxAllocation.fragmentsStorage.fragmentCount; fragmentId++) {
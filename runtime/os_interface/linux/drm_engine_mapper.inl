@@ -19,6 +19,10 @@ bool DrmEngineMapper<Family>::engineNodeMap(EngineType engineType, unsigned int
         flag = I915_EXEC_RENDER;
         ret = true;
         break;
+    case EngineType::ENGINE_BCS:
+        flag = I915_EXEC_BLT;
+        ret = true;
+        break;
     default:
         break;
     }
@@ -5,52 +5,74 @@
  *
  */
 
+#include <algorithm>
 #include <atomic>
 #include <iostream>
+#include <map>
 #include <queue>
 #include <stdio.h>
+#include <vector>
 #include "runtime/helpers/aligned_memory.h"
+#include "runtime/memory_manager/graphics_allocation.h"
+#include "runtime/os_interface/debug_settings_manager.h"
 #include "runtime/os_interface/linux/drm_buffer_object.h"
 #include "runtime/os_interface/linux/drm_command_stream.h"
 #include "runtime/os_interface/linux/drm_gem_close_worker.h"
 #include "runtime/os_interface/linux/drm_memory_manager.h"
-#include "runtime/os_interface/os_thread.h"
+#include "runtime/utilities/worker_pool.h"
 
 namespace OCLRT {
 
-DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : memoryManager(memoryManager) {
-    thread = Thread::create(worker, reinterpret_cast<void *>(this));
-}
-
-void DrmGemCloseWorker::closeThread() {
-    if (thread) {
-        while (!workerDone.load()) {
-            condition.notify_all();
-        }
-
-        thread->join();
-        thread.reset();
-    }
+DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : workerPool(WorkerPool::acquire()), memoryManager(memoryManager) {
 }
 
 DrmGemCloseWorker::~DrmGemCloseWorker() {
-    active = false;
-    closeThread();
+    close(true);
 }
 
 void DrmGemCloseWorker::push(BufferObject *bo) {
+    push(bo, ObjectNotUsed);
+}
+
+void DrmGemCloseWorker::push(BufferObject *bo, uint32_t taskCount) {
     std::unique_lock<std::mutex> lock(closeWorkerMutex);
     workCount++;
-    queue.push(bo);
-    lock.unlock();
-    condition.notify_one();
+    statistics.peakQueueDepth = std::max(statistics.peakQueueDepth, workCount.load());
+    if (!active) {
+        // worker was closed, nothing runs in background anymore
+        statistics.releasedBufferObjects++;
+        lock.unlock();
+        close(bo);
+        return;
+    }
+    queue.push({bo, taskCount});
+    if (!processingScheduled) {
+        processingScheduled = true;
+        lock.unlock();
+        workerPool->submit([this]() { processQueue(); });
+    }
 }
 
 void DrmGemCloseWorker::close(bool blocking) {
+    std::unique_lock<std::mutex> lock(closeWorkerMutex);
     active = false;
-    condition.notify_all();
     if (blocking) {
-        closeThread();
+        while (processingScheduled) {
+            condition.wait(lock);
+        }
+    }
+}
+
+void DrmGemCloseWorker::throttle() {
+    auto maxQueueDepth = DebugManager.flags.GemCloseWorkerMaxQueueDepth.get();
+    if (maxQueueDepth <= 0 || workCount.load() <= static_cast<uint32_t>(maxQueueDepth)) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(closeWorkerMutex);
+    statistics.throttledReleases++;
+    // each processed batch notifies, queue drains even when worker was closed meanwhile
+    while (processingScheduled && workCount.load() > static_cast<uint32_t>(maxQueueDepth)) {
+        condition.wait(lock);
     }
 }
 
@@ -58,48 +80,66 @@ bool DrmGemCloseWorker::isEmpty() {
     return workCount.load() == 0;
 }
 
+DrmGemCloseWorker::Statistics DrmGemCloseWorker::getStatistics() {
+    std::lock_guard<std::mutex> lock(closeWorkerMutex);
+    auto currentStatistics = statistics;
+    currentStatistics.queueDepth = workCount.load();
+    return currentStatistics;
+}
+
 inline void DrmGemCloseWorker::close(BufferObject *bo) {
     bo->wait(-1);
     memoryManager.unreference(bo);
     workCount--;
 }
 
-void *DrmGemCloseWorker::worker(void *arg) {
-    DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
-    BufferObject *workItem = nullptr;
-    std::queue<BufferObject *> localQueue;
-    std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
-    lock.unlock();
-
-    while (self->active) {
-        lock.lock();
-        workItem = nullptr;
-
-        while (self->queue.empty() && self->active) {
-            self->condition.wait(lock);
+uint32_t DrmGemCloseWorker::closeBatch(std::queue<WorkItem> &batch) {
+    // all BOs used by one submission of a command stream receiver are idle when any of them is idle
+    std::map<std::pair<const void *, uint32_t>, std::vector<BufferObject *>> groups;
+    uint32_t waitsCount = 0;
+
+    while (!batch.empty()) {
+        auto &workItem = batch.front();
+        if (workItem.taskCount == ObjectNotUsed || workItem.bo->peekResidencySetOwner() == nullptr) {
+            close(workItem.bo);
+            waitsCount++;
+        } else {
+            groups[std::make_pair(workItem.bo->peekResidencySetOwner(), workItem.taskCount)].push_back(workItem.bo);
         }
+        batch.pop();
+    }
 
-        if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
+    for (auto &group : groups) {
+        auto &bufferObjects = group.second;
+        bufferObjects.back()->wait(-1);
+        waitsCount++;
+        for (auto bo : bufferObjects) {
+            memoryManager.unreference(bo);
         }
+        workCount -= static_cast<uint32_t>(bufferObjects.size());
+    }
+    return waitsCount;
+}
+
+void DrmGemCloseWorker::processQueue() {
+    std::queue<WorkItem> localQueue;
+    std::unique_lock<std::mutex> lock(closeWorkerMutex);
 
+    while (!queue.empty()) {
+        localQueue.swap(queue);
+        auto batchSize = localQueue.size();
         lock.unlock();
-        while (!localQueue.empty()) {
-            workItem = localQueue.front();
-            localQueue.pop();
-            self->close(workItem);
-        }
-    }
+        auto waitsCount = closeBatch(localQueue);
+        lock.lock();
 
-    lock.lock();
-    while (!self->queue.empty()) {
-        workItem = self->queue.front();
-        self->queue.pop();
-        self->close(workItem);
+        statistics.batchesProcessed++;
+        statistics.groupWaits += waitsCount;
+        statistics.releasedBufferObjects += batchSize;
+        // wake up threads throttled on queue depth
+        condition.notify_all();
     }
 
-    lock.unlock();
-    self->workerDone.store(true);
-    return nullptr;
+    processingScheduled = false;
+    condition.notify_all();
 }
 } // namespace OCLRT
@@ -8,6 +8,7 @@
 #pragma once
 #include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <map>
 #include <set>
@@ -17,7 +18,7 @@
 namespace OCLRT {
 class DrmMemoryManager;
 class BufferObject;
-class Thread;
+class WorkerPool;
 
 enum gemCloseWorkerMode {
     gemCloseWorkerInactive,
@@ -32,26 +33,48 @@ class DrmGemCloseWorker {
     DrmGemCloseWorker(const DrmGemCloseWorker &) = delete;
     DrmGemCloseWorker &operator=(const DrmGemCloseWorker &) = delete;
 
+    struct Statistics {
+        uint32_t queueDepth = 0;
+        uint32_t peakQueueDepth = 0;
+        uint64_t batchesProcessed = 0;
+        uint64_t groupWaits = 0;
+        uint64_t releasedBufferObjects = 0;
+        uint64_t throttledReleases = 0;
+    };
+
+    // BO with unknown GPU usage is waited for on its own
     void push(BufferObject *allocation);
+    // BOs of the same command stream receiver and task count are released after single wait
+    void push(BufferObject *allocation, uint32_t taskCount);
     void close(bool blocking);
+    // blocks calling thread while queue is deeper than GemCloseWorkerMaxQueueDepth
+    void throttle();
 
     bool isEmpty();
+    Statistics getStatistics();
 
   protected:
+    struct WorkItem {
+        BufferObject *bo;
+        uint32_t taskCount;
+    };
+
     void close(BufferObject *workItem);
-    void closeThread();
-    static void *worker(void *arg);
+    uint32_t closeBatch(std::queue<WorkItem> &batch);
+    void processQueue();
     bool active = true;
 
-    std::unique_ptr<Thread> thread;
+    std::shared_ptr<WorkerPool> workerPool;
 
-    std::queue<BufferObject *> queue;
+    std::queue<WorkItem> queue;
     std::atomic<uint32_t> workCount{0};
+    Statistics statistics;
 
     DrmMemoryManager &memoryManager;
 
     std::mutex closeWorkerMutex;
     std::condition_variable condition;
-    std::atomic<bool> workerDone{false};
+    // queue is being processed by a worker pool task
+    bool processingScheduled = false;
 };
 } // namespace OCLRT
@@ -55,7 +55,8 @@ DrmMemoryManager::DrmMemoryManager(Drm *drm, gemCloseWorkerMode mode, bool force
 DrmMemoryManager::~DrmMemoryManager() {
     applyCommonCleanup();
     if (gemCloseWorker) {
-        gemCloseWorker->close(false);
+        // BOs released by common cleanup may still be queued
+        gemCloseWorker->close(true);
     }
     if (pinBB) {
         unreference(pinBB);
@@ -164,6 +165,13 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemory(size_t size, size_t alig
     // It's needed to prevent overlapping pages with user pointers
     size_t cSize = std::max(alignUp(size, minAlignment), minAlignment);
 
+    if (useHugePages(cSize, cAlignment)) {
+        auto allocation = allocateGraphicsMemoryWithHugePages(cSize, forcePin && size >= this->pinThreshold);
+        if (allocation) {
+            return allocation;
+        }
+    }
+
     auto res = alignedMallocWrapper(cSize, cAlignment);
 
     if (!res)
@@ -183,6 +191,70 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemory(size_t size, size_t alig
     return new DrmAllocation(bo, res, cSize, MemoryPool::System4KBPages);
 }
 
+bool DrmMemoryManager::useHugePages(size_t size, size_t alignment) {
+    if (size < MemoryConstants::pageSize2Mb || alignment > MemoryConstants::pageSize2Mb) {
+        return false;
+    }
+    auto enableHugePages = DebugManager.flags.EnableHugePages.get();
+    if (enableHugePages == -1) {
+        // mapping is rounded up to 2MB pages, by default only when it costs at most 1/8 of the size in resident memory
+        return alignUp(size, MemoryConstants::pageSize2Mb) - size <= size / 8;
+    }
+    return enableHugePages != 0;
+}
+
+DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryWithHugePages(size_t size, bool forcePin) {
+    auto alignedSize = alignUp(size, MemoryConstants::pageSize2Mb);
+    auto res = mmapHugePages(alignedSize, DebugManager.flags.EnableHugePages.get() == 2);
+    if (!res) {
+        return nullptr;
+    }
+
+    BufferObject *bo = allocUserptr(reinterpret_cast<uintptr_t>(res), alignedSize, 0, true);
+    if (!bo) {
+        munmapFunction(res, alignedSize);
+        return nullptr;
+    }
+
+    bo->isAllocated = true;
+    bo->setUnmapSize(alignedSize);
+    bo->setAllocationType(MMAP_ALLOCATOR);
+    if (forcePinEnabled && pinBB != nullptr && forcePin) {
+        pinBB->pin(&bo, 1);
+    }
+    return new DrmAllocation(bo, res, size, MemoryPool::System4KBPages);
+}
+
+void *DrmMemoryManager::mmapHugePages(size_t size, bool explicitHugePages) {
+    if (explicitHugePages) {
+        // succeeds only when the administrator reserved huge pages pool, transparent ones are the fallback
+        auto ptr = mmapFunction(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr != MAP_FAILED) {
+            return ptr;
+        }
+    }
+
+    // kernel backs with huge pages only 2MB aligned ranges, so the mapping is trimmed to alignment
+    auto sizeToMap = size + MemoryConstants::pageSize2Mb;
+    auto ptr = mmapFunction(nullptr, sizeToMap, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) {
+        return nullptr;
+    }
+    auto alignedPtr = alignUp(ptr, MemoryConstants::pageSize2Mb);
+    auto headSize = ptrDiff(alignedPtr, ptr);
+    if (headSize) {
+        munmapFunction(ptr, headSize);
+    }
+    auto tailSize = sizeToMap - headSize - size;
+    if (tailSize) {
+        munmapFunction(ptrOffset(alignedPtr, size), tailSize);
+    }
+
+    // only a hint, allocation stays usable when transparent huge pages are disabled in the system
+    madviseFunction(alignedPtr, size, MADV_HUGEPAGE);
+    return alignedPtr;
+}
+
 DrmAllocation *DrmMemoryManager::allocateGraphicsMemory(size_t size, const void *ptr, bool forcePin) {
     auto res = static_cast<DrmAllocation *>(MemoryManager::allocateGraphicsMemory(size, const_cast<void *>(ptr), forcePin));
 
@@ -194,6 +266,21 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemory(size_t size, const void
     return res;
 }
 
+DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryForReadOnlyHostPtr(size_t size, const void *ptr) {
+    auto alignedPtr = alignDown(const_cast<void *>(ptr), MemoryConstants::pageSize);
+    auto alignedSize = alignSizeWholePage(ptr, size);
+
+    // file backed pages are read ahead now instead of being faulted in one by one when userptr gets pinned
+    madviseFunction(alignedPtr, alignedSize, MADV_WILLNEED);
+
+    // kernel without read-only userptr support rejects the flag, buffer contents get copied then
+    BufferObject *bo = allocUserptr(reinterpret_cast<uintptr_t>(alignedPtr), alignedSize, I915_USERPTR_READ_ONLY, true);
+    if (!bo) {
+        return nullptr;
+    }
+    return new DrmAllocation(bo, const_cast<void *>(ptr), size, MemoryPool::System4KBPages);
+}
+
 DrmAllocation *DrmMemoryManager::allocateGraphicsMemory64kb(size_t size, size_t alignment, bool forcePin, bool preferRenderCompressed) {
     return nullptr;
 }
@@ -401,8 +488,8 @@ void DrmMemoryManager::addAllocationToHostPtrManager(GraphicsAllocation *gfxAllo
     DrmAllocation *drmMemory = static_cast<DrmAllocation *>(gfxAllocation);
     FragmentStorage fragment = {};
     fragment.driverAllocation = true;
-    fragment.fragmentCpuPointer = gfxAllocation->getUnderlyingBuffer();
-    fragment.fragmentSize = alignUp(gfxAllocation->getUnderlyingBufferSize(), MemoryConstants::pageSize);
+    fragment.fragmentCpuPointer = alignDown(gfxAllocation->getUnderlyingBuffer(), MemoryConstants::pageSize);
+    fragment.fragmentSize = alignSizeWholePage(gfxAllocation->getUnderlyingBuffer(), gfxAllocation->getUnderlyingBufferSize());
     fragment.osInternalStorage = new OsHandle();
     fragment.residency = new ResidencyData();
     fragment.osInternalStorage->bo = drmMemory->getBO();
@@ -412,7 +499,8 @@ void DrmMemoryManager::addAllocationToHostPtrManager(GraphicsAllocation *gfxAllo
 void DrmMemoryManager::removeAllocationFromHostPtrManager(GraphicsAllocation *gfxAllocation) {
     auto buffer = gfxAllocation->getUnderlyingBuffer();
     auto fragment = hostPtrManager.getFragment(buffer);
-    if (fragment && fragment->driverAllocation) {
+    // host ptr allocations made of fragments may lie within pages registered by another allocation
+    if (fragment && fragment->driverAllocation && fragment->osInternalStorage->bo == static_cast<DrmAllocation *>(gfxAllocation)->getBO()) {
         OsHandle *osStorageToRelease = fragment->osInternalStorage;
         ResidencyData *residencyDataToRelease = fragment->residency;
         if (hostPtrManager.releaseHostPtr(buffer)) {
@@ -437,6 +525,7 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation)
     }
 
     BufferObject *search = input->getBO();
+    auto taskCount = gfxAllocation->taskCount;
 
     if (gfxAllocation->peekSharedHandle() != Sharing::nonSharedResource) {
         closeFunction(gfxAllocation->peekSharedHandle());
@@ -444,6 +533,13 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation)
 
     delete gfxAllocation;
 
+    if (gemCloseWorker && !search->isReused) {
+        // wait and GEM_CLOSE are batched by worker, shared BOs stay synchronous as they are looked up on import
+        gemCloseWorker->push(search, taskCount);
+        gemCloseWorker->throttle();
+        return;
+    }
+
     search->wait(-1);
     unreference(search);
 }
@@ -32,6 +32,7 @@ class DrmMemoryManager : public MemoryManager {
     DrmAllocation *allocateGraphicsMemory(size_t size, size_t alignment, bool forcePin, bool uncacheable) override;
     DrmAllocation *allocateGraphicsMemory64kb(size_t size, size_t alignment, bool forcePin, bool preferRenderCompressed) override;
     DrmAllocation *allocateGraphicsMemoryForNonSvmHostPtr(size_t size, void *cpuPtr) override { return nullptr; };
+    DrmAllocation *allocateGraphicsMemoryForReadOnlyHostPtr(size_t size, const void *ptr) override;
     DrmAllocation *allocateGraphicsMemory(size_t size, const void *ptr) override {
         return allocateGraphicsMemory(size, ptr, false);
     }
@@ -67,6 +68,9 @@ class DrmMemoryManager : public MemoryManager {
     void eraseSharedBufferObject(BufferObject *bo);
     void pushSharedBufferObject(BufferObject *bo);
     BufferObject *allocUserptr(uintptr_t address, size_t size, uint64_t flags, bool softpin);
+    bool useHugePages(size_t size, size_t alignment);
+    DrmAllocation *allocateGraphicsMemoryWithHugePages(size_t size, bool forcePin);
+    void *mmapHugePages(size_t size, bool explicitHugePages);
     bool setDomainCpu(GraphicsAllocation &graphicsAllocation, bool writeEnable);
 
     Drm *drm;
@@ -78,6 +82,7 @@ class DrmMemoryManager : public MemoryManager {
     decltype(&lseek) lseekFunction = lseek;
     decltype(&mmap) mmapFunction = mmap;
     decltype(&munmap) munmapFunction = munmap;
+    decltype(&madvise) madviseFunction = madvise;
     decltype(&close) closeFunction = close;
     std::vector<BufferObject *> sharingBufferObjects;
     std::mutex mtx;
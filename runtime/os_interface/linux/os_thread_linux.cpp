@@ -6,6 +6,14 @@
  */
 
 #include "runtime/os_interface/linux/os_thread_linux.h"
+#include "runtime/utilities/cpu_list.h"
+
+#include <fstream>
+#include <sched.h>
+#include <string>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 
 namespace OCLRT {
 ThreadLinux::ThreadLinux(pthread_t threadId) : threadId(threadId){};
@@ -16,6 +24,35 @@ std::unique_ptr<Thread> Thread::create(void *(*func)(void *), void *arg) {
     return std::unique_ptr<Thread>(new ThreadLinux(threadId));
 }
 
+void Thread::setCurrentThreadAffinity(const std::vector<uint32_t> &cpus) {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (auto cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+    if (CPU_COUNT(&cpuSet) > 0) {
+        pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+    }
+}
+
+void Thread::lowerCurrentThreadPriority(int32_t levels) {
+    // nice value is per thread on Linux, PRIO_PROCESS with thread id changes only calling thread
+    auto threadId = static_cast<id_t>(syscall(SYS_gettid));
+    auto niceValue = getpriority(PRIO_PROCESS, threadId);
+    setpriority(PRIO_PROCESS, threadId, niceValue + levels);
+}
+
+std::vector<uint32_t> Thread::getNumaNodeCpus(uint32_t numaNode) {
+    std::ifstream cpuListFile("/sys/devices/system/node/node" + std::to_string(numaNode) + "/cpulist");
+    std::string cpuList;
+    if (!std::getline(cpuListFile, cpuList)) {
+        return {};
+    }
+    return parseCpuList(cpuList);
+}
+
 void ThreadLinux::join() {
     pthread_join(threadId, nullptr);
 }
@@ -6,12 +6,17 @@
  */
 
 #pragma once
+#include <cstdint>
 #include <memory>
+#include <vector>
 namespace OCLRT {
 
 class Thread {
   public:
     static std::unique_ptr<Thread> create(void *(*func)(void *), void *arg);
+    static void setCurrentThreadAffinity(const std::vector<uint32_t> &cpus);
+    static void lowerCurrentThreadPriority(int32_t levels);
+    static std::vector<uint32_t> getNumaNodeCpus(uint32_t numaNode);
     virtual void join() = 0;
     virtual ~Thread() = default;
 };
@@ -6,6 +6,9 @@
  */
 
 #include "runtime/os_interface/windows/os_thread_win.h"
+
+#include <Windows.h>
+
 namespace OCLRT {
 ThreadWin::ThreadWin(std::thread *thread) {
     this->thread.reset(thread);
@@ -15,6 +18,35 @@ std::unique_ptr<Thread> Thread::create(void *(*func)(void *), void *arg) {
     return std::unique_ptr<Thread>(new ThreadWin(new std::thread(func, arg)));
 }
 
+void Thread::setCurrentThreadAffinity(const std::vector<uint32_t> &cpus) {
+    DWORD_PTR affinityMask = 0;
+    for (auto cpu : cpus) {
+        if (cpu < sizeof(DWORD_PTR) * 8) {
+            affinityMask |= static_cast<DWORD_PTR>(1) << cpu;
+        }
+    }
+    if (affinityMask != 0) {
+        SetThreadAffinityMask(GetCurrentThread(), affinityMask);
+    }
+}
+
+void Thread::lowerCurrentThreadPriority(int32_t levels) {
+    SetThreadPriority(GetCurrentThread(), levels > 1 ? THREAD_PRIORITY_LOWEST : THREAD_PRIORITY_BELOW_NORMAL);
+}
+
+std::vector<uint32_t> Thread::getNumaNodeCpus(uint32_t numaNode) {
+    std::vector<uint32_t> cpus;
+    ULONGLONG processorMask = 0;
+    if (numaNode <= MAXUCHAR && GetNumaNodeProcessorMask(static_cast<UCHAR>(numaNode), &processorMask)) {
+        for (uint32_t cpu = 0; cpu < sizeof(processorMask) * 8; cpu++) {
+            if (processorMask & (1ull << cpu)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    return cpus;
+}
+
 void ThreadWin::join() {
     thread->join();
 }
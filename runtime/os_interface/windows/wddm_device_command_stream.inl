@@ -19,6 +19,7 @@
 #include "runtime/mem_obj/mem_obj.h"
 #include "runtime/os_interface/windows/wddm/wddm.h"
 #include "runtime/os_interface/windows/wddm_device_command_stream.h"
+#include "runtime/utilities/telemetry.h"
 #pragma warning(pop)
 
 #undef max
@@ -80,6 +81,7 @@ WddmCommandStreamReceiver<GfxFamily>::~WddmCommandStreamReceiver() {
 template <typename GfxFamily>
 FlushStamp WddmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBuffer,
                                                        EngineType engineType, ResidencyContainer &allocationsForResidency, OsContext &osContext) {
+    TelemetryScope telemetryScope(TelemetryCounter::Flush);
     auto commandStreamAddress = ptrOffset(batchBuffer.commandBufferAllocation->getGpuAddress(), batchBuffer.startOffset);
 
     if (this->dispatchMode == DispatchMode::ImmediateDispatch) {
@@ -136,6 +138,7 @@ void WddmCommandStreamReceiver<GfxFamily>::makeResident(GraphicsAllocation &gfxA
 
 template <typename GfxFamily>
 void WddmCommandStreamReceiver<GfxFamily>::processResidency(ResidencyContainer &allocationsForResidency, OsContext &osContext) {
+    TelemetryScope telemetryScope(TelemetryCounter::Residency);
     bool success = getMemoryManager()->makeResidentResidencyAllocations(allocationsForResidency, osContext);
     DEBUG_BREAK_IF(!success);
 }
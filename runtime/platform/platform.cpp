@@ -22,6 +22,8 @@
 #include "runtime/event/async_events_handler.h"
 #include "runtime/sharings/sharing_factory.h"
 #include "runtime/platform/extensions.h"
+#include "runtime/utilities/telemetry.h"
+#include "runtime/utilities/trace_recorder.h"
 #include "CL/cl_ext.h"
 
 namespace OCLRT {
@@ -50,6 +52,8 @@ Platform::Platform() {
 
 Platform::~Platform() {
     asyncEventsHandler->closeThread();
+    telemetryDumper.reset();
+    traceFileWriter.reset();
     for (auto dev : this->devices) {
         if (dev) {
             dev->decRefInternal();
@@ -167,6 +171,9 @@ bool Platform::initialize() {
 
     this->fillGlobalDispatchTable();
 
+    telemetryDumper = Telemetry::initialize();
+    traceFileWriter = TraceRecorder::initialize();
+
     state = StateInited;
     return true;
 }
@@ -18,6 +18,8 @@ namespace OCLRT {
 class CompilerInterface;
 class Device;
 class AsyncEventsHandler;
+class TelemetryDumper;
+class TraceFileWriter;
 class ExecutionEnvironment;
 struct HardwareInfo;
 
@@ -68,6 +70,8 @@ class Platform : public BaseObject<_cl_platform_id> {
     DeviceVector devices;
     std::string compilerExtensions;
     std::unique_ptr<AsyncEventsHandler> asyncEventsHandler;
+    std::unique_ptr<TelemetryDumper> telemetryDumper;
+    std::unique_ptr<TraceFileWriter> traceFileWriter;
     ExecutionEnvironment *executionEnvironment = nullptr;
 };
 
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/program/async_printf_output_handler.h"
+#include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/device/device.h"
+#include "runtime/program/printf_handler.h"
+#include "runtime/utilities/worker_pool.h"
+
+namespace OCLRT {
+AsyncPrintfOutputHandler::AsyncPrintfOutputHandler(Device &device) : device(device) {
+}
+
+AsyncPrintfOutputHandler::~AsyncPrintfOutputHandler() {
+    waitForAllOutputs();
+}
+
+void AsyncPrintfOutputHandler::registerOutput(std::unique_ptr<PrintfHandler> printfHandler, uint32_t taskCount, FlushStamp flushStamp) {
+    std::unique_lock<std::mutex> lock(asyncMtx);
+    //Acquire on first use
+    if (!workerPool) {
+        workerPool = WorkerPool::acquire();
+    }
+
+    // kernel info is needed to format the output, keep it alive until printed
+    printfHandler->getKernel()->incRefInternal();
+    pendingOutputs.push_back({std::move(printfHandler), taskCount, flushStamp});
+    if (!processingScheduled) {
+        processingScheduled = true;
+        lock.unlock();
+        workerPool->submit([this]() { processOutputs(); });
+    }
+}
+
+void AsyncPrintfOutputHandler::waitForOutputs(uint32_t taskCount) {
+    std::unique_lock<std::mutex> lock(asyncMtx);
+    while (!pendingOutputs.empty() && pendingOutputs.front().taskCount <= taskCount) {
+        outputPrintedCond.wait(lock);
+    }
+}
+
+void AsyncPrintfOutputHandler::waitForAllOutputs() {
+    std::unique_lock<std::mutex> lock(asyncMtx);
+    while (processingScheduled) {
+        outputPrintedCond.wait(lock);
+    }
+}
+
+void AsyncPrintfOutputHandler::printOutput(PendingOutput &output) {
+    device.getCommandStreamReceiver().waitForTaskCountWithKmdNotifyFallback(output.taskCount, output.flushStamp, false, *device.getOsContext());
+    output.printfHandler->printEnqueueOutput();
+
+    auto kernel = output.printfHandler->getKernel();
+    output.printfHandler.reset();
+    kernel->decRefInternal();
+}
+
+void AsyncPrintfOutputHandler::processOutputs() {
+    std::unique_lock<std::mutex> lock(asyncMtx);
+
+    // outputs are printed in submission order, the entry stays queued until printed
+    while (!pendingOutputs.empty()) {
+        auto &output = pendingOutputs.front();
+        lock.unlock();
+        printOutput(output);
+        lock.lock();
+
+        pendingOutputs.pop_front();
+        outputPrintedCond.notify_all();
+    }
+
+    processingScheduled = false;
+    outputPrintedCond.notify_all();
+}
+} // namespace OCLRT
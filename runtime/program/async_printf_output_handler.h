@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/completion_stamp.h"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace OCLRT {
+class Device;
+class PrintfHandler;
+class WorkerPool;
+
+// Prints printf output of non-blocking enqueues from the runtime worker pool once their task count completes,
+// so kernels using printf don't force the enqueuing thread to wait.
+class AsyncPrintfOutputHandler {
+  public:
+    AsyncPrintfOutputHandler(Device &device);
+    virtual ~AsyncPrintfOutputHandler();
+
+    void registerOutput(std::unique_ptr<PrintfHandler> printfHandler, uint32_t taskCount, FlushStamp flushStamp);
+    void waitForOutputs(uint32_t taskCount);
+    void waitForAllOutputs();
+
+  protected:
+    struct PendingOutput {
+        std::unique_ptr<PrintfHandler> printfHandler;
+        uint32_t taskCount;
+        FlushStamp flushStamp;
+    };
+
+    void processOutputs();
+    void printOutput(PendingOutput &output);
+
+    Device &device;
+    std::deque<PendingOutput> pendingOutputs;
+    std::shared_ptr<WorkerPool> workerPool;
+    std::mutex asyncMtx;
+    std::condition_variable outputPrintedCond;
+    // pending outputs are being printed by a worker pool task
+    bool processingScheduled = false;
+};
+} // namespace OCLRT
@@ -33,16 +33,20 @@ class PrintfHandler {
   public:
     static PrintfHandler *create(const MultiDispatchInfo &multiDispatchInfo, Device &deviceArg);
 
-    ~PrintfHandler();
+    MOCKABLE_VIRTUAL ~PrintfHandler();
 
     void prepareDispatch(const MultiDispatchInfo &multiDispatchInfo);
     void makeResident(CommandStreamReceiver &commandStreamReceiver);
-    void printEnqueueOutput();
+    MOCKABLE_VIRTUAL void printEnqueueOutput();
 
     GraphicsAllocation *getSurface() {
         return printfSurface;
     }
 
+    Kernel *getKernel() {
+        return kernel;
+    }
+
   protected:
     PrintfHandler(Device &device);
 
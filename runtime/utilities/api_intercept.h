@@ -23,9 +23,11 @@
 #pragma once
 #include "runtime/utilities/perf_profiler.h"
 #include "runtime/os_interface/debug_settings_manager.h"
+#include "runtime/utilities/telemetry.h"
 
-#define API_ENTER(retValPointer) \
-    DebugSettingsApiEnterWrapper<DebugManager.debugLoggingAvailable()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer)
+#define API_ENTER(retValPointer)                                                                                             \
+    DebugSettingsApiEnterWrapper<DebugManager.debugLoggingAvailable()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer); \
+    TelemetryScope apiTelemetryScope(TelemetryCounter::ApiCall, __FUNCTION__)
 #define SYSTEM_ENTER()
 #define SYSTEM_LEAVE(id)
 #define WAIT_ENTER()
@@ -38,8 +40,9 @@
 #undef WAIT_ENTER
 #undef WAIT_LEAVE
 
-#define API_ENTER(x) \
-    PerfProfilerApiWrapper globalPerfProfilersWrapperInstanceForSingleApiFunction(__FUNCTION__)
+#define API_ENTER(x)                                                                             \
+    PerfProfilerApiWrapper globalPerfProfilersWrapperInstanceForSingleApiFunction(__FUNCTION__); \
+    TelemetryScope apiTelemetryScope(TelemetryCounter::ApiCall, __FUNCTION__)
 
 #define SYSTEM_ENTER()      \
     PerfProfiler::create(); \
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace OCLRT {
+// Parses CPU list in Linux sysfs/cpuset format, e.g. "0-3,8,10-11". Malformed entries are skipped.
+inline std::vector<uint32_t> parseCpuList(const std::string &cpuList) {
+    std::vector<uint32_t> cpus;
+    size_t position = 0;
+    while (position < cpuList.size()) {
+        auto entryEnd = cpuList.find(',', position);
+        if (entryEnd == std::string::npos) {
+            entryEnd = cpuList.size();
+        }
+        auto entry = cpuList.substr(position, entryEnd - position);
+        position = entryEnd + 1;
+
+        char *end = nullptr;
+        auto first = std::strtoul(entry.c_str(), &end, 10);
+        if (end == entry.c_str()) {
+            continue;
+        }
+        auto last = first;
+        if (*end == '-') {
+            auto rangeStart = end + 1;
+            last = std::strtoul(rangeStart, &end, 10);
+            if (end == rangeStart || last < first) {
+                continue;
+            }
+        }
+        for (auto cpu = first; cpu <= last; cpu++) {
+            cpus.push_back(static_cast<uint32_t>(cpu));
+        }
+    }
+    return cpus;
+}
+} // namespace OCLRT
@@ -23,6 +23,11 @@ class SettingsReader {
         return createOsReader(false);
     }
     static SettingsReader *createOsReader(bool userScope);
+    // Settings listed under RELEASE FLAGS in DebugVariables_base.inl are honored also in release builds,
+    // where DebugManager doesn't read any flags, so their owners read them through this reader
+    static SettingsReader *createReleaseFlagsReader() {
+        return createOsReader(false);
+    }
     static SettingsReader *createFileReader();
     virtual int32_t getSetting(const char *settingName, int32_t defaultValue) = 0;
     virtual bool getSetting(const char *settingName, bool defaultValue) = 0;
@@ -145,6 +145,18 @@ class HeapAllocator {
         return size - availableSize;
     }
 
+    uint64_t getLargestFreeChunkSize() {
+        std::lock_guard<std::mutex> lock(mtx);
+        uint64_t largestFreeChunkSize = pRightBound - pLeftBound;
+        for (auto &freedChunk : freedChunksSmall) {
+            largestFreeChunkSize = std::max(largestFreeChunkSize, static_cast<uint64_t>(freedChunk.size));
+        }
+        for (auto &freedChunk : freedChunksBig) {
+            largestFreeChunkSize = std::max(largestFreeChunkSize, static_cast<uint64_t>(freedChunk.size));
+        }
+        return largestFreeChunkSize;
+    }
+
     NO_SANITIZE
     double getUsage() {
         return 1.0 * (size - availableSize) / (size * 1.0);
@@ -11,9 +11,12 @@
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/utilities/idlist.h"
 
+#include <array>
 #include <atomic>
 #include <cstdint>
+#include <memory>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 namespace OCLRT {
@@ -38,6 +41,19 @@ struct TagNode : public IDNode<TagNode<TagType>> {
     friend class TagAllocator;
 };
 
+// Free tags are cached per thread and per allocator, so getTag and returnTag
+// don't touch the shared free list until a cache runs empty or grows too big.
+struct TagAllocatorThreadCaches {
+    static constexpr size_t batchSize = 16;
+    static constexpr size_t maxCachedTags = 2 * batchSize;
+    static constexpr size_t lookupEntries = 4;
+
+    static uint64_t getNextAllocatorId() {
+        static std::atomic<uint64_t> nextAllocatorId{1};
+        return nextAllocatorId++;
+    }
+};
+
 template <typename TagType>
 class TagAllocator {
   public:
@@ -45,7 +61,8 @@ class TagAllocator {
 
     TagAllocator(MemoryManager *memMngr, size_t tagCount, size_t tagAlignment) : memoryManager(memMngr),
                                                                                  tagCount(tagCount),
-                                                                                 tagAlignment(tagAlignment) {
+                                                                                 tagAlignment(tagAlignment),
+                                                                                 allocatorId(TagAllocatorThreadCaches::getNextAllocatorId()) {
         populateFreeTags();
     }
 
@@ -54,6 +71,13 @@ class TagAllocator {
     }
 
     void cleanUpResources() {
+        for (auto &threadCache : threadCaches) {
+            threadCache->tags.detachNodes();
+            threadCache->count = 0;
+        }
+        freeTags.detachNodes();
+        deferredTags.detachNodes();
+
         size_t size = gfxAllocations.size();
 
         for (uint32_t i = 0; i < size; ++i) {
@@ -69,16 +93,13 @@ class TagAllocator {
     }
 
     NodeType *getTag() {
-        if (freeTags.peekIsEmpty()) {
-            releaseDeferredTags();
-        }
-        NodeType *node = freeTags.removeFrontOne().release();
-        if (!node) {
-            std::unique_lock<std::mutex> lock(allocatorMutex);
-            populateFreeTags();
-            node = freeTags.removeFrontOne().release();
+        auto &threadCache = getCurrentThreadCache();
+        NodeType *node = threadCache.tags.removeFrontOne().release();
+        if (node) {
+            threadCache.count--;
+        } else {
+            node = refillThreadCache(threadCache);
         }
-        usedTags.pushFrontOne(*node);
         node->incRefCount();
         node->tag->initialize();
         return node;
@@ -95,29 +116,131 @@ class TagAllocator {
     }
 
   protected:
+    struct ThreadCache {
+        IDList<NodeType> tags;
+        // touched only by the owning thread, may overestimate after another thread drained the cache
+        size_t count = 0;
+        std::thread::id owner;
+    };
+
     IDList<NodeType> freeTags;
-    IDList<NodeType> usedTags;
     IDList<NodeType> deferredTags;
+    std::vector<std::unique_ptr<ThreadCache>> threadCaches;
     std::vector<GraphicsAllocation *> gfxAllocations;
     std::vector<NodeType *> tagPoolMemory;
 
     MemoryManager *memoryManager;
     size_t tagCount;
     size_t tagAlignment;
+    uint64_t allocatorId;
 
     std::mutex allocatorMutex;
 
     MOCKABLE_VIRTUAL void returnTagToFreePool(NodeType *node) {
-        NodeType *usedNode = usedTags.removeOne(*node).release();
-        DEBUG_BREAK_IF(usedNode == nullptr);
-        ((void)(usedNode));
-        freeTags.pushFrontOne(*node);
+        auto &threadCache = getCurrentThreadCache();
+        threadCache.tags.pushFrontOne(*node);
+        if (++threadCache.count > TagAllocatorThreadCaches::maxCachedTags) {
+            flushThreadCache(threadCache);
+        }
     }
 
     void returnTagToDeferredPool(NodeType *node) {
-        NodeType *usedNode = usedTags.removeOne(*node).release();
-        DEBUG_BREAK_IF(!usedNode);
-        deferredTags.pushFrontOne(*usedNode);
+        deferredTags.pushFrontOne(*node);
+    }
+
+    ThreadCache &getCurrentThreadCache() {
+        struct LookupEntry {
+            uint64_t allocatorId;
+            ThreadCache *threadCache;
+        };
+        static thread_local std::array<LookupEntry, TagAllocatorThreadCaches::lookupEntries> lookupEntries = {};
+        static thread_local size_t nextLookupEntry = 0;
+
+        for (auto &entry : lookupEntries) {
+            if (entry.allocatorId == allocatorId) {
+                return *entry.threadCache;
+            }
+        }
+
+        ThreadCache *threadCache = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(allocatorMutex);
+            auto currentThread = std::this_thread::get_id();
+            for (auto &cache : threadCaches) {
+                if (cache->owner == currentThread) {
+                    threadCache = cache.get();
+                    break;
+                }
+            }
+            if (!threadCache) {
+                threadCaches.emplace_back(new ThreadCache);
+                threadCache = threadCaches.back().get();
+                threadCache->owner = currentThread;
+            }
+        }
+        lookupEntries[nextLookupEntry++ % TagAllocatorThreadCaches::lookupEntries] = {allocatorId, threadCache};
+        return *threadCache;
+    }
+
+    NodeType *refillThreadCache(ThreadCache &threadCache) {
+        std::unique_lock<std::mutex> lock(allocatorMutex);
+        if (freeTags.peekIsEmpty()) {
+            releaseDeferredTags();
+        }
+        if (freeTags.peekIsEmpty()) {
+            // tags returned by threads that went idle would otherwise force a new pool
+            drainThreadCaches();
+        }
+        if (freeTags.peekIsEmpty()) {
+            populateFreeTags();
+        }
+
+        auto node = freeTags.removeFrontOne().release();
+        auto batch = freeTags.detachNodes();
+        threadCache.count = 0;
+        if (batch != nullptr) {
+            auto batchTail = batch;
+            threadCache.count++;
+            while (threadCache.count < TagAllocatorThreadCaches::batchSize && batchTail->next != nullptr) {
+                batchTail = batchTail->next;
+                threadCache.count++;
+            }
+            auto remainingTags = batchTail->slice();
+            if (remainingTags != nullptr) {
+                freeTags.splice(*remainingTags);
+            }
+            threadCache.tags.splice(*batch);
+        }
+        return node;
+    }
+
+    void flushThreadCache(ThreadCache &threadCache) {
+        std::unique_lock<std::mutex> lock(allocatorMutex);
+        auto cachedTags = threadCache.tags.detachNodes();
+        threadCache.count = 0;
+        if (cachedTags == nullptr) {
+            return;
+        }
+        auto keptTail = cachedTags;
+        threadCache.count++;
+        while (threadCache.count < TagAllocatorThreadCaches::batchSize && keptTail->next != nullptr) {
+            keptTail = keptTail->next;
+            threadCache.count++;
+        }
+        auto flushedTags = keptTail->slice();
+        if (flushedTags != nullptr) {
+            freeTags.splice(*flushedTags);
+        }
+        threadCache.tags.splice(*cachedTags);
+    }
+
+    void drainThreadCaches() {
+        for (auto &threadCache : threadCaches) {
+            auto cachedTags = threadCache->tags.detachNodes();
+            if (cachedTags != nullptr) {
+                freeTags.splice(*cachedTags);
+            }
+        }
     }
 
     void populateFreeTags() {
@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/telemetry.h"
+#include "runtime/helpers/basic_math.h"
+#include "runtime/os_interface/os_thread.h"
+#include "runtime/utilities/debug_settings_reader.h"
+#include "runtime/utilities/worker_pool.h"
+
+#include <fstream>
+
+namespace OCLRT {
+
+constexpr uint32_t TelemetryHistogram::subBucketsShift;
+constexpr uint32_t TelemetryHistogram::subBucketsCount;
+constexpr uint32_t TelemetryHistogram::bucketsCount;
+constexpr uint32_t Telemetry::countersCount;
+
+std::atomic<bool> Telemetry::enabled{false};
+std::mutex Telemetry::threadsMutex;
+Telemetry::ThreadData *Telemetry::threadsHead = nullptr;
+std::array<Telemetry::ThreadCounter, Telemetry::countersCount> Telemetry::retiredCounters = {};
+
+namespace {
+const char *counterNames[] = {
+    "ApiCall",
+    "FlushTask",
+    "Flush",
+    "WaitForTaskCount",
+    "Allocation",
+    "Residency"};
+static_assert(sizeof(counterNames) / sizeof(counterNames[0]) == Telemetry::countersCount, "missing telemetry counter name");
+
+// only the owning thread writes to its counters, so plain load + store is enough
+inline void increment(std::atomic<uint64_t> &value, uint64_t delta) {
+    value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+}
+} // namespace
+
+uint32_t TelemetryHistogram::getBucketIndex(uint64_t value) {
+    if (value < subBucketsCount) {
+        return static_cast<uint32_t>(value);
+    }
+    auto msb = static_cast<uint32_t>(Math::log2(value));
+    auto subBucket = static_cast<uint32_t>(value >> (msb - subBucketsShift)) & (subBucketsCount - 1);
+    return (msb - subBucketsShift + 1) * subBucketsCount + subBucket;
+}
+
+uint64_t TelemetryHistogram::getBucketLowerBound(uint32_t bucketIndex) {
+    if (bucketIndex < subBucketsCount) {
+        return bucketIndex;
+    }
+    auto msb = bucketIndex / subBucketsCount + subBucketsShift - 1;
+    auto subBucket = static_cast<uint64_t>(bucketIndex % subBucketsCount);
+    return (1ull << msb) | (subBucket << (msb - subBucketsShift));
+}
+
+Telemetry::ThreadData::ThreadData() {
+    std::lock_guard<std::mutex> lock(threadsMutex);
+    next = threadsHead;
+    if (threadsHead) {
+        threadsHead->prev = this;
+    }
+    threadsHead = this;
+}
+
+Telemetry::ThreadData::~ThreadData() {
+    std::lock_guard<std::mutex> lock(threadsMutex);
+    for (uint32_t i = 0; i < countersCount; i++) {
+        accumulate(counters[i], retiredCounters[i]);
+    }
+    if (prev) {
+        prev->next = next;
+    } else {
+        threadsHead = next;
+    }
+    if (next) {
+        next->prev = prev;
+    }
+}
+
+void Telemetry::record(TelemetryCounter counter, uint64_t nanoseconds) {
+    thread_local ThreadData threadData;
+    auto &threadCounter = threadData.counters[static_cast<uint32_t>(counter)];
+
+    increment(threadCounter.count, 1);
+    increment(threadCounter.totalNanoseconds, nanoseconds);
+    if (nanoseconds > threadCounter.maxNanoseconds.load(std::memory_order_relaxed)) {
+        threadCounter.maxNanoseconds.store(nanoseconds, std::memory_order_relaxed);
+    }
+    increment(threadCounter.histogram[TelemetryHistogram::getBucketIndex(nanoseconds)], 1);
+}
+
+void Telemetry::accumulate(const ThreadCounter &source, TelemetryCounterData &data) {
+    data.count += source.count.load(std::memory_order_relaxed);
+    data.totalNanoseconds += source.totalNanoseconds.load(std::memory_order_relaxed);
+    auto maxNanoseconds = source.maxNanoseconds.load(std::memory_order_relaxed);
+    if (maxNanoseconds > data.maxNanoseconds) {
+        data.maxNanoseconds = maxNanoseconds;
+    }
+    for (uint32_t i = 0; i < TelemetryHistogram::bucketsCount; i++) {
+        data.histogram[i] += source.histogram[i].load(std::memory_order_relaxed);
+    }
+}
+
+void Telemetry::accumulate(const ThreadCounter &source, ThreadCounter &destination) {
+    increment(destination.count, source.count.load(std::memory_order_relaxed));
+    increment(destination.totalNanoseconds, source.totalNanoseconds.load(std::memory_order_relaxed));
+    auto maxNanoseconds = source.maxNanoseconds.load(std::memory_order_relaxed);
+    if (maxNanoseconds > destination.maxNanoseconds.load(std::memory_order_relaxed)) {
+        destination.maxNanoseconds.store(maxNanoseconds, std::memory_order_relaxed);
+    }
+    for (uint32_t i = 0; i < TelemetryHistogram::bucketsCount; i++) {
+        increment(destination.histogram[i], source.histogram[i].load(std::memory_order_relaxed));
+    }
+}
+
+void Telemetry::clear(ThreadCounter &counter) {
+    counter.count.store(0, std::memory_order_relaxed);
+    counter.totalNanoseconds.store(0, std::memory_order_relaxed);
+    counter.maxNanoseconds.store(0, std::memory_order_relaxed);
+    for (auto &bucket : counter.histogram) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void Telemetry::collect(TelemetryCounter counter, TelemetryCounterData &data) {
+    auto index = static_cast<uint32_t>(counter);
+    data = {};
+    std::lock_guard<std::mutex> lock(threadsMutex);
+    accumulate(retiredCounters[index], data);
+    for (auto threadData = threadsHead; threadData; threadData = threadData->next) {
+        accumulate(threadData->counters[index], data);
+    }
+}
+
+void Telemetry::reset() {
+    std::lock_guard<std::mutex> lock(threadsMutex);
+    for (uint32_t i = 0; i < countersCount; i++) {
+        clear(retiredCounters[i]);
+        for (auto threadData = threadsHead; threadData; threadData = threadData->next) {
+            clear(threadData->counters[i]);
+        }
+    }
+}
+
+const char *Telemetry::getCounterName(TelemetryCounter counter) {
+    return counterNames[static_cast<uint32_t>(counter)];
+}
+
+void Telemetry::dump(std::ostream &out) {
+    TelemetryCounterData data;
+    for (uint32_t i = 0; i < countersCount; i++) {
+        auto counter = static_cast<TelemetryCounter>(i);
+        collect(counter, data);
+        out << getCounterName(counter) << " count=" << data.count
+            << " totalNs=" << data.totalNanoseconds
+            << " maxNs=" << data.maxNanoseconds;
+        if (data.count) {
+            out << " avgNs=" << data.totalNanoseconds / data.count;
+        }
+        out << " histogram:";
+        for (uint32_t bucket = 0; bucket < TelemetryHistogram::bucketsCount; bucket++) {
+            if (data.histogram[bucket]) {
+                out << " " << TelemetryHistogram::getBucketLowerBound(bucket) << ":" << data.histogram[bucket];
+            }
+        }
+        out << std::endl;
+    }
+}
+
+std::unique_ptr<TelemetryDumper> Telemetry::initialize() {
+    std::unique_ptr<SettingsReader> settingsReader(SettingsReader::createReleaseFlagsReader());
+    setEnabled(settingsReader->getSetting("EnableTelemetry", false));
+    if (!isEnabled()) {
+        return nullptr;
+    }
+    auto fileName = settingsReader->getSetting("TelemetryDumpFile", std::string("unk"));
+    if (fileName.empty() || fileName == "unk") {
+        return nullptr;
+    }
+    auto intervalMs = settingsReader->getSetting("TelemetryDumpIntervalMs", 1000);
+    return std::unique_ptr<TelemetryDumper>(new TelemetryDumper(fileName, static_cast<uint32_t>(intervalMs > 0 ? intervalMs : 1000)));
+}
+
+TelemetryDumper::TelemetryDumper(const std::string &fileName, uint32_t intervalMs)
+    : fileName(fileName), interval(intervalMs) {
+    thread = Thread::create(dumpLoop, reinterpret_cast<void *>(this));
+}
+
+TelemetryDumper::~TelemetryDumper() {
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        stopDumping = true;
+    }
+    cond.notify_one();
+    if (thread) {
+        thread->join();
+        thread.reset(nullptr);
+    }
+    dumpToFile();
+}
+
+void TelemetryDumper::dumpToFile() {
+    std::ofstream file(fileName, std::ios::out | std::ios::trunc);
+    if (file.is_open()) {
+        Telemetry::dump(file);
+    }
+}
+
+void *TelemetryDumper::dumpLoop(void *arg) {
+    auto self = reinterpret_cast<TelemetryDumper *>(arg);
+    BackgroundThreadPolicy::get().applyToCurrentThread();
+    std::unique_lock<std::mutex> lock(self->mtx);
+    while (!self->stopDumping) {
+        self->cond.wait_for(lock, self->interval);
+        if (!self->stopDumping) {
+            lock.unlock();
+            self->dumpToFile();
+            lock.lock();
+        }
+    }
+    return nullptr;
+}
+} // namespace OCLRT
@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/utilities/trace_recorder.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+namespace OCLRT {
+class Thread;
+
+enum class TelemetryCounter : uint32_t {
+    ApiCall = 0,
+    FlushTask,
+    Flush,
+    WaitForTaskCount,
+    Allocation,
+    Residency,
+    Count
+};
+
+// Log-linear latency histogram: every power of two range is split into equal linear sub-buckets
+struct TelemetryHistogram {
+    static constexpr uint32_t subBucketsShift = 2;
+    static constexpr uint32_t subBucketsCount = 1u << subBucketsShift;
+    static constexpr uint32_t bucketsCount = 64 * subBucketsCount;
+
+    static uint32_t getBucketIndex(uint64_t value);
+    static uint64_t getBucketLowerBound(uint32_t bucketIndex);
+};
+
+struct TelemetryCounterData {
+    uint64_t count = 0;
+    uint64_t totalNanoseconds = 0;
+    uint64_t maxNanoseconds = 0;
+    std::array<uint64_t, TelemetryHistogram::bucketsCount> histogram = {};
+};
+
+class TelemetryDumper;
+
+// Always compiled, runtime-enabled counters for hot paths. Every thread updates its own cache-line
+// aligned copy without atomic read-modify-write operations, copies are summed up only when collected.
+class Telemetry {
+  public:
+    static constexpr uint32_t countersCount = static_cast<uint32_t>(TelemetryCounter::Count);
+
+    static bool isEnabled() {
+        return enabled.load(std::memory_order_relaxed);
+    }
+    static void setEnabled(bool enable) {
+        enabled.store(enable, std::memory_order_relaxed);
+    }
+
+    static std::unique_ptr<TelemetryDumper> initialize();
+
+    static void record(TelemetryCounter counter, uint64_t nanoseconds);
+    static void collect(TelemetryCounter counter, TelemetryCounterData &data);
+    static void reset();
+    static void dump(std::ostream &out);
+    static const char *getCounterName(TelemetryCounter counter);
+
+  protected:
+    struct alignas(64) ThreadCounter {
+        std::atomic<uint64_t> count;
+        std::atomic<uint64_t> totalNanoseconds;
+        std::atomic<uint64_t> maxNanoseconds;
+        std::array<std::atomic<uint64_t>, TelemetryHistogram::bucketsCount> histogram;
+    };
+
+    struct ThreadData {
+        ThreadData();
+        ~ThreadData();
+
+        std::array<ThreadCounter, countersCount> counters = {};
+        ThreadData *next = nullptr;
+        ThreadData *prev = nullptr;
+    };
+
+    static void accumulate(const ThreadCounter &source, TelemetryCounterData &data);
+    static void accumulate(const ThreadCounter &source, ThreadCounter &destination);
+    static void clear(ThreadCounter &counter);
+
+    static std::atomic<bool> enabled;
+    static std::mutex threadsMutex;
+    static ThreadData *threadsHead;
+    // counters of threads that already exited
+    static std::array<ThreadCounter, countersCount> retiredCounters;
+};
+
+// Measures enclosing scope for telemetry and, when tracing, records it as a CPU span named after the counter or given name
+class TelemetryScope {
+  public:
+    TelemetryScope(TelemetryCounter counter, const char *name = nullptr) : counter(counter), name(name) {
+        active = Telemetry::isEnabled() || TraceRecorder::isEnabled();
+        if (active) {
+            start = TraceRecorder::getTimestamp();
+        }
+    }
+
+    ~TelemetryScope() {
+        if (active) {
+            auto elapsed = TraceRecorder::getTimestamp() - start;
+            if (Telemetry::isEnabled()) {
+                Telemetry::record(counter, elapsed);
+            }
+            if (TraceRecorder::isEnabled()) {
+                TraceRecorder::recordCpuSpan(name ? name : Telemetry::getCounterName(counter), start, elapsed);
+            }
+        }
+    }
+
+    TelemetryScope(const TelemetryScope &) = delete;
+    TelemetryScope &operator=(const TelemetryScope &) = delete;
+
+  protected:
+    TelemetryCounter counter;
+    const char *name;
+    bool active;
+    uint64_t start = 0;
+};
+
+// Periodically writes collected telemetry to a file
+class TelemetryDumper {
+  public:
+    TelemetryDumper(const std::string &fileName, uint32_t intervalMs);
+    virtual ~TelemetryDumper();
+
+    void dumpToFile();
+
+  protected:
+    static void *dumpLoop(void *arg);
+
+    std::string fileName;
+    std::chrono::milliseconds interval;
+    std::unique_ptr<Thread> thread;
+    std::mutex mtx;
+    std::condition_variable cond;
+    bool stopDumping = false;
+};
+} // namespace OCLRT
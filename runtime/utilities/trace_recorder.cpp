@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/trace_recorder.h"
+#include "runtime/helpers/cl_helper.h"
+#include "runtime/utilities/debug_settings_reader.h"
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+
+namespace OCLRT {
+
+constexpr uint32_t TraceRecorder::threadBufferCapacity;
+
+std::atomic<bool> TraceRecorder::enabled{false};
+std::mutex TraceRecorder::storageMutex;
+TraceRecorder::ThreadBuffer *TraceRecorder::buffersHead = nullptr;
+uint64_t TraceRecorder::threadsCreated = 0;
+std::vector<TraceEvent> TraceRecorder::storage;
+
+namespace {
+const uint32_t cpuProcessId = 1;
+const uint32_t gpuProcessId = 2;
+
+void writeMicroseconds(std::ostream &out, uint64_t nanoseconds) {
+    out << nanoseconds / 1000 << "." << std::setw(3) << std::setfill('0') << nanoseconds % 1000 << std::setfill(' ');
+}
+} // namespace
+
+TraceRecorder::ThreadBuffer::ThreadBuffer() {
+    std::lock_guard<std::mutex> lock(storageMutex);
+    threadOrdinal = threadsCreated++;
+    next = buffersHead;
+    if (buffersHead) {
+        buffersHead->prev = this;
+    }
+    buffersHead = this;
+}
+
+TraceRecorder::ThreadBuffer::~ThreadBuffer() {
+    std::lock_guard<std::mutex> lock(storageMutex);
+    storage.insert(storage.end(), events.begin(), events.begin() + used.load(std::memory_order_relaxed));
+    if (prev) {
+        prev->next = next;
+    } else {
+        buffersHead = next;
+    }
+    if (next) {
+        next->prev = prev;
+    }
+}
+
+void TraceRecorder::ThreadBuffer::moveToStorage() {
+    std::lock_guard<std::mutex> lock(storageMutex);
+    storage.insert(storage.end(), events.begin(), events.begin() + used.load(std::memory_order_relaxed));
+    used.store(0, std::memory_order_relaxed);
+}
+
+uint64_t TraceRecorder::getTimestamp() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void TraceRecorder::append(TraceEvent &event) {
+    thread_local ThreadBuffer buffer;
+
+    auto used = buffer.used.load(std::memory_order_relaxed);
+    if (used == threadBufferCapacity) {
+        buffer.moveToStorage();
+        used = 0;
+    }
+    if (!event.gpu) {
+        event.trackId = buffer.threadOrdinal;
+    }
+    buffer.events[used] = event;
+    // publish only filled entries to collecting threads
+    buffer.used.store(used + 1, std::memory_order_release);
+}
+
+void TraceRecorder::recordCpuSpan(const char *name, uint64_t startNs, uint64_t durationNs) {
+    TraceEvent event = {name, 0, false, 0, startNs, durationNs};
+    append(event);
+}
+
+void TraceRecorder::recordGpuSpan(uint32_t commandType, uint64_t trackId, uint64_t startNs, uint64_t durationNs) {
+    TraceEvent event = {nullptr, commandType, true, trackId, startNs, durationNs};
+    append(event);
+}
+
+void TraceRecorder::collect(std::vector<TraceEvent> &events) {
+    std::lock_guard<std::mutex> lock(storageMutex);
+    events.insert(events.end(), storage.begin(), storage.end());
+    for (auto buffer = buffersHead; buffer; buffer = buffer->next) {
+        auto used = buffer->used.load(std::memory_order_acquire);
+        events.insert(events.end(), buffer->events.begin(), buffer->events.begin() + used);
+    }
+}
+
+void TraceRecorder::clear() {
+    std::lock_guard<std::mutex> lock(storageMutex);
+    std::vector<TraceEvent>().swap(storage);
+    for (auto buffer = buffersHead; buffer; buffer = buffer->next) {
+        buffer->used.store(0, std::memory_order_relaxed);
+    }
+}
+
+void TraceRecorder::writeChromeTrace(std::ostream &out) {
+    std::vector<TraceEvent> events;
+    collect(events);
+
+    out << "{\"traceEvents\":[" << std::endl;
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << cpuProcessId << ",\"args\":{\"name\":\"CPU\"}}," << std::endl;
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << gpuProcessId << ",\"args\":{\"name\":\"GPU\"}}";
+    for (auto &event : events) {
+        out << "," << std::endl;
+        out << "{\"name\":\"" << (event.gpu ? cmdTypetoString(event.commandType) : std::string(event.name))
+            << "\",\"cat\":\"" << (event.gpu ? "gpu" : "cpu")
+            << "\",\"ph\":\"X\",\"ts\":";
+        writeMicroseconds(out, event.startNs);
+        out << ",\"dur\":";
+        writeMicroseconds(out, event.durationNs);
+        out << ",\"pid\":" << (event.gpu ? gpuProcessId : cpuProcessId)
+            << ",\"tid\":" << event.trackId << "}";
+    }
+    out << std::endl
+        << "]}" << std::endl;
+}
+
+std::unique_ptr<TraceFileWriter> TraceRecorder::initialize() {
+    std::unique_ptr<SettingsReader> settingsReader(SettingsReader::createReleaseFlagsReader());
+    auto fileName = settingsReader->getSetting("ChromeTraceFile", std::string("unk"));
+    setEnabled(!fileName.empty() && fileName != "unk");
+    if (!isEnabled()) {
+        return nullptr;
+    }
+    return std::unique_ptr<TraceFileWriter>(new TraceFileWriter(fileName));
+}
+
+TraceFileWriter::~TraceFileWriter() {
+    std::ofstream file(fileName, std::ios::out | std::ios::trunc);
+    if (file.is_open()) {
+        TraceRecorder::writeChromeTrace(file);
+    }
+}
+} // namespace OCLRT
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace OCLRT {
+
+struct TraceEvent {
+    const char *name;     // CPU spans, points to a string with static storage
+    uint32_t commandType; // GPU spans, cl_command_type of the executed command
+    bool gpu;
+    uint64_t trackId; // thread ordinal for CPU spans, command queue for GPU spans
+    uint64_t startNs;
+    uint64_t durationNs;
+};
+
+class TraceFileWriter;
+
+// Timeline of CPU spans and GPU command execution written as Chrome trace JSON.
+// Every thread appends to its own fixed size buffer without locking, full buffers are moved to shared storage.
+class TraceRecorder {
+  public:
+    static constexpr uint32_t threadBufferCapacity = 256;
+
+    static bool isEnabled() {
+        return enabled.load(std::memory_order_relaxed);
+    }
+    static void setEnabled(bool enable) {
+        enabled.store(enable, std::memory_order_relaxed);
+    }
+
+    static std::unique_ptr<TraceFileWriter> initialize();
+
+    // CPU spans and GPU timestamps converted to host time have to use this clock
+    static uint64_t getTimestamp();
+
+    static void recordCpuSpan(const char *name, uint64_t startNs, uint64_t durationNs);
+    static void recordGpuSpan(uint32_t commandType, uint64_t trackId, uint64_t startNs, uint64_t durationNs);
+    static void collect(std::vector<TraceEvent> &events);
+    // must not race with recording threads
+    static void clear();
+    static void writeChromeTrace(std::ostream &out);
+
+  protected:
+    struct ThreadBuffer {
+        ThreadBuffer();
+        ~ThreadBuffer();
+        void moveToStorage();
+
+        std::array<TraceEvent, threadBufferCapacity> events;
+        std::atomic<uint32_t> used{0};
+        uint64_t threadOrdinal = 0;
+        ThreadBuffer *next = nullptr;
+        ThreadBuffer *prev = nullptr;
+    };
+
+    static void append(TraceEvent &event);
+
+    static std::atomic<bool> enabled;
+    static std::mutex storageMutex;
+    static ThreadBuffer *buffersHead;
+    static uint64_t threadsCreated;
+    static std::vector<TraceEvent> storage;
+};
+
+// Writes recorded trace to a file when destroyed
+class TraceFileWriter {
+  public:
+    TraceFileWriter(const std::string &fileName) : fileName(fileName) {}
+    virtual ~TraceFileWriter();
+
+  protected:
+    std::string fileName;
+};
+} // namespace OCLRT
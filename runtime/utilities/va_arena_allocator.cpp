@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/va_arena_allocator.h"
+#include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/debug_helpers.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace OCLRT {
+constexpr uint64_t VaArenaStatistics::slabSize;
+constexpr size_t VaArenaAllocator::slabSize;
+constexpr size_t VaArenaAllocator::smallAllocationMaxSize;
+constexpr size_t VaArenaAllocator::mediumAllocationMaxSize;
+constexpr size_t VaArenaAllocator::mediumAllocationGranularity;
+constexpr uint32_t VaArenaAllocator::smallClassesCount;
+constexpr uint32_t VaArenaAllocator::mediumClassesCount;
+constexpr uint32_t VaArenaAllocator::maxEmptySlabsCount;
+
+namespace {
+constexpr uint32_t hugeSizeClass = std::numeric_limits<uint32_t>::max();
+}
+
+VaArenaAllocator::VaArenaAllocator(uint64_t address, uint64_t size) : heapSize(size) {
+    // slabs are the only allocations placed in the upper part of the heap
+    heapAllocator = std::make_unique<HeapAllocator>(address, size, slabSize);
+    // slabs are stacked down from the heap end, aligning it once keeps every slab 2MB aligned
+    auto heapEnd = address + size;
+    size_t paddingSize = static_cast<size_t>(heapEnd - alignDown(heapEnd, slabSize));
+    if (paddingSize != 0) {
+        heapAllocator->allocate(paddingSize);
+    }
+}
+
+VaArenaAllocator::~VaArenaAllocator() = default;
+
+uint32_t VaArenaAllocator::getSizeClass(size_t size) {
+    if (size <= smallAllocationMaxSize) {
+        return static_cast<uint32_t>(size / MemoryConstants::pageSize) - 1;
+    }
+    if (size <= mediumAllocationMaxSize) {
+        return smallClassesCount + static_cast<uint32_t>((alignUp(size, mediumAllocationGranularity) - smallAllocationMaxSize) / mediumAllocationGranularity) - 1;
+    }
+    return hugeSizeClass;
+}
+
+size_t VaArenaAllocator::getBlockSize(uint32_t sizeClass) {
+    if (sizeClass < smallClassesCount) {
+        return (sizeClass + 1) * MemoryConstants::pageSize;
+    }
+    return smallAllocationMaxSize + (sizeClass - smallClassesCount + 1) * mediumAllocationGranularity;
+}
+
+size_t VaArenaAllocator::getHugeAllocationSize(size_t size) {
+    // ranges up to slab size are placed among slabs at the heap end, taking whole slab keeps slabs aligned
+    return std::max(size, slabSize);
+}
+
+uint64_t VaArenaAllocator::allocate(size_t &sizeToAllocate) {
+    std::lock_guard<std::mutex> lock(mtx);
+    sizeToAllocate = std::max(alignUp(sizeToAllocate, MemoryConstants::pageSize), MemoryConstants::pageSize);
+
+    auto sizeClass = getSizeClass(sizeToAllocate);
+    if (sizeClass == hugeSizeClass) {
+        sizeToAllocate = getHugeAllocationSize(sizeToAllocate);
+        auto ptr = heapAllocator->allocate(sizeToAllocate);
+        if (ptr) {
+            hugeUsedSize += sizeToAllocate;
+        }
+        return ptr;
+    }
+
+    sizeToAllocate = getBlockSize(sizeClass);
+    return allocateFromSlab(sizeClass);
+}
+
+void VaArenaAllocator::free(uint64_t ptr, size_t size) {
+    if (ptr == 0llu) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    size = std::max(alignUp(size, MemoryConstants::pageSize), MemoryConstants::pageSize);
+
+    auto sizeClass = getSizeClass(size);
+    if (sizeClass == hugeSizeClass) {
+        size = getHugeAllocationSize(size);
+        heapAllocator->free(ptr, size);
+        hugeUsedSize -= size;
+        return;
+    }
+
+    auto slab = slabs.upper_bound(ptr);
+    UNRECOVERABLE_IF(slab == slabs.begin());
+    slab--;
+    DEBUG_BREAK_IF(slab->second.sizeClass != sizeClass);
+
+    auto blockSize = getBlockSize(slab->second.sizeClass);
+    auto blocksCount = getBlocksCount(slab->second.sizeClass);
+    auto &slabsWithFreeBlocksOfClass = slabsWithFreeBlocks[slab->second.sizeClass];
+
+    slab->second.freedBlocks.push_back(static_cast<uint32_t>((ptr - slab->first) / blockSize));
+    if (slab->second.usedBlocks == blocksCount) {
+        slabsWithFreeBlocksOfClass.push_back(slab->first);
+    }
+    slab->second.usedBlocks--;
+    slabsUsedSize -= blockSize;
+
+    // keep single empty slab of the class, so allocate/free pairs don't bounce slabs to the heap,
+    // but don't let empty slabs of many classes hold the heap
+    if (slab->second.usedBlocks == 0) {
+        if (slabsWithFreeBlocksOfClass.size() > 1 || emptySlabsCount == maxEmptySlabsCount) {
+            releaseSlab(slab);
+        } else {
+            emptySlabsCount++;
+        }
+    }
+}
+
+uint64_t VaArenaAllocator::allocateFromSlab(uint32_t sizeClass) {
+    auto &slabsWithFreeBlocksOfClass = slabsWithFreeBlocks[sizeClass];
+    if (slabsWithFreeBlocksOfClass.empty()) {
+        auto slabAddress = createSlab(sizeClass);
+        if (slabAddress == 0llu) {
+            return 0llu;
+        }
+        slabsWithFreeBlocksOfClass.push_back(slabAddress);
+    }
+
+    auto slabAddress = slabsWithFreeBlocksOfClass.back();
+    auto &slab = slabs[slabAddress];
+    if (slab.usedBlocks == 0 && slab.untouchedBlock != 0) {
+        emptySlabsCount--;
+    }
+    uint32_t block = 0;
+    if (slab.freedBlocks.empty()) {
+        block = slab.untouchedBlock++;
+    } else {
+        block = slab.freedBlocks.back();
+        slab.freedBlocks.pop_back();
+    }
+
+    slab.usedBlocks++;
+    if (slab.usedBlocks == getBlocksCount(sizeClass)) {
+        slabsWithFreeBlocksOfClass.pop_back();
+    }
+
+    auto blockSize = getBlockSize(sizeClass);
+    slabsUsedSize += blockSize;
+    return slabAddress + block * blockSize;
+}
+
+uint64_t VaArenaAllocator::createSlab(uint32_t sizeClass) {
+    size_t sizeToAllocate = slabSize;
+    auto slabAddress = heapAllocator->allocate(sizeToAllocate);
+    if (slabAddress == 0llu) {
+        return 0llu;
+    }
+    DEBUG_BREAK_IF(sizeToAllocate != slabSize);
+
+    slabs[slabAddress].sizeClass = sizeClass;
+    return slabAddress;
+}
+
+void VaArenaAllocator::releaseSlab(std::map<uint64_t, Slab>::iterator slab) {
+    auto &slabsWithFreeBlocksOfClass = slabsWithFreeBlocks[slab->second.sizeClass];
+    slabsWithFreeBlocksOfClass.erase(std::find(slabsWithFreeBlocksOfClass.begin(), slabsWithFreeBlocksOfClass.end(), slab->first));
+    heapAllocator->free(slab->first, slabSize);
+    slabs.erase(slab);
+}
+
+VaArenaStatistics VaArenaAllocator::getStatistics() {
+    std::lock_guard<std::mutex> lock(mtx);
+    VaArenaStatistics statistics;
+    statistics.heapSize = heapSize;
+    statistics.freeSize = heapAllocator->getLeftSize();
+    statistics.largestFreeChunkSize = heapAllocator->getLargestFreeChunkSize();
+    statistics.slabsCount = slabs.size();
+    statistics.slabsUsedSize = slabsUsedSize;
+    statistics.hugeUsedSize = hugeUsedSize;
+    return statistics;
+}
+} // namespace OCLRT
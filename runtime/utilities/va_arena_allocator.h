@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/memory_manager/memory_constants.h"
+#include "runtime/utilities/heap_allocator.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace OCLRT {
+
+struct VaArenaStatistics {
+    uint64_t heapSize = 0;
+    uint64_t freeSize = 0;             // not reserved by slabs nor huge allocations
+    uint64_t largestFreeChunkSize = 0; // biggest range huge allocation or slab can still be placed in
+    uint64_t slabsCount = 0;
+    uint64_t slabsUsedSize = 0; // blocks handed out from slabs
+    uint64_t hugeUsedSize = 0;
+
+    // share of free range not usable by single allocation
+    double getHeapFragmentation() const {
+        return freeSize ? 1.0 - static_cast<double>(largestFreeChunkSize) / freeSize : 0.0;
+    }
+    // share of slab range not handed out
+    double getSlabsFragmentation() const {
+        return slabsCount ? 1.0 - static_cast<double>(slabsUsedSize) / (slabsCount * slabSize) : 0.0;
+    }
+
+    static constexpr uint64_t slabSize = 2 * MemoryConstants::megaByte;
+};
+
+// GPU VA allocator keeping allocations of different size classes apart, so freeing them doesn't fragment the heap.
+// Small (up to 64KB, page granular) and medium (up to 1MB, 64KB granular) allocations are carved from 2MB slabs
+// dedicated to single size class, only whole slabs and huge allocations are taken from the underlying heap.
+// Bigger allocations would leave most of their slab unused, so they are huge and taken from the heap directly.
+class VaArenaAllocator {
+  public:
+    static constexpr size_t slabSize = static_cast<size_t>(VaArenaStatistics::slabSize);
+    static constexpr size_t smallAllocationMaxSize = MemoryConstants::pageSize64k;
+    static constexpr size_t mediumAllocationMaxSize = slabSize / 2;
+    static constexpr size_t mediumAllocationGranularity = MemoryConstants::pageSize64k;
+    static constexpr uint32_t smallClassesCount = static_cast<uint32_t>(smallAllocationMaxSize / MemoryConstants::pageSize);
+    static constexpr uint32_t mediumClassesCount = static_cast<uint32_t>((mediumAllocationMaxSize - smallAllocationMaxSize) / mediumAllocationGranularity);
+    static constexpr uint32_t maxEmptySlabsCount = 4;
+
+    VaArenaAllocator(uint64_t address, uint64_t size);
+    ~VaArenaAllocator();
+
+    uint64_t allocate(size_t &sizeToAllocate);
+    void free(uint64_t ptr, size_t size);
+
+    VaArenaStatistics getStatistics();
+
+  protected:
+    struct Slab {
+        uint32_t sizeClass = 0;
+        uint32_t usedBlocks = 0;
+        uint32_t untouchedBlock = 0; // blocks from this index on were never handed out
+        std::vector<uint32_t> freedBlocks;
+    };
+
+    static uint32_t getSizeClass(size_t size);
+    static size_t getBlockSize(uint32_t sizeClass);
+    static size_t getHugeAllocationSize(size_t size);
+    static uint32_t getBlocksCount(uint32_t sizeClass) { return static_cast<uint32_t>(slabSize / getBlockSize(sizeClass)); }
+
+    uint64_t allocateFromSlab(uint32_t sizeClass);
+    uint64_t createSlab(uint32_t sizeClass);
+    void releaseSlab(std::map<uint64_t, Slab>::iterator slab);
+
+    std::unique_ptr<HeapAllocator> heapAllocator;
+    std::mutex mtx;
+
+    std::map<uint64_t, Slab> slabs;
+    std::vector<uint64_t> slabsWithFreeBlocks[smallClassesCount + mediumClassesCount];
+    uint32_t emptySlabsCount = 0;
+    uint64_t slabsUsedSize = 0;
+    uint64_t hugeUsedSize = 0;
+    uint64_t heapSize = 0;
+};
+} // namespace OCLRT
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/worker_pool.h"
+#include "runtime/os_interface/os_thread.h"
+#include "runtime/utilities/cpu_list.h"
+#include "runtime/utilities/debug_settings_reader.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace OCLRT {
+
+thread_local WorkerPool::Worker *WorkerPool::currentWorker = nullptr;
+
+const BackgroundThreadPolicy &BackgroundThreadPolicy::get() {
+    static const BackgroundThreadPolicy policy = []() {
+        std::unique_ptr<SettingsReader> settingsReader(SettingsReader::createReleaseFlagsReader());
+        return create(*settingsReader);
+    }();
+    return policy;
+}
+
+BackgroundThreadPolicy BackgroundThreadPolicy::create(SettingsReader &settingsReader) {
+    BackgroundThreadPolicy policy;
+    auto cpuList = settingsReader.getSetting("BackgroundThreadsCpuList", std::string("unk"));
+    if (!cpuList.empty() && cpuList != "unk") {
+        policy.cpus = parseCpuList(cpuList);
+    } else {
+        auto numaNode = settingsReader.getSetting("BackgroundThreadsNumaNode", -1);
+        if (numaNode >= 0) {
+            policy.cpus = Thread::getNumaNodeCpus(static_cast<uint32_t>(numaNode));
+        }
+    }
+    policy.priorityDecrease = std::max(0, settingsReader.getSetting("BackgroundThreadsPriorityDecrease", 0));
+    return policy;
+}
+
+void BackgroundThreadPolicy::applyToCurrentThread() const {
+    if (!cpus.empty()) {
+        Thread::setCurrentThreadAffinity(cpus);
+    }
+    if (priorityDecrease > 0) {
+        Thread::lowerCurrentThreadPriority(priorityDecrease);
+    }
+}
+
+std::shared_ptr<WorkerPool> WorkerPool::acquire() {
+    static std::mutex poolMutex;
+    static std::weak_ptr<WorkerPool> sharedPool;
+
+    std::lock_guard<std::mutex> lock(poolMutex);
+    auto pool = sharedPool.lock();
+    if (!pool) {
+        std::unique_ptr<SettingsReader> settingsReader(SettingsReader::createReleaseFlagsReader());
+        auto threadsCount = getDefaultThreadsCount(settingsReader->getSetting("WorkerPoolThreadsCount", -1));
+        pool = std::make_shared<WorkerPool>(threadsCount, BackgroundThreadPolicy::get());
+        sharedPool = pool;
+    }
+    return pool;
+}
+
+uint32_t WorkerPool::getDefaultThreadsCount(int32_t requestedThreadsCount) {
+    if (requestedThreadsCount > 0) {
+        return static_cast<uint32_t>(requestedThreadsCount);
+    }
+    // background services mostly wait for the GPU, few threads are enough
+    auto hardwareThreads = std::thread::hardware_concurrency();
+    return std::max(1u, std::min(2u, hardwareThreads));
+}
+
+WorkerPool::WorkerPool(uint32_t threadsCount, const BackgroundThreadPolicy &policy) : policy(policy) {
+    threadsCount = std::max(1u, threadsCount);
+    for (uint32_t i = 0; i < threadsCount; i++) {
+        auto worker = std::make_unique<Worker>();
+        worker->pool = this;
+        worker->index = i;
+        workers.push_back(std::move(worker));
+    }
+    // workers steal from each other, start them only when all queues exist
+    for (auto &worker : workers) {
+        worker->thread = Thread::create(workerLoop, reinterpret_cast<void *>(worker.get()));
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::unique_lock<std::mutex> lock(sleepMtx);
+        stopWorkers = true;
+    }
+    sleepCond.notify_all();
+    for (auto &worker : workers) {
+        worker->thread->join();
+        worker->thread.reset(nullptr);
+    }
+}
+
+void WorkerPool::submit(Task task) {
+    {
+        std::unique_lock<std::mutex> lock(sleepMtx);
+        pendingTasks++;
+    }
+    // tasks submitted from a worker stay local to keep their data in that worker's caches
+    auto worker = (currentWorker && currentWorker->pool == this) ? currentWorker : workers[nextWorker++ % workers.size()].get();
+    {
+        std::unique_lock<std::mutex> lock(worker->queueMtx);
+        worker->tasks.push_back(std::move(task));
+    }
+    sleepCond.notify_one();
+}
+
+bool WorkerPool::popTask(Worker &worker, Task &task) {
+    std::unique_lock<std::mutex> lock(worker.queueMtx);
+    if (worker.tasks.empty()) {
+        return false;
+    }
+    task = std::move(worker.tasks.back());
+    worker.tasks.pop_back();
+    return true;
+}
+
+bool WorkerPool::stealTask(Worker &thief, Task &task) {
+    auto workersCount = static_cast<uint32_t>(workers.size());
+    for (uint32_t i = 1; i < workersCount; i++) {
+        auto &victim = *workers[(thief.index + i) % workersCount];
+        std::unique_lock<std::mutex> lock(victim.queueMtx);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void *WorkerPool::workerLoop(void *arg) {
+    auto &worker = *reinterpret_cast<Worker *>(arg);
+    auto pool = worker.pool;
+    currentWorker = &worker;
+    pool->policy.applyToCurrentThread();
+
+    Task task;
+    while (true) {
+        if (pool->popTask(worker, task) || pool->stealTask(worker, task)) {
+            pool->pendingTasks--;
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(pool->sleepMtx);
+        if (pool->pendingTasks.load() == 0) {
+            // pending tasks are still executed when pool is being destroyed
+            if (pool->stopWorkers) {
+                break;
+            }
+            pool->sleepCond.wait(lock);
+        }
+    }
+    currentWorker = nullptr;
+    return nullptr;
+}
+} // namespace OCLRT
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace OCLRT {
+class SettingsReader;
+class Thread;
+
+// CPU placement and priority of runtime background threads
+struct BackgroundThreadPolicy {
+    std::vector<uint32_t> cpus;
+    int32_t priorityDecrease = 0;
+
+    // policy of the process, read once
+    static const BackgroundThreadPolicy &get();
+    static BackgroundThreadPolicy create(SettingsReader &settingsReader);
+
+    void applyToCurrentThread() const;
+};
+
+// Executor shared by runtime background services. Every worker owns a task queue and idle workers steal
+// from queues of other workers. Tasks may block (e.g. on GPU completion) but must not wait for other tasks.
+class WorkerPool {
+  public:
+    using Task = std::function<void()>;
+
+    // process-wide pool, created on first use and destroyed together with its last user
+    static std::shared_ptr<WorkerPool> acquire();
+    static uint32_t getDefaultThreadsCount(int32_t requestedThreadsCount);
+
+    WorkerPool(uint32_t threadsCount, const BackgroundThreadPolicy &policy);
+    virtual ~WorkerPool();
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    void submit(Task task);
+    uint32_t getThreadsCount() const { return static_cast<uint32_t>(workers.size()); }
+
+  protected:
+    struct Worker {
+        WorkerPool *pool = nullptr;
+        uint32_t index = 0;
+        std::mutex queueMtx;
+        std::deque<Task> tasks;
+        std::unique_ptr<Thread> thread;
+    };
+
+    static void *workerLoop(void *arg);
+    bool popTask(Worker &worker, Task &task);
+    bool stealTask(Worker &thief, Task &task);
+
+    static thread_local Worker *currentWorker;
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    BackgroundThreadPolicy policy;
+    std::mutex sleepMtx;
+    std::condition_variable sleepCond;
+    std::atomic<uint32_t> pendingTasks{0};
+    std::atomic<uint32_t> nextWorker{0};
+    bool stopWorkers = false;
+};
+} // namespace OCLRT
@@ -7,6 +7,7 @@
 
 #include "unit_tests/api/cl_build_program_tests.inl"
 #include "unit_tests/api/cl_clone_kernel_tests.inl"
+#include "unit_tests/api/cl_command_template_intel_tests.inl"
 #include "unit_tests/api/cl_compile_program_tests.inl"
 #include "unit_tests/api/cl_create_buffer_tests.inl"
 #include "unit_tests/api/cl_create_command_queue_tests.inl"
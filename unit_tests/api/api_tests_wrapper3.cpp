@@ -13,6 +13,7 @@
 #include "unit_tests/api/cl_get_program_build_info_tests.inl"
 #include "unit_tests/api/cl_get_program_info_tests.inl"
 #include "unit_tests/api/cl_get_supported_image_formats_tests.inl"
+#include "unit_tests/api/cl_get_telemetry_data_intel_tests.inl"
 #include "unit_tests/api/cl_icd_get_platform_ids_khr_tests.inl"
 #include "unit_tests/api/cl_intel_accelerator_tests.inl"
 #include "unit_tests/api/cl_intel_motion_estimation.inl"
@@ -31,6 +32,7 @@
 #include "unit_tests/api/cl_set_default_device_command_queue_tests.inl"
 #include "unit_tests/api/cl_set_event_callback_tests.inl"
 #include "unit_tests/api/cl_set_kernel_arg_svm_pointer_tests.inl"
+#include "unit_tests/api/cl_set_kernel_args_intel_tests.inl"
 #include "unit_tests/api/cl_set_kernel_exec_info_tests.inl"
 #include "unit_tests/api/cl_set_mem_object_destructor_callback_tests.inl"
 #include "unit_tests/api/cl_set_performance_configuration_tests.inl"
@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "cl_api_tests.h"
+#include "runtime/command_queue/command_queue.h"
+#include "runtime/command_queue/command_template.h"
+#include "unit_tests/mocks/mock_kernel.h"
+
+using namespace OCLRT;
+
+typedef api_tests clCommandTemplateINTELTests;
+
+namespace ULT {
+
+TEST_F(clCommandTemplateINTELTests, givenInOrderQueueWhenCreatingCommandTemplateThenTemplateIsReturned) {
+    auto commandTemplate = clCreateCommandTemplateINTEL(pCommandQueue, &retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(nullptr, commandTemplate);
+
+    auto pCommandTemplate = castToObject<CommandTemplate>(commandTemplate);
+    ASSERT_NE(nullptr, pCommandTemplate);
+    EXPECT_EQ(pCommandQueue, &pCommandTemplate->getCommandQueue());
+    EXPECT_FALSE(pCommandTemplate->isFinalized());
+
+    retVal = clReleaseCommandTemplateINTEL(commandTemplate);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+}
+
+TEST_F(clCommandTemplateINTELTests, givenNullQueueWhenCreatingCommandTemplateThenInvalidCommandQueueIsReturned) {
+    auto commandTemplate = clCreateCommandTemplateINTEL(nullptr, &retVal);
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, retVal);
+    EXPECT_EQ(nullptr, commandTemplate);
+}
+
+TEST_F(clCommandTemplateINTELTests, givenOutOfOrderQueueWhenCreatingCommandTemplateThenInvalidCommandQueueIsReturned) {
+    cl_queue_properties properties[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, 0};
+    auto outOfOrderQueue = clCreateCommandQueueWithProperties(pContext, pPlatform->getDevice(0), properties, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    auto commandTemplate = clCreateCommandTemplateINTEL(outOfOrderQueue, &retVal);
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, retVal);
+    EXPECT_EQ(nullptr, commandTemplate);
+
+    clReleaseCommandQueue(outOfOrderQueue);
+}
+
+TEST_F(clCommandTemplateINTELTests, givenInvalidTemplateWhenCallingTemplateFunctionsThenInvalidCommandTemplateIsReturned) {
+    size_t globalWorkSize[3] = {1, 1, 1};
+    auto invalidTemplate = reinterpret_cast<cl_command_template_intel>(pContext);
+
+    EXPECT_EQ(CL_INVALID_COMMAND_TEMPLATE_INTEL, clCommandTemplateNDRangeKernelINTEL(nullptr, pKernel, 1, nullptr, globalWorkSize, nullptr));
+    EXPECT_EQ(CL_INVALID_COMMAND_TEMPLATE_INTEL, clCommandTemplateNDRangeKernelINTEL(invalidTemplate, pKernel, 1, nullptr, globalWorkSize, nullptr));
+    EXPECT_EQ(CL_INVALID_COMMAND_TEMPLATE_INTEL, clFinalizeCommandTemplateINTEL(invalidTemplate));
+    EXPECT_EQ(CL_INVALID_COMMAND_TEMPLATE_INTEL, clSetCommandTemplateGlobalWorkSizeINTEL(invalidTemplate, 0, globalWorkSize));
+    EXPECT_EQ(CL_INVALID_COMMAND_TEMPLATE_INTEL, clEnqueueCommandTemplateINTEL(pCommandQueue, invalidTemplate, 0, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_COMMAND_TEMPLATE_INTEL, clRetainCommandTemplateINTEL(invalidTemplate));
+    EXPECT_EQ(CL_INVALID_COMMAND_TEMPLATE_INTEL, clReleaseCommandTemplateINTEL(invalidTemplate));
+}
+
+TEST_F(clCommandTemplateINTELTests, givenKernelWhenRecordingCommandThenSizesAreStoredAndTemplateCanBeFinalized) {
+    size_t globalWorkOffset[3] = {4, 0, 0};
+    size_t globalWorkSize[3] = {64, 2, 1};
+    size_t localWorkSize[3] = {16, 1, 1};
+
+    auto commandTemplate = clCreateCommandTemplateINTEL(pCommandQueue, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = clCommandTemplateNDRangeKernelINTEL(commandTemplate, pKernel, 2, globalWorkOffset, globalWorkSize, localWorkSize);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto pCommandTemplate = castToObject<CommandTemplate>(commandTemplate);
+    ASSERT_EQ(1u, pCommandTemplate->getCommands().size());
+    auto &command = *pCommandTemplate->getCommands()[0];
+    EXPECT_EQ(pKernel, command.kernel);
+    EXPECT_EQ(2u, command.workDim);
+    EXPECT_EQ(4u, command.globalWorkOffset[0]);
+    EXPECT_EQ(64u, command.globalWorkSize[0]);
+    EXPECT_EQ(2u, command.globalWorkSize[1]);
+    EXPECT_EQ(16u, command.localWorkSize[0]);
+    EXPECT_TRUE(command.localWorkSizeSpecified);
+    ASSERT_NE(nullptr, command.multiDispatchInfo);
+    EXPECT_FALSE(command.multiDispatchInfo->empty());
+
+    retVal = clFinalizeCommandTemplateINTEL(commandTemplate);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(pCommandTemplate->isFinalized());
+
+    retVal = clCommandTemplateNDRangeKernelINTEL(commandTemplate, pKernel, 1, nullptr, globalWorkSize, nullptr);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+    retVal = clFinalizeCommandTemplateINTEL(commandTemplate);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+
+    clReleaseCommandTemplateINTEL(commandTemplate);
+}
+
+TEST_F(clCommandTemplateINTELTests, givenEmptyTemplateWhenFinalizingThenInvalidOperationIsReturned) {
+    auto commandTemplate = clCreateCommandTemplateINTEL(pCommandQueue, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = clFinalizeCommandTemplateINTEL(commandTemplate);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+
+    clReleaseCommandTemplateINTEL(commandTemplate);
+}
+
+TEST_F(clCommandTemplateINTELTests, givenInvalidWorkSizesWhenRecordingCommandThenErrorIsReturnedAndNothingIsRecorded) {
+    size_t globalWorkSize[3] = {64, 1, 1};
+    size_t zeroGlobalWorkSize[3] = {0, 1, 1};
+    size_t zeroLocalWorkSize[3] = {0, 1, 1};
+    size_t nonUniformLocalWorkSize[3] = {7, 1, 1};
+
+    auto commandTemplate = clCreateCommandTemplateINTEL(pCommandQueue, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(CL_INVALID_KERNEL, clCommandTemplateNDRangeKernelINTEL(commandTemplate, nullptr, 1, nullptr, globalWorkSize, nullptr));
+    EXPECT_EQ(CL_INVALID_WORK_DIMENSION, clCommandTemplateNDRangeKernelINTEL(commandTemplate, pKernel, 0, nullptr, globalWorkSize, nullptr));
+    EXPECT_EQ(CL_INVALID_WORK_DIMENSION, clCommandTemplateNDRangeKernelINTEL(commandTemplate, pKernel, 4, nullptr, globalWorkSize, nullptr));
+    EXPECT_EQ(CL_INVALID_GLOBAL_WORK_SIZE, clCommandTemplateNDRangeKernelINTEL(commandTemplate, pKernel, 1, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_GLOBAL_WORK_SIZE, clCommandTemplateNDRangeKernelINTEL(commandTemplate, pKernel, 1, nullptr, zeroGlobalWorkSize, nullptr));
+    EXPECT_EQ(CL_INVALID_WORK_GROUP_SIZE, clCommandTemplateNDRangeKernelINTEL(commandTemplate, pKernel, 1, nullptr, globalWorkSize, zeroLocalWorkSize));
+    EXPECT_EQ(CL_INVALID_WORK_GROUP_SIZE, clCommandTemplateNDRangeKernelINTEL(commandTemplate, pKernel, 1, nullptr, globalWorkSize, nonUniformLocalWorkSize));
+
+    EXPECT_TRUE(castToObject<CommandTemplate>(commandTemplate)->getCommands().empty());
+    clReleaseCommandTemplateINTEL(commandTemplate);
+}
+
+TEST_F(clCommandTemplateINTELTests, givenRecordedCommandWhenSettingGlobalWorkSizeThenCommandIsRebakedAndGenerationChanges) {
+    size_t globalWorkSize[3] = {64, 1, 1};
+    size_t newGlobalWorkSize[3] = {128, 1, 1};
+
+    auto commandTemplate = clCreateCommandTemplateINTEL(pCommandQueue, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    retVal = clCommandTemplateNDRangeKernelINTEL(commandTemplate, pKernel, 1, nullptr, globalWorkSize, nullptr);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    auto pCommandTemplate = castToObject<CommandTemplate>(commandTemplate);
+    auto generation = pCommandTemplate->getGeneration();
+
+    retVal = clSetCommandTemplateGlobalWorkSizeINTEL(commandTemplate, 1, newGlobalWorkSize);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+    retVal = clSetCommandTemplateGlobalWorkSizeINTEL(commandTemplate, 0, nullptr);
+    EXPECT_EQ(CL_INVALID_GLOBAL_WORK_SIZE, retVal);
+    EXPECT_EQ(generation, pCommandTemplate->getGeneration());
+
+    retVal = clSetCommandTemplateGlobalWorkSizeINTEL(commandTemplate, 0, newGlobalWorkSize);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(128u, pCommandTemplate->getCommands()[0]->globalWorkSize[0]);
+    EXPECT_EQ(generation + 1, pCommandTemplate->getGeneration());
+
+    clReleaseCommandTemplateINTEL(commandTemplate);
+}
+
+TEST_F(clCommandTemplateINTELTests, givenNotFinalizedTemplateWhenEnqueueingThenInvalidOperationIsReturned) {
+    size_t globalWorkSize[3] = {64, 1, 1};
+    auto commandTemplate = clCreateCommandTemplateINTEL(pCommandQueue, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    retVal = clCommandTemplateNDRangeKernelINTEL(commandTemplate, pKernel, 1, nullptr, globalWorkSize, nullptr);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    auto commandQueueHw = clCreateCommandQueue(pContext, pPlatform->getDevice(0), 0, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    auto templateOnHwQueue = clCreateCommandTemplateINTEL(commandQueueHw, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    retVal = clCommandTemplateNDRangeKernelINTEL(templateOnHwQueue, pKernel, 1, nullptr, globalWorkSize, nullptr);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = clEnqueueCommandTemplateINTEL(commandQueueHw, templateOnHwQueue, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+
+    clReleaseCommandTemplateINTEL(templateOnHwQueue);
+    clReleaseCommandQueue(commandQueueHw);
+    clReleaseCommandTemplateINTEL(commandTemplate);
+}
+
+TEST_F(clCommandTemplateINTELTests, givenTemplateRecordedOnOtherQueueWhenEnqueueingThenInvalidCommandQueueIsReturned) {
+    size_t globalWorkSize[3] = {64, 1, 1};
+    auto commandTemplate = clCreateCommandTemplateINTEL(pCommandQueue, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    clCommandTemplateNDRangeKernelINTEL(commandTemplate, pKernel, 1, nullptr, globalWorkSize, nullptr);
+    clFinalizeCommandTemplateINTEL(commandTemplate);
+
+    auto otherQueue = clCreateCommandQueue(pContext, pPlatform->getDevice(0), 0, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = clEnqueueCommandTemplateINTEL(otherQueue, commandTemplate, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, retVal);
+    retVal = clEnqueueCommandTemplateINTEL(nullptr, commandTemplate, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, retVal);
+
+    clReleaseCommandQueue(otherQueue);
+    clReleaseCommandTemplateINTEL(commandTemplate);
+}
+
+TEST_F(clCommandTemplateINTELTests, givenTemplateWhenRetainingThenTemplateIsDestroyedWithLastRelease) {
+    auto commandTemplate = clCreateCommandTemplateINTEL(pCommandQueue, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    auto pCommandTemplate = castToObject<CommandTemplate>(commandTemplate);
+
+    retVal = clRetainCommandTemplateINTEL(commandTemplate);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(2, pCommandTemplate->getReference());
+
+    retVal = clReleaseCommandTemplateINTEL(commandTemplate);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1, pCommandTemplate->getReference());
+
+    retVal = clReleaseCommandTemplateINTEL(commandTemplate);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+}
+} // namespace ULT
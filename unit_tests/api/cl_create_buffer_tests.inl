@@ -52,6 +52,8 @@ static cl_mem_flags validFlags[] = {
     CL_MEM_HOST_READ_ONLY,
     CL_MEM_HOST_WRITE_ONLY,
     CL_MEM_HOST_NO_ACCESS,
+    CL_MEM_READ_ONLY | CL_MEM_HOST_NO_ACCESS | CL_MEM_READ_ONLY_HOST_PTR_INTEL,
+    CL_MEM_READ_ONLY | CL_MEM_HOST_READ_ONLY | CL_MEM_READ_ONLY_HOST_PTR_INTEL,
 };
 
 INSTANTIATE_TEST_CASE_P(
@@ -79,6 +81,9 @@ cl_mem_flags inValidFlags[] = {
     CL_MEM_HOST_NO_ACCESS | CL_MEM_HOST_WRITE_ONLY,
     CL_MEM_HOST_NO_ACCESS | CL_MEM_HOST_READ_ONLY,
     CL_MEM_HOST_READ_ONLY | CL_MEM_HOST_WRITE_ONLY,
+    CL_MEM_READ_ONLY | CL_MEM_HOST_NO_ACCESS | CL_MEM_READ_ONLY_HOST_PTR_INTEL,
+    CL_MEM_USE_HOST_PTR | CL_MEM_READ_WRITE | CL_MEM_HOST_NO_ACCESS | CL_MEM_READ_ONLY_HOST_PTR_INTEL,
+    CL_MEM_USE_HOST_PTR | CL_MEM_READ_ONLY | CL_MEM_READ_ONLY_HOST_PTR_INTEL,
     0xffcc,
 };
 
@@ -7,7 +7,9 @@
 
 #include "cl_api_tests.h"
 #include "runtime/command_queue/command_queue.h"
+#include "runtime/helpers/aligned_memory.h"
 #include "runtime/helpers/ptr_math.h"
+#include "public/cl_ext_private.h"
 #include "unit_tests/mocks/mock_buffer.h"
 
 using namespace OCLRT;
@@ -59,4 +61,38 @@ TEST_F(clEnqueueCopyBufferRectTests, NullCommandQueue_returnsError) {
 
     EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, retVal);
 }
+TEST_F(clEnqueueCopyBufferRectTests, givenReadOnlyHostPtrDstBufferWhenCopyIsEnqueuedThenInvalidOperationIsReturned) {
+    cl_mem_flags flags = CL_MEM_USE_HOST_PTR | CL_MEM_READ_ONLY | CL_MEM_HOST_NO_ACCESS | CL_MEM_READ_ONLY_HOST_PTR_INTEL;
+    void *hostPtr = alignedMalloc(MemoryConstants::pageSize, MemoryConstants::pageSize);
+    MockBuffer srcBuffer;
+    size_t srcOrigin[] = {0, 0, 0};
+    size_t dstOrigin[] = {0, 0, 0};
+    size_t region[] = {10, 10, 1};
+
+    auto dstBuffer = clCreateBuffer(pContext, flags, MemoryConstants::pageSize, hostPtr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = clEnqueueCopyBufferRect(
+        pCommandQueue,
+        &srcBuffer, //srcBuffer
+        dstBuffer,  //dstBuffer
+        srcOrigin,
+        dstOrigin,
+        region,
+        10, //srcRowPitch
+        0,  //srcSlicePitch
+        10, //dstRowPitch
+        0,  //dstSlicePitch
+        0,  //numEventsInWaitList
+        nullptr,
+        nullptr);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+
+    retVal = clEnqueueCopyBuffer(pCommandQueue, &srcBuffer, dstBuffer, 0, 0, 10, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+
+    retVal = clReleaseMemObject(dstBuffer);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    alignedFree(hostPtr);
+}
 } // namespace ULT
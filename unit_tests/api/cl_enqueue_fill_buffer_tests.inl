@@ -7,7 +7,10 @@
 
 #include "cl_api_tests.h"
 #include "runtime/command_queue/command_queue.h"
+#include "runtime/helpers/aligned_memory.h"
 #include "runtime/helpers/ptr_math.h"
+#include "runtime/mem_obj/buffer.h"
+#include "public/cl_ext_private.h"
 
 using namespace OCLRT;
 
@@ -49,4 +52,66 @@ TEST_F(clEnqueueFillBufferTests, nullBufferReturnsError) {
 
     EXPECT_EQ(CL_INVALID_MEM_OBJECT, retVal);
 }
+TEST_F(clEnqueueFillBufferTests, givenReadOnlyHostPtrBufferWhenFillIsEnqueuedThenInvalidOperationIsReturned) {
+    cl_mem_flags flags = CL_MEM_USE_HOST_PTR | CL_MEM_READ_ONLY | CL_MEM_HOST_NO_ACCESS | CL_MEM_READ_ONLY_HOST_PTR_INTEL;
+    void *hostPtr = alignedMalloc(MemoryConstants::pageSize, MemoryConstants::pageSize);
+    cl_float pattern = 1.0f;
+
+    auto buffer = clCreateBuffer(pContext, flags, MemoryConstants::pageSize, hostPtr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = clEnqueueFillBuffer(
+        pCommandQueue,
+        buffer,
+        &pattern,
+        sizeof(pattern),
+        0,
+        sizeof(pattern),
+        0,
+        nullptr,
+        nullptr);
+
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+
+    retVal = clReleaseMemObject(buffer);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    alignedFree(hostPtr);
+}
+TEST_F(clEnqueueFillBufferTests, givenSubBufferOfReadOnlyHostPtrBufferWhenFillOrCopyIsEnqueuedThenInvalidOperationIsReturned) {
+    cl_mem_flags flags = CL_MEM_USE_HOST_PTR | CL_MEM_READ_ONLY | CL_MEM_HOST_NO_ACCESS | CL_MEM_READ_ONLY_HOST_PTR_INTEL;
+    void *hostPtr = alignedMalloc(MemoryConstants::pageSize, MemoryConstants::pageSize);
+    cl_float pattern = 1.0f;
+
+    auto buffer = clCreateBuffer(pContext, flags, MemoryConstants::pageSize, hostPtr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    auto otherBuffer = clCreateBuffer(pContext, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    cl_buffer_region region = {0, MemoryConstants::cacheLineSize};
+    auto subBuffer = clCreateSubBuffer(buffer, 0, CL_BUFFER_CREATE_TYPE_REGION, &region, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    cl_mem_flags subBufferFlags = 0;
+    retVal = clGetMemObjectInfo(subBuffer, CL_MEM_FLAGS, sizeof(cl_mem_flags), &subBufferFlags, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_NE(0u, subBufferFlags & CL_MEM_READ_ONLY_HOST_PTR_INTEL);
+
+    auto pSubBuffer = castToObject<Buffer>(subBuffer);
+    EXPECT_TRUE(pSubBuffer->getGraphicsAllocation()->isReadOnlyHostMemory());
+    EXPECT_FALSE(pSubBuffer->isFillOnCpuPossible());
+
+    retVal = clEnqueueFillBuffer(pCommandQueue, subBuffer, &pattern, sizeof(pattern), 0, sizeof(pattern), 0, nullptr, nullptr);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+
+    retVal = clEnqueueCopyBuffer(pCommandQueue, otherBuffer, subBuffer, 0, 0, sizeof(pattern), 0, nullptr, nullptr);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+
+    retVal = clReleaseMemObject(subBuffer);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    retVal = clReleaseMemObject(otherBuffer);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    retVal = clReleaseMemObject(buffer);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    alignedFree(hostPtr);
+}
 } // namespace ULT
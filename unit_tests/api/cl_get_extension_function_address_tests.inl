@@ -51,4 +51,49 @@ TEST_F(clGetExtensionFunctionAddressTests, clSetPerformanceConfigurationINTEL) {
     auto retVal = clGetExtensionFunctionAddress("clSetPerformanceConfigurationINTEL");
     EXPECT_EQ(retVal, reinterpret_cast<void *>(clSetPerformanceConfigurationINTEL));
 }
+
+TEST_F(clGetExtensionFunctionAddressTests, clSetKernelArgsINTEL) {
+    auto retVal = clGetExtensionFunctionAddress("clSetKernelArgsINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clSetKernelArgsINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, clGetTelemetryDataINTEL) {
+    auto retVal = clGetExtensionFunctionAddress("clGetTelemetryDataINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clGetTelemetryDataINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, clCreateCommandTemplateINTEL) {
+    auto retVal = clGetExtensionFunctionAddress("clCreateCommandTemplateINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clCreateCommandTemplateINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, clCommandTemplateNDRangeKernelINTEL) {
+    auto retVal = clGetExtensionFunctionAddress("clCommandTemplateNDRangeKernelINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clCommandTemplateNDRangeKernelINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, clFinalizeCommandTemplateINTEL) {
+    auto retVal = clGetExtensionFunctionAddress("clFinalizeCommandTemplateINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clFinalizeCommandTemplateINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, clSetCommandTemplateGlobalWorkSizeINTEL) {
+    auto retVal = clGetExtensionFunctionAddress("clSetCommandTemplateGlobalWorkSizeINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clSetCommandTemplateGlobalWorkSizeINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, clEnqueueCommandTemplateINTEL) {
+    auto retVal = clGetExtensionFunctionAddress("clEnqueueCommandTemplateINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clEnqueueCommandTemplateINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, clRetainCommandTemplateINTEL) {
+    auto retVal = clGetExtensionFunctionAddress("clRetainCommandTemplateINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clRetainCommandTemplateINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, clReleaseCommandTemplateINTEL) {
+    auto retVal = clGetExtensionFunctionAddress("clReleaseCommandTemplateINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clReleaseCommandTemplateINTEL));
+}
 } // namespace ULT
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "cl_api_tests.h"
+#include "runtime/utilities/telemetry.h"
+
+using namespace OCLRT;
+
+typedef api_tests clGetTelemetryDataINTELTests;
+
+namespace ULT {
+
+TEST_F(clGetTelemetryDataINTELTests, givenNullDataWhenGettingTelemetryThenInvalidValueIsReturned) {
+    retVal = clGetTelemetryDataINTEL(CL_TELEMETRY_FLUSH_INTEL, nullptr);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+}
+
+TEST_F(clGetTelemetryDataINTELTests, givenUnknownCounterWhenGettingTelemetryThenInvalidValueIsReturned) {
+    cl_telemetry_data_intel data = {};
+    retVal = clGetTelemetryDataINTEL(Telemetry::countersCount, &data);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+}
+
+TEST_F(clGetTelemetryDataINTELTests, givenRecordedSamplesWhenGettingTelemetryThenCollectedDataIsReturned) {
+    auto wasEnabled = Telemetry::isEnabled();
+    Telemetry::setEnabled(true);
+    Telemetry::reset();
+    Telemetry::record(TelemetryCounter::Flush, 100);
+    Telemetry::record(TelemetryCounter::Flush, 300);
+
+    cl_telemetry_data_intel data = {};
+    retVal = clGetTelemetryDataINTEL(CL_TELEMETRY_FLUSH_INTEL, &data);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(2u, data.count);
+    EXPECT_EQ(400u, data.totalNanoseconds);
+    EXPECT_EQ(300u, data.maxNanoseconds);
+    EXPECT_EQ(1u, data.histogram[TelemetryHistogram::getBucketIndex(100)]);
+    EXPECT_EQ(1u, data.histogram[TelemetryHistogram::getBucketIndex(300)]);
+
+    Telemetry::reset();
+    Telemetry::setEnabled(wasEnabled);
+}
+} // namespace ULT
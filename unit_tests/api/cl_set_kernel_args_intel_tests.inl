@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "cl_api_tests.h"
+#include "unit_tests/fixtures/device_fixture.h"
+#include "unit_tests/mocks/mock_kernel.h"
+#include "test.h"
+
+using namespace OCLRT;
+
+class KernelArgsBatchFixture : public api_fixture, public DeviceFixture {
+  protected:
+    void SetUp() override {
+        api_fixture::SetUp();
+        DeviceFixture::SetUp();
+
+        pKernelInfo = std::make_unique<KernelInfo>();
+        kernelHeader.SurfaceStateHeapSize = sizeof(pSshLocal);
+        pKernelInfo->heapInfo.pSsh = pSshLocal;
+        pKernelInfo->heapInfo.pKernelHeader = &kernelHeader;
+
+        pKernelInfo->kernelArgInfo.resize(numArgs);
+        for (uint32_t i = 0; i < numArgs; i++) {
+            KernelArgPatchInfo kernelArgPatchInfo;
+            kernelArgPatchInfo.crossthreadOffset = i * sizeof(uint32_t);
+            kernelArgPatchInfo.size = sizeof(uint32_t);
+            pKernelInfo->kernelArgInfo[i].kernelArgPatchInfoVector.push_back(kernelArgPatchInfo);
+            pKernelInfo->kernelArgInfo[i].typeStr = "uint";
+        }
+
+        pMockKernel = new MockKernel(pProgram, *pKernelInfo, *pPlatform->getDevice(0));
+        ASSERT_EQ(CL_SUCCESS, pMockKernel->initialize());
+        pMockKernel->setCrossThreadData(pCrossThreadData, sizeof(pCrossThreadData));
+    }
+
+    void TearDown() override {
+        delete pMockKernel;
+
+        DeviceFixture::TearDown();
+        api_fixture::TearDown();
+    }
+
+    static const uint32_t numArgs = 4;
+    cl_int retVal = CL_SUCCESS;
+    MockKernel *pMockKernel = nullptr;
+    std::unique_ptr<KernelInfo> pKernelInfo;
+    SKernelBinaryHeaderCommon kernelHeader;
+    char pSshLocal[64];
+    uint32_t pCrossThreadData[numArgs] = {};
+};
+
+typedef Test<KernelArgsBatchFixture> clSetKernelArgsINTELTests;
+
+namespace ULT {
+
+TEST_F(clSetKernelArgsINTELTests, givenInvalidKernelWhenSettingArgsThenInvalidKernelIsReturned) {
+    cl_uint argIndex = 0;
+    size_t argSize = sizeof(uint32_t);
+    uint32_t argValue = 1;
+    const void *argValues[] = {&argValue};
+
+    retVal = clSetKernelArgsINTEL(nullptr, 1, &argIndex, &argSize, argValues);
+    EXPECT_EQ(CL_INVALID_KERNEL, retVal);
+}
+
+TEST_F(clSetKernelArgsINTELTests, givenNoArgsWhenSettingArgsThenInvalidValueIsReturned) {
+    retVal = clSetKernelArgsINTEL(pMockKernel, 0, nullptr, nullptr, nullptr);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+}
+
+TEST_F(clSetKernelArgsINTELTests, givenAllArgsWhenSettingArgsThenCrossThreadDataIsPatchedAndKernelIsPatched) {
+    cl_uint argIndices[numArgs] = {3, 2, 1, 0};
+    size_t argSizes[numArgs];
+    uint32_t values[numArgs];
+    const void *argValues[numArgs];
+    for (uint32_t i = 0; i < numArgs; i++) {
+        argSizes[i] = sizeof(uint32_t);
+        values[i] = 0x100 + argIndices[i];
+        argValues[i] = &values[i];
+    }
+
+    EXPECT_FALSE(pMockKernel->isPatched());
+    retVal = clSetKernelArgsINTEL(pMockKernel, numArgs, argIndices, argSizes, argValues);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(pMockKernel->isPatched());
+
+    auto crossThreadData = reinterpret_cast<uint32_t *>(pMockKernel->getCrossThreadData());
+    for (uint32_t i = 0; i < numArgs; i++) {
+        EXPECT_EQ(0x100 + i, crossThreadData[i]);
+    }
+}
+
+TEST_F(clSetKernelArgsINTELTests, givenInvalidArgIndexInBatchWhenSettingArgsThenPrecedingArgsAreSetAndInvalidArgIndexIsReturned) {
+    cl_uint argIndices[] = {0, numArgs};
+    size_t argSizes[] = {sizeof(uint32_t), sizeof(uint32_t)};
+    uint32_t value = 0x200;
+    const void *argValues[] = {&value, &value};
+
+    retVal = clSetKernelArgsINTEL(pMockKernel, 2, argIndices, argSizes, argValues);
+    EXPECT_EQ(CL_INVALID_ARG_INDEX, retVal);
+    EXPECT_TRUE(pMockKernel->getKernelArguments()[0].isPatched);
+    EXPECT_EQ(0x200u, *reinterpret_cast<uint32_t *>(pMockKernel->getCrossThreadData()));
+}
+
+TEST_F(clSetKernelArgsINTELTests, givenNullArgValueWhenSettingArgsThenErrorFromArgHandlerIsReturned) {
+    cl_uint argIndex = 1;
+    size_t argSize = sizeof(uint32_t);
+    const void *argValues[] = {nullptr};
+
+    retVal = clSetKernelArgsINTEL(pMockKernel, 1, &argIndex, &argSize, argValues);
+    EXPECT_EQ(CL_INVALID_ARG_VALUE, retVal);
+    EXPECT_FALSE(pMockKernel->getKernelArguments()[1].isPatched);
+}
+} // namespace ULT
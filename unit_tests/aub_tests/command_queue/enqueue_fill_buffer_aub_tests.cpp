@@ -59,6 +59,7 @@ HWTEST_P(AUBFillBuffer, simple) {
         pDestMemory,
         retVal);
     ASSERT_NE(nullptr, destBuffer);
+    destBuffer->forceDisallowCPUCopy = true;
 
     float pattern[] = {1.0f};
     size_t patternSize = sizeof(pattern);
@@ -37,6 +37,7 @@ HWTEST_F(AUBMapBuffer, MapUpdateUnmapVerify) {
         nullptr,
         retVal));
     ASSERT_NE(nullptr, buffer);
+    buffer->forceDisallowCPUCopy = true;
 
     uint8_t pattern[] = {0xFF};
     size_t patternSize = sizeof(pattern);
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/command_queue.h"
+#include "runtime/helpers/task_information.h"
+#include "unit_tests/mocks/mock_command_queue.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+struct CountingCommand : public Command {
+    CompletionStamp &submit(uint32_t taskLevel, bool terminated) override {
+        submitCount++;
+        submittingThread = std::this_thread::get_id();
+        completionStamp.taskCount = ++(*queueTaskCount);
+        return completionStamp;
+    }
+    uint32_t *queueTaskCount = nullptr;
+    uint32_t submitCount = 0;
+    std::thread::id submittingThread;
+};
+
+TEST(BlockedCommandSubmissionMt, givenManyThreadsSubmittingUnblockedCommandsToOneQueueThenEachCommandIsSubmittedOnceWithUniqueTaskCount) {
+    const uint32_t threadCount = 8;
+    const uint32_t commandsPerThread = 2000;
+
+    MockContext context;
+    MockCommandQueue cmdQ(&context, context.getDevice(0), 0);
+    uint32_t queueTaskCount = 0;
+
+    std::vector<std::unique_ptr<CountingCommand>> commands;
+    for (uint32_t i = 0; i < threadCount * commandsPerThread; i++) {
+        commands.emplace_back(new CountingCommand);
+        commands.back()->queueTaskCount = &queueTaskCount;
+    }
+
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < threadCount; t++) {
+        threads.emplace_back([&, t]() {
+            while (!start)
+                ;
+            for (uint32_t i = 0; i < commandsPerThread; i++) {
+                auto &command = *commands[t * commandsPerThread + i];
+                auto &completionStamp = cmdQ.submitUnblockedCommand(command, 0, false);
+                EXPECT_NE(0u, completionStamp.taskCount);
+            }
+        });
+    }
+    start = true;
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    std::vector<bool> taskCountUsed(threadCount * commandsPerThread + 1, false);
+    for (auto &command : commands) {
+        EXPECT_EQ(1u, command->submitCount);
+        ASSERT_LE(command->completionStamp.taskCount, threadCount * commandsPerThread);
+        EXPECT_FALSE(taskCountUsed[command->completionStamp.taskCount]);
+        taskCountUsed[command->completionStamp.taskCount] = true;
+    }
+    for (uint32_t i = 0; i < threadCount * commandsPerThread; i++) {
+        if (i % commandsPerThread != 0) {
+            EXPECT_LT(commands[i - 1]->completionStamp.taskCount, commands[i]->completionStamp.taskCount);
+        }
+    }
+    EXPECT_EQ(threadCount * commandsPerThread, queueTaskCount);
+    EXPECT_TRUE(cmdQ.readyCommands.peekIsEmpty());
+}
+
+struct GatedCountingCommand : public CountingCommand {
+    CompletionStamp &submit(uint32_t taskLevel, bool terminated) override {
+        entered = true;
+        while (!released)
+            ;
+        return CountingCommand::submit(taskLevel, terminated);
+    }
+    std::atomic<bool> entered{false};
+    std::atomic<bool> released{false};
+};
+
+TEST(BlockedCommandSubmissionMt, givenThreadSubmittingReadyListWhenOtherThreadSubmitsUnblockedCommandThenItIsNotDrainedByThatThreadButSubmittedByItsProducer) {
+    MockContext context;
+    MockCommandQueue cmdQ(&context, context.getDevice(0), 0);
+    uint32_t queueTaskCount = 0;
+
+    GatedCountingCommand gatedCommand;
+    gatedCommand.queueTaskCount = &queueTaskCount;
+    CountingCommand waitingCommand;
+    waitingCommand.queueTaskCount = &queueTaskCount;
+
+    std::thread submitter([&]() {
+        cmdQ.submitUnblockedCommand(gatedCommand, 0, false);
+    });
+    while (!gatedCommand.entered)
+        ;
+
+    std::thread::id waiterThread;
+    std::thread waiter([&]() {
+        waiterThread = std::this_thread::get_id();
+        cmdQ.submitUnblockedCommand(waitingCommand, 0, false);
+    });
+    while (cmdQ.readyCommands.peekIsEmpty())
+        ;
+    EXPECT_FALSE(waitingCommand.submitted);
+
+    gatedCommand.released = true;
+    submitter.join();
+    waiter.join();
+
+    EXPECT_EQ(1u, waitingCommand.submitCount);
+    EXPECT_EQ(waiterThread, waitingCommand.submittingThread);
+    EXPECT_EQ(2u, waitingCommand.completionStamp.taskCount);
+    EXPECT_TRUE(cmdQ.readyCommands.peekIsEmpty());
+}
+
+TEST(BlockedCommandSubmissionMt, givenThreadOwningCsrAndQueueWhenOtherThreadWaitsForCsrAndOwnerSubmitsUnblockedCommandThenItIsSubmittedDirectly) {
+    MockContext context;
+    MockCommandQueue cmdQ(&context, context.getDevice(0), 0);
+    uint32_t queueTaskCount = 0;
+
+    CountingCommand ownerCommand;
+    ownerCommand.queueTaskCount = &queueTaskCount;
+    CountingCommand waitingCommand;
+    waitingCommand.queueTaskCount = &queueTaskCount;
+
+    auto &commandStreamReceiver = cmdQ.getDevice().getCommandStreamReceiver();
+    auto commandStreamReceiverOwnership = commandStreamReceiver.obtainUniqueOwnership();
+    TakeOwnershipWrapper<CommandQueue> queueOwnership(cmdQ);
+
+    std::thread waiter([&]() {
+        cmdQ.submitUnblockedCommand(waitingCommand, 0, false);
+    });
+    while (cmdQ.readyCommands.peekIsEmpty())
+        ;
+
+    cmdQ.submitUnblockedCommand(ownerCommand, 0, false);
+    EXPECT_TRUE(ownerCommand.submitted);
+    EXPECT_EQ(std::this_thread::get_id(), ownerCommand.submittingThread);
+
+    queueOwnership.unlock();
+    commandStreamReceiverOwnership.unlock();
+    waiter.join();
+
+    EXPECT_EQ(1u, ownerCommand.submitCount);
+    EXPECT_EQ(1u, waitingCommand.submitCount);
+    EXPECT_TRUE(cmdQ.readyCommands.peekIsEmpty());
+}
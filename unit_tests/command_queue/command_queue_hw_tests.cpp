@@ -11,6 +11,7 @@
 #include "runtime/command_queue/enqueue_common.h"
 #include "runtime/event/event.h"
 #include "runtime/event/event_builder.h"
+#include "runtime/event/user_event.h"
 #include "runtime/helpers/queue_helpers.h"
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/memory_manager/surface.h"
@@ -20,11 +21,13 @@
 #include "unit_tests/fixtures/device_fixture.h"
 #include "unit_tests/gen_common/matchers.h"
 #include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/helpers/hw_parse.h"
 #include "unit_tests/helpers/memory_management.h"
 #include "unit_tests/mocks/mock_buffer.h"
 #include "unit_tests/mocks/mock_command_queue.h"
 #include "unit_tests/mocks/mock_context.h"
 #include "unit_tests/mocks/mock_csr.h"
+#include "unit_tests/mocks/mock_device.h"
 #include "unit_tests/mocks/mock_gmm.h"
 #include "unit_tests/mocks/mock_event.h"
 #include "unit_tests/mocks/mock_kernel.h"
@@ -1138,3 +1141,91 @@ HWTEST_F(ReducedAddrSpaceCommandQueueHwTest,
     bool result = mockCmdQ->createAllocationForHostSurface(surface);
     EXPECT_FALSE(result);
 }
+
+struct CrossCsrDependencyTest : public ::testing::Test {
+    void SetUp() override {
+        executionEnvironment.incRefInternal();
+        device = std::unique_ptr<MockDevice>(Device::create<MockDevice>(nullptr, &executionEnvironment, 0u));
+        device2 = std::unique_ptr<MockDevice>(Device::create<MockDevice>(nullptr, &executionEnvironment, 1u));
+        context = std::make_unique<MockContext>(device.get());
+        context2 = std::make_unique<MockContext>(device2.get());
+        kernel = std::make_unique<MockKernelWithInternals>(*device, context.get());
+    }
+
+    ExecutionEnvironment executionEnvironment;
+    std::unique_ptr<MockDevice> device;
+    std::unique_ptr<MockDevice> device2;
+    std::unique_ptr<MockContext> context;
+    std::unique_ptr<MockContext> context2;
+    std::unique_ptr<MockKernelWithInternals> kernel;
+    const size_t gws[3] = {1, 1, 1};
+};
+
+HWTEST_F(CrossCsrDependencyTest, givenEventFromOtherCsrWhenEnqueueingThenSemaphoreOnItsTagIsProgrammedOnCsrStream) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+
+    auto cmdQ1 = std::make_unique<MockCommandQueueHw<FamilyType>>(context.get(), device.get(), nullptr);
+    auto cmdQ2 = std::make_unique<MockCommandQueueHw<FamilyType>>(context2.get(), device2.get(), nullptr);
+
+    UserEvent userEvent;
+    userEvent.setStatus(CL_COMPLETE);
+    Event sameCsrEvent(cmdQ1.get(), CL_COMMAND_NDRANGE_KERNEL, 0, 3);
+    Event otherCsrEvent(cmdQ2.get(), CL_COMMAND_NDRANGE_KERNEL, 0, 5);
+    cl_event waitlist[] = {&userEvent, &sameCsrEvent, &otherCsrEvent};
+
+    auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
+    csr.storeMakeResidentAllocations = true;
+    cmdQ1->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 3, waitlist, nullptr);
+
+    auto &csr2 = device2->getUltCommandStreamReceiver<FamilyType>();
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(csr.commandStream, 0);
+    auto semaphores = 0u;
+    for (auto it = hwParser.cmdList.begin(); it != hwParser.cmdList.end(); it++) {
+        auto semaphoreCmd = genCmdCast<MI_SEMAPHORE_WAIT *>(*it);
+        if (semaphoreCmd) {
+            semaphores++;
+            EXPECT_EQ(MI_SEMAPHORE_WAIT::COMPARE_OPERATION::COMPARE_OPERATION_SAD_GREATER_THAN_OR_EQUAL_SDD, semaphoreCmd->getCompareOperation());
+            EXPECT_EQ(5u, semaphoreCmd->getSemaphoreDataDword());
+            EXPECT_EQ(csr2.getTagAllocation()->getGpuAddress(), semaphoreCmd->getSemaphoreGraphicsAddress());
+        }
+    }
+    EXPECT_EQ(1u, semaphores);
+    EXPECT_TRUE(csr.isMadeResident(csr2.getTagAllocation()));
+}
+
+HWTEST_F(CrossCsrDependencyTest, givenEventFromOtherCsrWhenEnqueueingThenBatchedSubmissionsOfThatCsrAreFlushed) {
+    auto cmdQ1 = std::make_unique<MockCommandQueueHw<FamilyType>>(context.get(), device.get(), nullptr);
+    auto cmdQ2 = std::make_unique<MockCommandQueueHw<FamilyType>>(context2.get(), device2.get(), nullptr);
+
+    Event sameCsrEvent(cmdQ1.get(), CL_COMMAND_NDRANGE_KERNEL, 0, 3);
+    cl_event waitlist[] = {&sameCsrEvent};
+    cmdQ1->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 1, waitlist, nullptr);
+    EXPECT_FALSE(device2->getUltCommandStreamReceiver<FamilyType>().flushBatchedSubmissionsCalled);
+
+    Event otherCsrEvent(cmdQ2.get(), CL_COMMAND_NDRANGE_KERNEL, 0, 5);
+    waitlist[0] = &otherCsrEvent;
+    cmdQ1->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 1, waitlist, nullptr);
+    EXPECT_TRUE(device2->getUltCommandStreamReceiver<FamilyType>().flushBatchedSubmissionsCalled);
+}
+
+HWTEST_F(CrossCsrDependencyTest, givenWaitListWithoutEventsFromOtherCsrWhenEnqueueingThenOutOfDeviceDependenciesAreNotPassedToCsr) {
+    auto mockCsr = new MockCsrHw2<FamilyType>(device->getHardwareInfo(), executionEnvironment);
+    device->resetCommandStreamReceiver(mockCsr);
+    mockCsr->timestampPacketWriteEnabled = false;
+
+    auto cmdQ1 = std::make_unique<MockCommandQueueHw<FamilyType>>(context.get(), device.get(), nullptr);
+    auto cmdQ2 = std::make_unique<MockCommandQueueHw<FamilyType>>(context2.get(), device2.get(), nullptr);
+
+    UserEvent userEvent;
+    userEvent.setStatus(CL_COMPLETE);
+    Event sameCsrEvent(cmdQ1.get(), CL_COMMAND_NDRANGE_KERNEL, 0, 3);
+    cl_event waitlist[] = {&userEvent, &sameCsrEvent};
+    cmdQ1->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 2, waitlist, nullptr);
+    EXPECT_EQ(nullptr, mockCsr->passedDispatchFlags.outOfDeviceDependencies);
+
+    Event otherCsrEvent(cmdQ2.get(), CL_COMMAND_NDRANGE_KERNEL, 0, 5);
+    waitlist[1] = &otherCsrEvent;
+    cmdQ1->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 2, waitlist, nullptr);
+    EXPECT_NE(nullptr, mockCsr->passedDispatchFlags.outOfDeviceDependencies);
+}
@@ -6,6 +6,7 @@
  */
 
 #include "hw_cmds.h"
+#include "runtime/built_ins/builtins_dispatch_builder.h"
 #include "runtime/command_queue/command_queue_hw.h"
 #include "runtime/command_stream/command_stream_receiver.h"
 #include "runtime/memory_manager/memory_manager.h"
@@ -21,6 +22,7 @@
 #include "unit_tests/fixtures/memory_management_fixture.h"
 #include "unit_tests/fixtures/buffer_fixture.h"
 #include "unit_tests/libult/ult_command_stream_receiver.h"
+#include "unit_tests/mocks/mock_builtin_dispatch_info_builder.h"
 #include "unit_tests/mocks/mock_memory_manager.h"
 #include "unit_tests/mocks/mock_command_queue.h"
 #include "unit_tests/mocks/mock_context.h"
@@ -950,3 +952,121 @@ HWTEST_F(CommandQueueCommandStreamTest, givenCsrWithDebugSurfaceAllocatedWhenSet
     RENDER_SURFACE_STATE *surfaceState = (RENDER_SURFACE_STATE *)kernel->getSurfaceStateHeap();
     EXPECT_EQ(debugSurface->getGpuAddress(), surfaceState->getSurfaceBaseAddress());
 }
+
+struct ReadyListCommand : public Command {
+    CompletionStamp &submit(uint32_t taskLevel, bool terminated) override {
+        submittedTaskLevel = taskLevel;
+        submittedTerminated = terminated;
+        submitOrder = (*submitCounter)++;
+        return completionStamp;
+    }
+    uint32_t *submitCounter = nullptr;
+    uint32_t submitOrder = 0;
+    uint32_t submittedTaskLevel = 0;
+    bool submittedTerminated = false;
+};
+
+TEST(CommandQueue, givenUnblockedCommandWhenSubmittedThroughQueueThenCommandIsSubmittedWithItsArgumentsAndStampIsReturned) {
+    MockContext context;
+    MockCommandQueue cmdQ(&context, context.getDevice(0), 0);
+    uint32_t submitCounter = 0;
+    ReadyListCommand command;
+    command.submitCounter = &submitCounter;
+    command.completionStamp.taskCount = 5;
+
+    auto &completionStamp = cmdQ.submitUnblockedCommand(command, 3, true);
+
+    EXPECT_EQ(&command.completionStamp, &completionStamp);
+    EXPECT_EQ(5u, completionStamp.taskCount);
+    EXPECT_EQ(3u, command.submittedTaskLevel);
+    EXPECT_TRUE(command.submittedTerminated);
+    EXPECT_TRUE(command.submitted);
+    EXPECT_EQ(1u, submitCounter);
+    EXPECT_TRUE(cmdQ.readyCommands.peekIsEmpty());
+}
+
+TEST(CommandQueue, givenCommandsWaitingOnReadyListWhenCommandIsSubmittedThroughQueueThenAllAreSubmittedInReadyOrder) {
+    MockContext context;
+    MockCommandQueue cmdQ(&context, context.getDevice(0), 0);
+    uint32_t submitCounter = 0;
+    ReadyListCommand commands[3];
+    for (auto &command : commands) {
+        command.submitCounter = &submitCounter;
+    }
+    cmdQ.readyCommands.pushFrontOne(commands[0]);
+    cmdQ.readyCommands.pushFrontOne(commands[1]);
+
+    cmdQ.submitUnblockedCommand(commands[2], 0, false);
+
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_TRUE(commands[i].submitted);
+        EXPECT_EQ(i, commands[i].submitOrder);
+    }
+    EXPECT_TRUE(cmdQ.readyCommands.peekIsEmpty());
+}
+
+TEST(CommandQueue, givenBlockingCommandWhenSubmittedThroughQueueThenItIsSubmittedDirectlyAndReadyListIsLeftForItsProducers) {
+    struct BlockingReadyListCommand : public ReadyListCommand {
+        bool isBlocking() const override {
+            return true;
+        }
+    };
+    MockContext context;
+    MockCommandQueue cmdQ(&context, context.getDevice(0), 0);
+    uint32_t submitCounter = 0;
+    ReadyListCommand readyCommand;
+    readyCommand.submitCounter = &submitCounter;
+    BlockingReadyListCommand blockingCommand;
+    blockingCommand.submitCounter = &submitCounter;
+    cmdQ.readyCommands.pushFrontOne(readyCommand);
+
+    auto &completionStamp = cmdQ.submitUnblockedCommand(blockingCommand, 2, false);
+
+    EXPECT_EQ(&blockingCommand.completionStamp, &completionStamp);
+    EXPECT_EQ(2u, blockingCommand.submittedTaskLevel);
+    EXPECT_EQ(1u, submitCounter);
+    EXPECT_EQ(&readyCommand, cmdQ.readyCommands.detachNodes());
+}
+
+TEST(CommandQueue, givenTwoQueuesWhenAskingForBuiltinDispatchInfoBuilderThenEachQueueGetsOwnKernelsCreatedFromSharedProgram) {
+    MockContext context;
+    auto device = context.getDevice(0);
+    MockCommandQueue cmdQ1(&context, device, 0);
+    MockCommandQueue cmdQ2(&context, device, 0);
+    auto &sharedBuilder = device->getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer, context, *device);
+
+    auto &builder1 = cmdQ1.getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer);
+    auto &builder2 = cmdQ2.getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer);
+    EXPECT_EQ(&builder1, &cmdQ1.getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer));
+    EXPECT_NE(&builder1, &builder2);
+    EXPECT_NE(&sharedBuilder, &builder1);
+
+    ASSERT_EQ(sharedBuilder.peekUsedKernels().size(), builder1.peekUsedKernels().size());
+    ASSERT_EQ(sharedBuilder.peekUsedKernels().size(), builder2.peekUsedKernels().size());
+    for (size_t i = 0; i < sharedBuilder.peekUsedKernels().size(); i++) {
+        auto sharedKernel = sharedBuilder.peekUsedKernels()[i].get();
+        auto kernel1 = builder1.peekUsedKernels()[i].get();
+        auto kernel2 = builder2.peekUsedKernels()[i].get();
+        EXPECT_NE(sharedKernel, kernel1);
+        EXPECT_NE(kernel1, kernel2);
+        EXPECT_EQ(sharedKernel->getProgram(), kernel1->getProgram());
+        EXPECT_EQ(&sharedKernel->getKernelInfo(), &kernel2->getKernelInfo());
+    }
+}
+
+TEST(CommandQueue, givenBuilderSubstitutedInBuiltInsWhenQueueAsksForBuiltinDispatchInfoBuilderThenSubstitutedBuilderIsReturned) {
+    MockContext context;
+    auto device = context.getDevice(0);
+    MockCommandQueue cmdQ(&context, device, 0);
+    auto builtIns = device->getExecutionEnvironment()->getBuiltIns();
+
+    auto &originalBuilder = builtIns->getBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer, context, *device);
+    EXPECT_TRUE(originalBuilder.isCloneable());
+    auto oldBuilder = builtIns->setBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer, context, *device,
+                                                              std::unique_ptr<BuiltinDispatchInfoBuilder>(new MockBuiltinDispatchInfoBuilder(*builtIns, &originalBuilder)));
+    auto &mockBuilder = builtIns->getBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer, context, *device);
+    EXPECT_FALSE(mockBuilder.isCloneable());
+    EXPECT_EQ(&mockBuilder, &cmdQ.getBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer));
+
+    builtIns->setBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer, context, *device, std::move(oldBuilder));
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/command_queue_hw.h"
+#include "runtime/command_queue/command_template.h"
+#include "runtime/event/user_event.h"
+#include "runtime/mem_obj/buffer.h"
+#include "unit_tests/fixtures/hello_world_fixture.h"
+#include "unit_tests/helpers/hw_parse.h"
+#include "test.h"
+
+#include <vector>
+
+using namespace OCLRT;
+
+struct EnqueueCommandTemplateTest : public HelloWorldTest<HelloWorldFixtureFactory>,
+                                    public HardwareParse {
+    typedef HelloWorldTest<HelloWorldFixtureFactory> Parent;
+
+    void SetUp() override {
+        Parent::SetUp();
+        HardwareParse::SetUp();
+    }
+
+    void TearDown() override {
+        HardwareParse::TearDown();
+        Parent::TearDown();
+    }
+
+    template <typename FamilyType>
+    std::unique_ptr<CommandQueueHw<FamilyType>> createQueueOnKernelContext() {
+        // templates record kernels of queue's context only
+        return std::make_unique<CommandQueueHw<FamilyType>>(KernelFixture::pContext, pDevice, nullptr);
+    }
+
+    CommandTemplate *createTemplate(CommandQueue &commandQueue) {
+        cl_int retVal = CL_SUCCESS;
+        auto commandTemplate = CommandTemplate::create(&commandQueue, retVal);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        size_t globalWorkSize[3] = {64, 1, 1};
+        size_t localWorkSize[3] = {16, 1, 1};
+        EXPECT_EQ(CL_SUCCESS, commandTemplate->recordNDRangeKernel(*pKernel, 1, nullptr, globalWorkSize, localWorkSize));
+        EXPECT_EQ(CL_SUCCESS, commandTemplate->recordNDRangeKernel(*pKernel, 1, nullptr, globalWorkSize, localWorkSize));
+        EXPECT_EQ(CL_SUCCESS, commandTemplate->finalize());
+        return commandTemplate;
+    }
+};
+
+HWTEST_F(EnqueueCommandTemplateTest, givenFinalizedTemplateWhenEnqueueingThenQueueJumpsToInstanceCommandBufferWithAllWalkers) {
+    typedef typename FamilyType::GPGPU_WALKER GPGPU_WALKER;
+    typedef typename FamilyType::MI_BATCH_BUFFER_START MI_BATCH_BUFFER_START;
+
+    auto commandQueue = createQueueOnKernelContext<FamilyType>();
+    auto commandTemplate = createTemplate(*commandQueue);
+    cl_event event = nullptr;
+
+    auto retVal = commandQueue->enqueueCommandTemplate(*commandTemplate, 0, nullptr, &event);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_NE(nullptr, event);
+    EXPECT_EQ(1u, commandTemplate->getInstancesCount());
+    EXPECT_EQ(commandQueue->taskCount, commandTemplate->getOldestInstanceTaskCount());
+
+    HardwareParse::parseCommands<FamilyType>(commandQueue->getCS(0), 0);
+    EXPECT_EQ(cmdList.end(), find<GPGPU_WALKER *>(cmdList.begin(), cmdList.end()));
+    auto itorBatchBufferStart = find<MI_BATCH_BUFFER_START *>(cmdList.begin(), cmdList.end());
+    ASSERT_NE(cmdList.end(), itorBatchBufferStart);
+
+    *pDevice->getCommandStreamReceiver().getTagAddress() = commandQueue->taskCount;
+    auto instance = commandTemplate->obtainIdleInstance(commandQueue->taskCount);
+    ASSERT_NE(nullptr, instance);
+    auto batchBufferStart = genCmdCast<MI_BATCH_BUFFER_START *>(*itorBatchBufferStart);
+    EXPECT_EQ(instance->commandStream->getGraphicsAllocation()->getGpuAddress(), batchBufferStart->getBatchBufferStartAddressGraphicsaddress472());
+
+    HardwareParse instanceParse;
+    instanceParse.parseCommands<FamilyType>(*instance->commandStream);
+    auto &instanceCmdList = instanceParse.cmdList;
+    size_t walkersCount = 0;
+    for (auto itorWalker = find<GPGPU_WALKER *>(instanceCmdList.begin(), instanceCmdList.end()); itorWalker != instanceCmdList.end();
+         itorWalker = find<GPGPU_WALKER *>(++itorWalker, instanceCmdList.end())) {
+        walkersCount++;
+    }
+    EXPECT_EQ(2u, walkersCount);
+
+    castToObject<Event>(event)->release();
+    commandTemplate->release();
+}
+
+HWTEST_F(EnqueueCommandTemplateTest, givenCompletedInstanceWhenEnqueueingAgainThenInstanceIsReused) {
+    auto commandQueue = createQueueOnKernelContext<FamilyType>();
+    auto commandTemplate = createTemplate(*commandQueue);
+
+    EXPECT_EQ(CL_SUCCESS, commandQueue->enqueueCommandTemplate(*commandTemplate, 0, nullptr, nullptr));
+    auto firstTaskCount = commandQueue->taskCount;
+    *pDevice->getCommandStreamReceiver().getTagAddress() = firstTaskCount;
+
+    EXPECT_EQ(CL_SUCCESS, commandQueue->enqueueCommandTemplate(*commandTemplate, 0, nullptr, nullptr));
+    EXPECT_EQ(1u, commandTemplate->getInstancesCount());
+    EXPECT_LT(firstTaskCount, commandTemplate->getOldestInstanceTaskCount());
+
+    *pDevice->getCommandStreamReceiver().getTagAddress() = commandQueue->taskCount;
+    commandTemplate->release();
+}
+
+HWTEST_F(EnqueueCommandTemplateTest, givenInstanceInFlightWhenEnqueueingAgainThenNewInstanceIsProgrammed) {
+    auto commandQueue = createQueueOnKernelContext<FamilyType>();
+    auto commandTemplate = createTemplate(*commandQueue);
+    *pDevice->getCommandStreamReceiver().getTagAddress() = 0;
+
+    EXPECT_EQ(CL_SUCCESS, commandQueue->enqueueCommandTemplate(*commandTemplate, 0, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, commandQueue->enqueueCommandTemplate(*commandTemplate, 0, nullptr, nullptr));
+    EXPECT_EQ(2u, commandTemplate->getInstancesCount());
+
+    *pDevice->getCommandStreamReceiver().getTagAddress() = commandQueue->taskCount;
+    commandTemplate->release();
+}
+
+HWTEST_F(EnqueueCommandTemplateTest, givenChangedGlobalWorkSizeWhenEnqueueingThenStaleIdleInstanceIsReplaced) {
+    auto commandQueue = createQueueOnKernelContext<FamilyType>();
+    auto commandTemplate = createTemplate(*commandQueue);
+
+    EXPECT_EQ(CL_SUCCESS, commandQueue->enqueueCommandTemplate(*commandTemplate, 0, nullptr, nullptr));
+    *pDevice->getCommandStreamReceiver().getTagAddress() = commandQueue->taskCount;
+
+    size_t globalWorkSize[3] = {128, 1, 1};
+    EXPECT_EQ(CL_SUCCESS, commandTemplate->setGlobalWorkSize(1, globalWorkSize));
+    EXPECT_EQ(nullptr, commandTemplate->obtainIdleInstance(commandQueue->taskCount));
+    EXPECT_EQ(0u, commandTemplate->getInstancesCount());
+
+    EXPECT_EQ(CL_SUCCESS, commandQueue->enqueueCommandTemplate(*commandTemplate, 0, nullptr, nullptr));
+    EXPECT_EQ(1u, commandTemplate->getInstancesCount());
+
+    *pDevice->getCommandStreamReceiver().getTagAddress() = commandQueue->taskCount;
+    commandTemplate->release();
+}
+
+HWTEST_F(EnqueueCommandTemplateTest, givenBlockedWaitListWhenEnqueueingThenRecordedKernelsAreEnqueuedOneByOne) {
+    auto commandQueue = createQueueOnKernelContext<FamilyType>();
+    auto commandTemplate = createTemplate(*commandQueue);
+    UserEvent userEvent(KernelFixture::pContext);
+    cl_event waitList[] = {&userEvent};
+
+    EXPECT_EQ(CL_SUCCESS, commandQueue->enqueueCommandTemplate(*commandTemplate, 1, waitList, nullptr));
+    EXPECT_EQ(0u, commandTemplate->getInstancesCount());
+    EXPECT_TRUE(commandQueue->isQueueBlocked());
+
+    userEvent.setStatus(CL_COMPLETE);
+    EXPECT_FALSE(commandQueue->isQueueBlocked());
+    commandTemplate->release();
+}
+
+HWTEST_F(EnqueueCommandTemplateTest, givenKernelWithUnsetArgumentsWhenEnqueueingThenInvalidKernelArgsIsReturned) {
+    auto commandQueue = createQueueOnKernelContext<FamilyType>();
+    auto commandTemplate = createTemplate(*commandQueue);
+    pKernel->unsetArg(1);
+    cl_event event = reinterpret_cast<cl_event>(commandQueue.get());
+
+    EXPECT_EQ(CL_INVALID_KERNEL_ARGS, commandQueue->enqueueCommandTemplate(*commandTemplate, 0, nullptr, &event));
+    EXPECT_EQ(nullptr, event);
+    EXPECT_EQ(0u, commandTemplate->getInstancesCount());
+    commandTemplate->release();
+}
+
+HWTEST_F(EnqueueCommandTemplateTest, givenChangedKernelArgumentWhenReusedInstanceIsReplayedThenIndirectStateIsRebuiltAndCommandBufferIsNotReprogrammed) {
+    auto commandQueue = createQueueOnKernelContext<FamilyType>();
+    auto commandTemplate = createTemplate(*commandQueue);
+
+    EXPECT_EQ(CL_SUCCESS, commandQueue->enqueueCommandTemplate(*commandTemplate, 0, nullptr, nullptr));
+    *pDevice->getCommandStreamReceiver().getTagAddress() = commandQueue->taskCount;
+    auto instance = commandTemplate->obtainIdleInstance(commandQueue->taskCount);
+    ASSERT_NE(nullptr, instance);
+
+    auto copyUsed = [](auto &stream) {
+        auto base = reinterpret_cast<uint8_t *>(stream.getCpuBase());
+        return std::vector<uint8_t>(base, base + stream.getUsed());
+    };
+    auto commandBufferBefore = copyUsed(*instance->commandStream);
+    auto sshBefore = copyUsed(*instance->ssh);
+    auto iohBefore = copyUsed(*instance->ioh);
+
+    cl_int retVal = CL_SUCCESS;
+    std::unique_ptr<Buffer> otherBuffer(Buffer::create(BufferDefaults::context, CL_MEM_READ_WRITE, sizeUserMemory, nullptr, retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    EXPECT_NE(srcBuffer->getGraphicsAllocation()->getGpuAddress(), otherBuffer->getGraphicsAllocation()->getGpuAddress());
+    pKernel->setArg(0, otherBuffer.get());
+
+    EXPECT_EQ(CL_SUCCESS, commandQueue->enqueueCommandTemplate(*commandTemplate, 0, nullptr, nullptr));
+    EXPECT_EQ(1u, commandTemplate->getInstancesCount());
+    *pDevice->getCommandStreamReceiver().getTagAddress() = commandQueue->taskCount;
+    EXPECT_EQ(instance, commandTemplate->obtainIdleInstance(commandQueue->taskCount));
+
+    EXPECT_EQ(commandBufferBefore, copyUsed(*instance->commandStream));
+    auto sshChanged = sshBefore != copyUsed(*instance->ssh);
+    auto iohChanged = iohBefore != copyUsed(*instance->ioh);
+    EXPECT_TRUE(sshChanged || iohChanged);
+
+    pKernel->setArg(0, srcBuffer);
+    commandTemplate->release();
+}
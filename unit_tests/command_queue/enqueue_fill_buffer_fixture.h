@@ -8,6 +8,7 @@
 #pragma once
 #include "unit_tests/command_queue/command_enqueue_fixture.h"
 #include "unit_tests/command_queue/enqueue_fixture.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
 #include "gen_cmd_parse.h"
 #include "unit_tests/mocks/mock_context.h"
 
@@ -21,6 +22,8 @@ struct EnqueueFillBufferFixture : public CommandEnqueueFixture {
 
     virtual void SetUp() {
         CommandEnqueueFixture::SetUp();
+        // fills are validated on GPU path, CPU fill tests enable it explicitly
+        DebugManager.flags.DoCpuFillOnFillBuffer.set(0);
 
         BufferDefaults::context = new MockContext;
 
@@ -43,6 +46,7 @@ struct EnqueueFillBufferFixture : public CommandEnqueueFixture {
         parseCommands<FamilyType>(*pCmdQ);
     }
 
+    DebugManagerStateRestore dbgRestore;
     MockContext context;
     Buffer *buffer;
 };
@@ -13,9 +13,11 @@
 #include "runtime/helpers/ptr_math.h"
 #include "runtime/helpers/aligned_memory.h"
 #include "runtime/helpers/dispatch_info.h"
+#include "runtime/event/event.h"
 #include "unit_tests/command_queue/enqueue_fixture.h"
 #include "unit_tests/command_queue/enqueue_fill_buffer_fixture.h"
 #include "unit_tests/gen_common/gen_commands_common_validation.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
 #include "unit_tests/helpers/unit_test_helper.h"
 #include "runtime/memory_manager/memory_manager.h"
 #include "test.h"
@@ -502,3 +504,91 @@ HWTEST_F(EnqueueFillBufferCmdTests, givenEnqueueFillBufferWhenPatternAllocationI
 
     EXPECT_EQ(GraphicsAllocation::AllocationType::FILL_PATTERN, patternAllocation->getAllocationType());
 }
+
+HWTEST_F(EnqueueFillBufferCmdTests, givenDefaultCpuFillModeAndIdleQueueWhenFillingSmallZeroCopyBufferThenBufferIsFilledOnCpuWithoutCommands) {
+    DebugManager.flags.DoCpuFillOnFillBuffer.set(-1);
+
+    auto dstBuffer = std::unique_ptr<Buffer>(BufferHelper<>::create());
+    ASSERT_TRUE(dstBuffer->isMemObjZeroCopy());
+    auto usedCmdBufferBefore = pCS->getUsed();
+    auto taskCountBefore = pCmdQ->taskCount;
+
+    const uint16_t pattern = 0x1234;
+    const size_t size = 4 * sizeof(pattern);
+    cl_event event = nullptr;
+    auto retVal = pCmdQ->enqueueFillBuffer(dstBuffer.get(), &pattern, sizeof(pattern), sizeof(pattern), size, 0, nullptr, &event);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(usedCmdBufferBefore, pCS->getUsed());
+    EXPECT_EQ(taskCountBefore, pCmdQ->taskCount);
+
+    auto filledMemory = reinterpret_cast<uint16_t *>(ptrOffset(dstBuffer->getCpuAddressForMemoryTransfer(), sizeof(pattern)));
+    for (size_t i = 0; i < size / sizeof(pattern); i++) {
+        EXPECT_EQ(pattern, filledMemory[i]);
+    }
+
+    auto pEvent = castToObject<Event>(event);
+    ASSERT_NE(nullptr, pEvent);
+    EXPECT_EQ(static_cast<cl_command_type>(CL_COMMAND_FILL_BUFFER), pEvent->getCommandType());
+    EXPECT_TRUE(pEvent->updateStatusAndCheckCompletion());
+    pEvent->release();
+}
+
+HWTEST_F(EnqueueFillBufferCmdTests, givenDefaultCpuFillModeAndBusyQueueWhenFillingSmallZeroCopyBufferThenFillIsEnqueuedOnGpu) {
+    DebugManager.flags.DoCpuFillOnFillBuffer.set(-1);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    pCmdQ->taskCount = *csr.getTagAddress() + 1;
+    auto taskCountBefore = pCmdQ->taskCount;
+
+    const uint32_t pattern = 0x12345678;
+    auto retVal = pCmdQ->enqueueFillBuffer(buffer, &pattern, sizeof(pattern), 0, sizeof(pattern), 0, nullptr, nullptr);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    EXPECT_LT(taskCountBefore, pCmdQ->taskCount);
+
+    *csr.getTagAddress() = pCmdQ->taskCount;
+}
+
+HWTEST_F(EnqueueFillBufferCmdTests, givenDefaultCpuFillModeWhenFillingAboveCpuFillLimitThenFillIsEnqueuedOnGpu) {
+    DebugManager.flags.DoCpuFillOnFillBuffer.set(-1);
+    cl_int retVal = CL_SUCCESS;
+    auto dstBuffer = std::unique_ptr<Buffer>(Buffer::create(BufferDefaults::context, CL_MEM_READ_WRITE, 2 * Buffer::maxBufferSizeForFillOnCpu, nullptr, retVal));
+    ASSERT_NE(nullptr, dstBuffer);
+    ASSERT_TRUE(dstBuffer->isMemObjZeroCopy());
+    auto taskCountBefore = pCmdQ->taskCount;
+
+    const uint32_t pattern = 0x12345678;
+    retVal = pCmdQ->enqueueFillBuffer(dstBuffer.get(), &pattern, sizeof(pattern), 0, Buffer::maxBufferSizeForFillOnCpu + sizeof(pattern), 0, nullptr, nullptr);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    EXPECT_LT(taskCountBefore, pCmdQ->taskCount);
+}
+
+HWTEST_F(EnqueueFillBufferCmdTests, givenForcedCpuFillWhenFillingAboveCpuFillLimitThenBufferIsFilledOnCpu) {
+    DebugManager.flags.DoCpuFillOnFillBuffer.set(1);
+    cl_int retVal = CL_SUCCESS;
+    auto dstBuffer = std::unique_ptr<Buffer>(Buffer::create(BufferDefaults::context, CL_MEM_READ_WRITE, 2 * Buffer::maxBufferSizeForFillOnCpu, nullptr, retVal));
+    ASSERT_NE(nullptr, dstBuffer);
+    ASSERT_TRUE(dstBuffer->isMemObjZeroCopy());
+    auto taskCountBefore = pCmdQ->taskCount;
+
+    const uint32_t pattern = 0x12345678;
+    const size_t size = 2 * Buffer::maxBufferSizeForFillOnCpu;
+    retVal = pCmdQ->enqueueFillBuffer(dstBuffer.get(), &pattern, sizeof(pattern), 0, size, 0, nullptr, nullptr);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCountBefore, pCmdQ->taskCount);
+
+    auto filledMemory = reinterpret_cast<uint32_t *>(dstBuffer->getCpuAddressForMemoryTransfer());
+    EXPECT_EQ(pattern, filledMemory[0]);
+    EXPECT_EQ(pattern, filledMemory[size / sizeof(pattern) - 1]);
+}
+
+TEST_F(EnqueueFillBufferCmdTests, givenZeroCopyBufferWhenCheckingIfFillOnCpuIsAllowedThenSizeAndWaitlistAreTakenIntoAccount) {
+    ASSERT_TRUE(buffer->isMemObjZeroCopy());
+    EXPECT_TRUE(buffer->isFillOnCpuAllowed(0, Buffer::maxBufferSizeForFillOnCpu));
+    EXPECT_FALSE(buffer->isFillOnCpuAllowed(0, Buffer::maxBufferSizeForFillOnCpu + 1));
+    EXPECT_FALSE(buffer->isFillOnCpuAllowed(1, sizeof(uint32_t)));
+    EXPECT_FALSE(buffer->isFillOnCpuAllowed(0, 0));
+
+    buffer->forceDisallowCPUCopy = true;
+    EXPECT_FALSE(buffer->isFillOnCpuPossible());
+    EXPECT_FALSE(buffer->isFillOnCpuAllowed(0, sizeof(uint32_t)));
+}
@@ -250,7 +250,9 @@ struct EnqueueFillBufferHelper {
     }
 
     static cl_int enqueue(CommandQueue *pCmdQ, void *placeholder = nullptr) {
-        return enqueueFillBuffer(pCmdQ);
+        auto buffer = std::unique_ptr<Buffer>(BufferHelper<>::create());
+        buffer->forceDisallowCPUCopy = true; // no task level logic when cpu fill
+        return enqueueFillBuffer(pCmdQ, buffer.get());
     }
 };
 
@@ -12,6 +12,7 @@
 #include "runtime/helpers/preamble.h"
 #include "runtime/memory_manager/graphics_allocation.h"
 #include "runtime/memory_manager/memory_constants.h"
+#include "runtime/memory_manager/scratch_space_manager.h"
 #include "runtime/utilities/tag_allocator.h"
 #include "unit_tests/command_queue/enqueue_fixture.h"
 #include "unit_tests/fixtures/hello_world_fixture.h"
@@ -358,6 +359,34 @@ HWTEST_F(EnqueueKernelTest, bumpsTaskLevel) {
     EXPECT_GT(pCmdQ->taskLevel, taskLevelBefore);
 }
 
+HWTEST_F(EnqueueKernelTest, givenKernelWithoutEventsAndPrintfWhenEnqueuedRepeatedlyThenEachEnqueueFlushesOneTaskWithSameCommandStreamSize) {
+    const uint32_t enqueueCount = 1000;
+    size_t globalWorkSize[3] = {64, 1, 1};
+    size_t localWorkSize[3] = {16, 1, 1};
+    MockKernelWithInternals mockKernel(*pDevice, context);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    auto retVal = clEnqueueNDRangeKernel(pCmdQ, mockKernel.mockKernel, 1, nullptr, globalWorkSize, localWorkSize, 0, nullptr, nullptr);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    auto usedBefore = pCS->getUsed();
+    retVal = clEnqueueNDRangeKernel(pCmdQ, mockKernel.mockKernel, 1, nullptr, globalWorkSize, localWorkSize, 0, nullptr, nullptr);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    auto usedPerEnqueue = pCS->getUsed() - usedBefore;
+    auto taskCountBefore = csr.peekTaskCount();
+
+    for (uint32_t i = 0; i < enqueueCount; i++) {
+        usedBefore = pCS->getUsed();
+        retVal = clEnqueueNDRangeKernel(pCmdQ, mockKernel.mockKernel, 1, nullptr, globalWorkSize, localWorkSize, 0, nullptr, nullptr);
+        ASSERT_EQ(CL_SUCCESS, retVal);
+        if (pCS->getUsed() > usedBefore) {
+            EXPECT_EQ(usedPerEnqueue, pCS->getUsed() - usedBefore);
+        }
+    }
+
+    EXPECT_EQ(taskCountBefore + enqueueCount, csr.peekTaskCount());
+    EXPECT_EQ(csr.peekTaskCount(), pCmdQ->taskCount);
+}
+
 HWTEST_F(EnqueueKernelTest, alignsToCSR) {
     //this test case assumes IOQ
     auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
@@ -549,7 +578,7 @@ HWCMDTEST_P(IGFX_GEN8_CORE, EnqueueScratchSpaceTests, GivenKernelRequiringScratc
     }
 
     auto allocationSize = scratchSize * pDevice->getDeviceInfo().computeUnitsUsedForScratch;
-    EXPECT_EQ(graphicsAllocation->getUnderlyingBufferSize(), allocationSize);
+    EXPECT_EQ(graphicsAllocation->getUnderlyingBufferSize(), ScratchSpaceManager::getSizeClass(allocationSize));
 
     // Generically validate this command
     PARSE::template validateCommand<MEDIA_VFE_STATE *>(cmdList.begin(), itorCmd);
@@ -600,7 +629,7 @@ HWCMDTEST_P(IGFX_GEN8_CORE, EnqueueScratchSpaceTests, GivenKernelRequiringScratc
         EXPECT_EQ(PreambleHelper<FamilyType>::getScratchSpaceOffsetFor64bit(), cmd2->getScratchSpaceBasePointer());
         EXPECT_NE(GSHaddress2, GSHaddress);
     }
-    EXPECT_EQ(graphicsAllocation->getUnderlyingBufferSize(), allocationSize);
+    EXPECT_EQ(graphicsAllocation->getUnderlyingBufferSize(), ScratchSpaceManager::getSizeClass(allocationSize));
     EXPECT_NE(graphicsAllocation2, graphicsAllocation);
 
     // Generically validate this command
@@ -1571,7 +1600,7 @@ struct EnqueueAuxKernelTests : public EnqueueKernelTest {
     template <typename FamilyType>
     class MyCmdQ : public CommandQueueHw<FamilyType> {
       public:
-        MyCmdQ(Context *context, Device *device) : CommandQueueHw<FamilyType>(context, device, nullptr) {}
+        MyCmdQ(Context *context, Device *device, const cl_queue_properties *properties = nullptr) : CommandQueueHw<FamilyType>(context, device, properties) {}
         void dispatchAuxTranslation(MultiDispatchInfo &multiDispatchInfo, BuffersForAuxTranslation &buffersForAuxTranslation,
                                     AuxTranslationDirection auxTranslationDirection) override {
             CommandQueueHw<FamilyType>::dispatchAuxTranslation(multiDispatchInfo, buffersForAuxTranslation, auxTranslationDirection);
@@ -1592,26 +1621,18 @@ struct EnqueueAuxKernelTests : public EnqueueKernelTest {
     };
 };
 
-HWTEST_F(EnqueueAuxKernelTests, givenKernelWithRequiredAuxTranslationWhenEnqueuedThenGuardKernelWithAuxTranslations) {
+HWTEST_F(EnqueueAuxKernelTests, givenKernelWithRequiredAuxTranslationAndNoCompressedBuffersWhenEnqueuedThenDontDispatchAuxTranslations) {
     MockKernelWithInternals mockKernel(*pDevice, context);
     MyCmdQ<FamilyType> cmdQ(context, pDevice);
     size_t gws[3] = {1, 0, 0};
 
     mockKernel.mockKernel->auxTranslationRequired = true;
     cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
-    EXPECT_EQ(2u, cmdQ.dispatchAuxTranslationInputs.size());
-
-    // before kernel
-    EXPECT_EQ(0u, std::get<size_t>(cmdQ.dispatchAuxTranslationInputs.at(0)));
-    EXPECT_EQ(AuxTranslationDirection::AuxToNonAux, std::get<AuxTranslationDirection>(cmdQ.dispatchAuxTranslationInputs.at(0)));
-
-    // after kernel
-    EXPECT_EQ(1u, std::get<size_t>(cmdQ.dispatchAuxTranslationInputs.at(1)));
-    EXPECT_EQ(AuxTranslationDirection::NonAuxToAux, std::get<AuxTranslationDirection>(cmdQ.dispatchAuxTranslationInputs.at(1)));
+    EXPECT_EQ(0u, cmdQ.dispatchAuxTranslationInputs.size());
 
     mockKernel.mockKernel->auxTranslationRequired = false;
     cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
-    EXPECT_EQ(2u, cmdQ.dispatchAuxTranslationInputs.size()); // not changed
+    EXPECT_EQ(0u, cmdQ.dispatchAuxTranslationInputs.size());
 }
 
 HWTEST_F(EnqueueAuxKernelTests, givenMultipleArgsWhenAuxTranslationIsRequiredThenPickOnlyApplicableBuffers) {
@@ -1650,12 +1671,12 @@ HWTEST_F(EnqueueAuxKernelTests, givenMultipleArgsWhenAuxTranslationIsRequiredThe
     mockKernel.mockKernel->kernelArguments.at(5).type = Kernel::kernelArgType::IMAGE_OBJ; // non-buffer arg - dont insert
 
     cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
-    EXPECT_EQ(2u, cmdQ.dispatchAuxTranslationInputs.size());
+    ASSERT_EQ(1u, cmdQ.dispatchAuxTranslationInputs.size());
     EXPECT_EQ(1u, std::get<BuffersForAuxTranslation>(cmdQ.dispatchAuxTranslationInputs.at(0)).size()); // before kernel
-    EXPECT_EQ(1u, std::get<BuffersForAuxTranslation>(cmdQ.dispatchAuxTranslationInputs.at(1)).size()); // after kernel
-
     EXPECT_EQ(&buffer2, *std::get<BuffersForAuxTranslation>(cmdQ.dispatchAuxTranslationInputs.at(0)).begin());
-    EXPECT_EQ(&buffer2, *std::get<BuffersForAuxTranslation>(cmdQ.dispatchAuxTranslationInputs.at(1)).begin());
+
+    EXPECT_EQ(GraphicsAllocation::AuxTranslationState::Resolved, buffer2.getGraphicsAllocation()->getAuxTranslationState());
+    EXPECT_EQ(GraphicsAllocation::AuxTranslationState::Compressed, buffer3.getGraphicsAllocation()->getAuxTranslationState());
 }
 
 HWTEST_F(EnqueueAuxKernelTests, givenKernelWithRequiredAuxTranslationWhenEnqueuedThenDispatchAuxTranslationBuiltin) {
@@ -1674,19 +1695,216 @@ HWTEST_F(EnqueueAuxKernelTests, givenKernelWithRequiredAuxTranslationWhenEnqueue
     mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMem);
 
     cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
-    EXPECT_EQ(2u, cmdQ.dispatchAuxTranslationInputs.size());
+    ASSERT_EQ(1u, cmdQ.dispatchAuxTranslationInputs.size());
 
-    // before kernel
     EXPECT_EQ(1u, std::get<size_t>(cmdQ.dispatchAuxTranslationInputs.at(0))); // aux before NDR
     auto kernelBefore = std::get<Kernel *>(cmdQ.dispatchAuxTranslationInputs.at(0));
     EXPECT_EQ("fullCopy", kernelBefore->getKernelInfo().name);
     EXPECT_TRUE(kernelBefore->isBuiltIn);
+    EXPECT_EQ(AuxTranslationDirection::AuxToNonAux, std::get<AuxTranslationDirection>(cmdQ.dispatchAuxTranslationInputs.at(0)));
+    EXPECT_EQ(GraphicsAllocation::AuxTranslationState::Resolved, buffer.getGraphicsAllocation()->getAuxTranslationState());
+}
+
+HWTEST_F(EnqueueAuxKernelTests, givenBufferResolvedByPreviousKernelWhenKernelAccessingItInNonAuxModeIsEnqueuedThenDontTranslateItAgain) {
+    MockKernelWithInternals mockKernel(*pDevice, context);
+    MyCmdQ<FamilyType> cmdQ(context, pDevice);
+    size_t gws[3] = {1, 0, 0};
+    MockBuffer buffer;
+    cl_mem clMem = &buffer;
+
+    buffer.getGraphicsAllocation()->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    mockKernel.kernelInfo.kernelArgInfo.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).kernelArgPatchInfoVector.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).pureStatefulBufferAccess = false;
+    mockKernel.mockKernel->initialize();
+    mockKernel.mockKernel->auxTranslationRequired = true;
+    mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMem);
+
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(1u, cmdQ.dispatchAuxTranslationInputs.size());
+    EXPECT_EQ(GraphicsAllocation::AuxTranslationState::Resolved, buffer.getGraphicsAllocation()->getAuxTranslationState());
+}
+
+HWTEST_F(EnqueueAuxKernelTests, givenResolvedBufferWhenKernelAccessingItInAuxModeIsEnqueuedThenTranslateItBackBeforeKernel) {
+    MockKernelWithInternals mockKernel(*pDevice, context);
+    MyCmdQ<FamilyType> cmdQ(context, pDevice);
+    size_t gws[3] = {1, 0, 0};
+    MockBuffer buffer;
+    cl_mem clMem = &buffer;
+
+    buffer.getGraphicsAllocation()->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    buffer.getGraphicsAllocation()->setAuxTranslationState(GraphicsAllocation::AuxTranslationState::Resolved);
+    mockKernel.kernelInfo.kernelArgInfo.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).kernelArgPatchInfoVector.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).pureStatefulBufferAccess = true;
+    mockKernel.mockKernel->initialize();
+    mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMem);
+
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    ASSERT_EQ(1u, cmdQ.dispatchAuxTranslationInputs.size());
+    EXPECT_EQ(0u, std::get<size_t>(cmdQ.dispatchAuxTranslationInputs.at(0)));
+    EXPECT_EQ(AuxTranslationDirection::NonAuxToAux, std::get<AuxTranslationDirection>(cmdQ.dispatchAuxTranslationInputs.at(0)));
+    EXPECT_EQ(&buffer, *std::get<BuffersForAuxTranslation>(cmdQ.dispatchAuxTranslationInputs.at(0)).begin());
+    EXPECT_EQ(GraphicsAllocation::AuxTranslationState::Compressed, buffer.getGraphicsAllocation()->getAuxTranslationState());
+
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(1u, cmdQ.dispatchAuxTranslationInputs.size());
+}
+
+HWTEST_F(EnqueueAuxKernelTests, givenResolvedBufferWhenBuiltInOperationIsEnqueuedThenTranslateItBackInSameEnqueue) {
+    MyCmdQ<FamilyType> cmdQ(context, pDevice);
+    MockBuffer srcBuffer, dstBuffer;
+    srcBuffer.getGraphicsAllocation()->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    srcBuffer.getGraphicsAllocation()->setAuxTranslationState(GraphicsAllocation::AuxTranslationState::Resolved);
+
+    auto &builder = cmdQ.getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer);
+    for (auto &kernel : builder.peekUsedKernels()) {
+        for (auto &kernelArgInfo : const_cast<KernelInfo &>(kernel->getKernelInfo()).kernelArgInfo) {
+            kernelArgInfo.pureStatefulBufferAccess = true;
+        }
+    }
+
+    auto taskCountBefore = cmdQ.taskCount;
+    auto retVal = cmdQ.enqueueCopyBuffer(&srcBuffer, &dstBuffer, 0, 0, 0x10, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    ASSERT_EQ(1u, cmdQ.dispatchAuxTranslationInputs.size());
+    EXPECT_EQ(AuxTranslationDirection::NonAuxToAux, std::get<AuxTranslationDirection>(cmdQ.dispatchAuxTranslationInputs.at(0)));
+    EXPECT_EQ(&srcBuffer, *std::get<BuffersForAuxTranslation>(cmdQ.dispatchAuxTranslationInputs.at(0)).begin());
+    EXPECT_EQ(GraphicsAllocation::AuxTranslationState::Compressed, srcBuffer.getGraphicsAllocation()->getAuxTranslationState());
+    EXPECT_EQ(taskCountBefore + 1, cmdQ.taskCount);
+}
+
+HWTEST_F(EnqueueAuxKernelTests, givenBuiltInOperationOnRegularBuffersWhenEnqueuedThenDontDispatchAuxTranslations) {
+    MyCmdQ<FamilyType> cmdQ(context, pDevice);
+    MockBuffer srcBuffer, dstBuffer;
+
+    auto retVal = cmdQ.enqueueCopyBuffer(&srcBuffer, &dstBuffer, 0, 0, 0x10, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0u, cmdQ.dispatchAuxTranslationInputs.size());
+}
+
+HWTEST_F(EnqueueAuxKernelTests, givenCompressedBufferArgWhenArgIsReplacedThenKernelHasNoCompressedBufferArgs) {
+    MockKernelWithInternals mockKernel(*pDevice, context);
+    MockBuffer compressedBuffer, regularBuffer;
+    cl_mem clMemCompressed = &compressedBuffer;
+    cl_mem clMemRegular = &regularBuffer;
+
+    compressedBuffer.getGraphicsAllocation()->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    mockKernel.kernelInfo.kernelArgInfo.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).kernelArgPatchInfoVector.resize(1);
+    mockKernel.mockKernel->initialize();
+    EXPECT_FALSE(mockKernel.mockKernel->hasCompressedBufferArgs());
+
+    mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMemCompressed);
+    EXPECT_TRUE(mockKernel.mockKernel->hasCompressedBufferArgs());
+
+    mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMemCompressed);
+    mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMemRegular);
+    EXPECT_FALSE(mockKernel.mockKernel->hasCompressedBufferArgs());
+}
+
+HWTEST_F(EnqueueAuxKernelTests, givenBlockedEnqueueWhenAuxTranslationIsRequiredThenTranslateBackAfterKernelAndPinStateUntilSubmitted) {
+    MockKernelWithInternals mockKernel(*pDevice, context);
+    MyCmdQ<FamilyType> cmdQ(context, pDevice);
+    MyCmdQ<FamilyType> otherCmdQ(context, pDevice);
+    size_t gws[3] = {1, 0, 0};
+    MockBuffer buffer;
+    cl_mem clMem = &buffer;
+    auto graphicsAllocation = buffer.getGraphicsAllocation();
+
+    graphicsAllocation->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    mockKernel.kernelInfo.kernelArgInfo.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).kernelArgPatchInfoVector.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).pureStatefulBufferAccess = false;
+    mockKernel.mockKernel->initialize();
+    mockKernel.mockKernel->auxTranslationRequired = true;
+    mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMem);
+
+    UserEvent userEvent(context);
+    cl_event waitlist[] = {&userEvent};
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 1, waitlist, nullptr);
+    ASSERT_EQ(2u, cmdQ.dispatchAuxTranslationInputs.size());
+    EXPECT_EQ(AuxTranslationDirection::AuxToNonAux, std::get<AuxTranslationDirection>(cmdQ.dispatchAuxTranslationInputs.at(0)));
+    EXPECT_EQ(AuxTranslationDirection::NonAuxToAux, std::get<AuxTranslationDirection>(cmdQ.dispatchAuxTranslationInputs.at(1)));
+    EXPECT_EQ(GraphicsAllocation::AuxTranslationState::Compressed, graphicsAllocation->getAuxTranslationState());
+    EXPECT_TRUE(graphicsAllocation->isAuxTranslationStatePinned());
+
+    otherCmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(2u, otherCmdQ.dispatchAuxTranslationInputs.size());
+    EXPECT_EQ(GraphicsAllocation::AuxTranslationState::Compressed, graphicsAllocation->getAuxTranslationState());
+
+    userEvent.setStatus(CL_COMPLETE);
+    EXPECT_FALSE(graphicsAllocation->isAuxTranslationStatePinned());
 
-    // after kernel
-    EXPECT_EQ(3u, std::get<size_t>(cmdQ.dispatchAuxTranslationInputs.at(1))); // aux + NDR + aux
-    auto kernelAfter = std::get<Kernel *>(cmdQ.dispatchAuxTranslationInputs.at(1));
-    EXPECT_EQ("fullCopy", kernelAfter->getKernelInfo().name);
-    EXPECT_TRUE(kernelAfter->isBuiltIn);
+    otherCmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(3u, otherCmdQ.dispatchAuxTranslationInputs.size());
+    EXPECT_EQ(GraphicsAllocation::AuxTranslationState::Resolved, graphicsAllocation->getAuxTranslationState());
+}
+
+HWTEST_F(EnqueueAuxKernelTests, givenOutOfOrderQueueWhenAuxTranslationIsRequiredThenTranslateBackAfterKernelInSameEnqueue) {
+    MockKernelWithInternals mockKernel(*pDevice, context);
+    const cl_queue_properties props[3] = {CL_QUEUE_PROPERTIES, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, 0};
+    MyCmdQ<FamilyType> cmdQ(context, pDevice, props);
+    size_t gws[3] = {1, 0, 0};
+    MockBuffer buffer;
+    cl_mem clMem = &buffer;
+
+    buffer.getGraphicsAllocation()->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    mockKernel.kernelInfo.kernelArgInfo.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).kernelArgPatchInfoVector.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).pureStatefulBufferAccess = false;
+    mockKernel.mockKernel->initialize();
+    mockKernel.mockKernel->auxTranslationRequired = true;
+    mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMem);
+
+    auto taskCountBefore = cmdQ.taskCount;
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    ASSERT_EQ(2u, cmdQ.dispatchAuxTranslationInputs.size());
+    EXPECT_EQ(AuxTranslationDirection::AuxToNonAux, std::get<AuxTranslationDirection>(cmdQ.dispatchAuxTranslationInputs.at(0)));
+    EXPECT_EQ(AuxTranslationDirection::NonAuxToAux, std::get<AuxTranslationDirection>(cmdQ.dispatchAuxTranslationInputs.at(1)));
+    EXPECT_EQ(GraphicsAllocation::AuxTranslationState::Compressed, buffer.getGraphicsAllocation()->getAuxTranslationState());
+    EXPECT_EQ(taskCountBefore + 1, cmdQ.taskCount);
+}
+
+HWTEST_F(EnqueueAuxKernelTests, givenTranslationsInSameDirectionBeforeAndAfterKernelWhenEnqueuedThenUseSeparateBuiltInInstances) {
+    MockKernelWithInternals mockKernel(*pDevice, context);
+    const cl_queue_properties props[3] = {CL_QUEUE_PROPERTIES, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, 0};
+    MyCmdQ<FamilyType> cmdQ(context, pDevice, props);
+    size_t gws[3] = {1, 0, 0};
+    MockBuffer auxBuffer, nonAuxBuffer;
+    cl_mem clMemAux = &auxBuffer;
+    cl_mem clMemNonAux = &nonAuxBuffer;
+
+    auxBuffer.getGraphicsAllocation()->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    auxBuffer.getGraphicsAllocation()->setAuxTranslationState(GraphicsAllocation::AuxTranslationState::Resolved);
+    nonAuxBuffer.getGraphicsAllocation()->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    mockKernel.kernelInfo.kernelArgInfo.resize(2);
+    for (auto &kernelArgInfo : mockKernel.kernelInfo.kernelArgInfo) {
+        kernelArgInfo.kernelArgPatchInfoVector.resize(1);
+    }
+    mockKernel.mockKernel->initialize();
+    mockKernel.kernelInfo.kernelArgInfo.at(0).pureStatefulBufferAccess = true;
+    mockKernel.kernelInfo.kernelArgInfo.at(1).pureStatefulBufferAccess = false;
+    mockKernel.mockKernel->auxTranslationRequired = true;
+    mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMemAux);
+    mockKernel.mockKernel->setArgBuffer(1, sizeof(cl_mem *), &clMemNonAux);
+
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    ASSERT_EQ(4u, cmdQ.dispatchAuxTranslationInputs.size());
+    EXPECT_EQ(AuxTranslationDirection::NonAuxToAux, std::get<AuxTranslationDirection>(cmdQ.dispatchAuxTranslationInputs.at(0)));
+    EXPECT_EQ(AuxTranslationDirection::AuxToNonAux, std::get<AuxTranslationDirection>(cmdQ.dispatchAuxTranslationInputs.at(1)));
+    EXPECT_EQ(AuxTranslationDirection::NonAuxToAux, std::get<AuxTranslationDirection>(cmdQ.dispatchAuxTranslationInputs.at(2)));
+    EXPECT_EQ(AuxTranslationDirection::AuxToNonAux, std::get<AuxTranslationDirection>(cmdQ.dispatchAuxTranslationInputs.at(3)));
+    auto resolveKernelBefore = std::get<Kernel *>(cmdQ.dispatchAuxTranslationInputs.at(1));
+    auto resolveKernelAfter = std::get<Kernel *>(cmdQ.dispatchAuxTranslationInputs.at(3));
+    ASSERT_NE(nullptr, resolveKernelBefore);
+    ASSERT_NE(nullptr, resolveKernelAfter);
+    EXPECT_NE(resolveKernelBefore, resolveKernelAfter);
+    EXPECT_EQ(GraphicsAllocation::AuxTranslationState::Resolved, auxBuffer.getGraphicsAllocation()->getAuxTranslationState());
+    EXPECT_EQ(GraphicsAllocation::AuxTranslationState::Compressed, nonAuxBuffer.getGraphicsAllocation()->getAuxTranslationState());
 }
 
 HWCMDTEST_F(IGFX_GEN8_CORE, EnqueueAuxKernelTests, givenParentKernelWhenAuxTranslationIsRequiredThenDontTranslateFromNonAuxToAux) {
@@ -1758,3 +1976,94 @@ HWCMDTEST_F(IGFX_GEN8_CORE, EnqueueAuxKernelTests, givenParentKernelWhenAuxTrans
         EXPECT_EQ(1u, cmdQ.waitCalled);
     }
 }
+
+struct EnqueueKernelFastPathTests : public EnqueueKernelTest {
+    template <typename FamilyType>
+    class MyCmdQ : public CommandQueueHw<FamilyType> {
+      public:
+        MyCmdQ(Context *context, Device *device, const cl_queue_properties *properties = nullptr) : CommandQueueHw<FamilyType>(context, device, properties) {}
+        bool enqueueKernelFastPath(Surface **surfacesForResidency, size_t numSurfaceForResidency, bool blocking, const MultiDispatchInfo &multiDispatchInfo) override {
+            fastPathCalled++;
+            auto fastPathTaken = CommandQueueHw<FamilyType>::enqueueKernelFastPath(surfacesForResidency, numSurfaceForResidency, blocking, multiDispatchInfo);
+            fastPathTakenCount += fastPathTaken ? 1 : 0;
+            return fastPathTaken;
+        }
+
+        uint32_t fastPathCalled = 0;
+        uint32_t fastPathTakenCount = 0;
+    };
+};
+
+HWTEST_F(EnqueueKernelFastPathTests, givenKernelWithoutEventsAndPrintfWhenEnqueuedThenFastPathIsTakenAndWalkerIsSubmitted) {
+    typedef typename FamilyType::GPGPU_WALKER GPGPU_WALKER;
+    MockKernelWithInternals mockKernel(*pDevice, context);
+    MyCmdQ<FamilyType> cmdQ(context, pDevice);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto taskCountBefore = csr.peekTaskCount();
+    auto taskLevelBefore = cmdQ.taskLevel;
+    size_t gws[3] = {64, 1, 1};
+
+    auto retVal = cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1u, cmdQ.fastPathCalled);
+    EXPECT_EQ(1u, cmdQ.fastPathTakenCount);
+    EXPECT_EQ(taskCountBefore + 1, csr.peekTaskCount());
+    EXPECT_EQ(csr.peekTaskCount(), cmdQ.taskCount);
+    EXPECT_EQ(taskLevelBefore + 1, cmdQ.taskLevel);
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(cmdQ);
+    EXPECT_NE(hwParser.cmdList.end(), find<GPGPU_WALKER *>(hwParser.cmdList.begin(), hwParser.cmdList.end()));
+}
+
+HWTEST_F(EnqueueKernelFastPathTests, givenOutputEventOrWaitListOrPrintfWhenKernelIsEnqueuedThenFastPathIsNotEntered) {
+    MockKernelWithInternals mockKernel(*pDevice, context);
+    MyCmdQ<FamilyType> cmdQ(context, pDevice);
+    size_t gws[3] = {64, 1, 1};
+
+    cl_event event = nullptr;
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, &event);
+    ASSERT_NE(nullptr, event);
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 1, &event, nullptr);
+    clReleaseEvent(event);
+    EXPECT_EQ(0u, cmdQ.fastPathCalled);
+
+    SPatchAllocateStatelessPrintfSurface patchData = {};
+    patchData.Size = 256;
+    patchData.DataParamOffset = 64;
+    MockKernelWithInternals printfKernel(*pDevice, context);
+    printfKernel.kernelInfo.patchInfo.pAllocateStatelessPrintfSurface = &patchData;
+    cmdQ.enqueueKernel(printfKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(0u, cmdQ.fastPathCalled);
+
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(1u, cmdQ.fastPathTakenCount);
+}
+
+HWTEST_F(EnqueueKernelFastPathTests, givenBlockedQueueWhenKernelWithoutEventsIsEnqueuedThenItFallsBackToBlockedEnqueueAndFastPathIsTakenAfterUnblock) {
+    MockKernelWithInternals mockKernel(*pDevice, context);
+    MyCmdQ<FamilyType> cmdQ(context, pDevice);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    size_t gws[3] = {64, 1, 1};
+
+    UserEvent userEvent(context);
+    cl_event waitlist[] = {&userEvent};
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 1, waitlist, nullptr);
+    EXPECT_TRUE(cmdQ.isQueueBlocked());
+    auto taskCountBefore = csr.peekTaskCount();
+
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(1u, cmdQ.fastPathCalled);
+    EXPECT_EQ(0u, cmdQ.fastPathTakenCount);
+    EXPECT_EQ(taskCountBefore, csr.peekTaskCount());
+    EXPECT_TRUE(cmdQ.isQueueBlocked());
+
+    userEvent.setStatus(CL_COMPLETE);
+    EXPECT_FALSE(cmdQ.isQueueBlocked());
+    EXPECT_EQ(taskCountBefore + 2, csr.peekTaskCount());
+
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(2u, cmdQ.fastPathCalled);
+    EXPECT_EQ(1u, cmdQ.fastPathTakenCount);
+    EXPECT_EQ(taskCountBefore + 3, csr.peekTaskCount());
+}
@@ -281,6 +281,7 @@ HWTEST_F(EnqueueThreading, enqueueFillBuffer) {
 
     std::unique_ptr<Buffer> buffer(Buffer::create(context, CL_MEM_READ_WRITE, 1024u, nullptr, retVal));
     ASSERT_NE(nullptr, buffer.get());
+    buffer->forceDisallowCPUCopy = true;
 
     cl_int pattern = 0xDEADBEEF;
     pCmdQ->enqueueFillBuffer(buffer.get(), &pattern, sizeof(pattern), 0, 1024u, 0, nullptr, nullptr);
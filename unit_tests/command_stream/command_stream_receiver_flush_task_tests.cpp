@@ -1672,7 +1672,7 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, InForced32BitAllocationsModeDoNotS
     }
 }
 
-HWTEST_F(CommandStreamReceiverFlushTaskTests, InForced32BitAllocationsModeStore32bitScratchAllocationOnTemporaryAllocationList) {
+HWTEST_F(CommandStreamReceiverFlushTaskTests, InForced32BitAllocationsModeRelease32bitScratchAllocationToScratchSpaceManager) {
     if (is64bit) {
         DebugManagerStateRestore dbgRestorer;
         DebugManager.flags.Force32bitAddressing.set(true);
@@ -1696,13 +1696,35 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, InForced32BitAllocationsModeStore3
         auto newScratchAllocation = commandStreamReceiver->getScratchAllocation();
         EXPECT_NE(scratchAllocation, newScratchAllocation); // Allocation changed
 
-        std::unique_ptr<GraphicsAllocation> allocationTemporary = commandStreamReceiver->getTemporaryAllocations().detachAllocation(0, nullptr, true);
-
-        EXPECT_EQ(scratchAllocation, allocationTemporary.get());
-        pDevice->getMemoryManager()->freeGraphicsMemory(allocationTemporary.release());
+        EXPECT_TRUE(commandStreamReceiver->getTemporaryAllocations().peekIsEmpty());
+        auto statistics = pDevice->getMemoryManager()->getScratchSpaceManager()->getStatistics();
+        EXPECT_EQ(scratchAllocation->getUnderlyingBufferSize(), statistics.pooledSize);
+        EXPECT_EQ(newScratchAllocation->getUnderlyingBufferSize(), statistics.usedSize);
     }
 }
 
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenScratchReleasedByDestroyedCsrWhenOtherCsrRequiresScratchThenReleasedScratchIsReused) {
+    auto memoryManager = pDevice->getMemoryManager();
+    auto initialStatistics = memoryManager->getScratchSpaceManager()->getStatistics();
+
+    auto commandStreamReceiver = new MockCsrHw<FamilyType>(*platformDevices[0], *pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(commandStreamReceiver);
+    commandStreamReceiver->setRequiredScratchSize(4096);
+    flushTask(*commandStreamReceiver);
+    auto scratchAllocation = commandStreamReceiver->getScratchAllocation();
+    ASSERT_NE(nullptr, scratchAllocation);
+
+    auto otherCommandStreamReceiver = new MockCsrHw<FamilyType>(*platformDevices[0], *pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(otherCommandStreamReceiver);
+    otherCommandStreamReceiver->setRequiredScratchSize(2048);
+    flushTask(*otherCommandStreamReceiver);
+
+    EXPECT_EQ(scratchAllocation, otherCommandStreamReceiver->getScratchAllocation());
+    auto statistics = memoryManager->getScratchSpaceManager()->getStatistics();
+    EXPECT_EQ(initialStatistics.allocationsCount + 1, statistics.allocationsCount);
+    EXPECT_EQ(initialStatistics.reusesCount + 1, statistics.reusesCount);
+}
+
 TEST(CacheSettings, GivenCacheSettingWhenCheckedForValuesThenProperValuesAreSelected) {
     EXPECT_EQ(static_cast<uint32_t>(GMM_RESOURCE_USAGE_OCL_BUFFER_CACHELINE_MISALIGNED), CacheSettings::l3CacheOff);
     EXPECT_EQ(static_cast<uint32_t>(GMM_RESOURCE_USAGE_OCL_BUFFER), CacheSettings::l3CacheOn);
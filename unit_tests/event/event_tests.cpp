@@ -1519,3 +1519,24 @@ TEST(EventsDebug, givenEventWhenTrackingOfParentsIsOffThenDoNotTrackParents) {
     EXPECT_EQ(0u, parentEvents2.size());
     event.setStatus(CL_COMPLETE);
 }
+
+TEST(EventsDependencies, givenLongChainOfDependentEventsWhenRootIsCompletedThenWholeChainIsUnblockedWithPropagatedTaskLevels) {
+    const uint32_t chainLength = 100000;
+
+    Event root(nullptr, CL_COMMAND_NDRANGE_KERNEL, 0, 0);
+    std::vector<std::unique_ptr<Event>> chain;
+    Event *previous = &root;
+    for (uint32_t i = 0; i < chainLength; i++) {
+        chain.emplace_back(new Event(nullptr, CL_COMMAND_NDRANGE_KERNEL, Event::eventNotReady, Event::eventNotReady));
+        previous->addChild(*chain.back());
+        previous = chain.back().get();
+    }
+    EXPECT_TRUE(chain.back()->peekIsBlocked());
+
+    root.setStatus(CL_COMPLETE);
+
+    for (uint32_t i = 0; i < chainLength; i++) {
+        EXPECT_FALSE(chain[i]->peekIsBlocked());
+        EXPECT_EQ(i + 1, chain[i]->getTaskLevel());
+    }
+}
@@ -16,12 +16,15 @@
 #include "unit_tests/helpers/debug_manager_state_restore.h"
 #include "unit_tests/helpers/gtest_helpers.h"
 #include "unit_tests/helpers/hw_parse.h"
+#include "unit_tests/mocks/mock_command_queue.h"
 #include "unit_tests/mocks/mock_csr.h"
 #include "unit_tests/mocks/mock_device_queue.h"
 #include "unit_tests/mocks/mock_event.h"
 #include "unit_tests/mocks/mock_mdi.h"
 #include "unit_tests/mocks/mock_submissions_aggregator.h"
 
+#include <functional>
+
 using namespace OCLRT;
 
 static const char *binaryFile = "simple_block_kernel";
@@ -501,6 +504,55 @@ HWTEST_F(ParentKernelEnqueueFixture, GivenParentKernelWhenEnqueuedToBlockedQueue
     }
 }
 
+template <typename GfxFamily>
+struct MockDeviceQueueHwReleasingCriticalSection : public MockDeviceQueueHw<GfxFamily> {
+    using MockDeviceQueueHw<GfxFamily>::MockDeviceQueueHw;
+
+    bool isEMCriticalSectionFree() override {
+        if (criticalSectionChecksCount++ == 0) {
+            onFirstCheck();
+        }
+        if (criticalSectionChecksCount == checksToRelease) {
+            auto igilCmdQueue = reinterpret_cast<IGIL_CommandQueue *>(DeviceQueue::queueBuffer->getUnderlyingBuffer());
+            igilCmdQueue->m_controls.m_CriticalSection = DeviceQueue::ExecutionModelCriticalSection::Free;
+        }
+        return MockDeviceQueueHw<GfxFamily>::isEMCriticalSectionFree();
+    }
+
+    std::function<void()> onFirstCheck;
+    uint32_t criticalSectionChecksCount = 0;
+    const uint32_t checksToRelease = 10;
+};
+
+HWTEST_F(ParentKernelEnqueueFixture, givenDeviceQueueCriticalSectionTakenWhenParentKernelIsEnqueuedThenHostPreparationIsDoneBeforeWaitingForIt) {
+
+    if (pDevice->getSupportedClVersion() >= 20) {
+        size_t offset[3] = {0, 0, 0};
+        size_t gws[3] = {1, 1, 1};
+        cl_queue_properties properties = 0;
+
+        MockCommandQueueHw<FamilyType> cmdQ(context, pDevice, nullptr);
+        MockDeviceQueueHwReleasingCriticalSection<FamilyType> mockDevQueue(context, pDevice, properties);
+        context->setDefaultDeviceQueue(&mockDevQueue);
+        // previous parent kernel is still draining on GPU
+        mockDevQueue.acquireEMCriticalSection();
+
+        bool kernelPreparedBeforeWait = false;
+        mockDevQueue.onFirstCheck = [&]() {
+            kernelPreparedBeforeWait = cmdQ.lastEnqueuedKernels.size() == 1u && parentKernel->getKernelReflectionSurface() == nullptr;
+        };
+
+        cmdQ.enqueueKernel(parentKernel, 1, offset, gws, gws, 0, nullptr, nullptr);
+
+        EXPECT_TRUE(kernelPreparedBeforeWait);
+        EXPECT_EQ(mockDevQueue.checksToRelease, mockDevQueue.criticalSectionChecksCount);
+        EXPECT_NE(nullptr, parentKernel->getKernelReflectionSurface());
+        EXPECT_FALSE(mockDevQueue.isEMCriticalSectionFree());
+
+        context->setDefaultDeviceQueue(pDevQueue);
+    }
+}
+
 HWTEST_F(ParentKernelEnqueueFixture, ParentKernelEnqueuedToNonBlockedQueueFlushesCSRWithSLM) {
 
     if (pDevice->getSupportedClVersion() >= 20) {
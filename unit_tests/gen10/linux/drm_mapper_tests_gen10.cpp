@@ -28,8 +28,16 @@ GEN10TEST_F(DrmMapperTestsGen10, engineNodeMapPass) {
     EXPECT_EQ(expected, flag);
 }
 
-GEN10TEST_F(DrmMapperTestsGen10, engineNodeMapNegative) {
+GEN10TEST_F(DrmMapperTestsGen10, engineNodeMapBlitterPass) {
     unsigned int flag = I915_EXEC_RING_MASK;
+    unsigned int expected = I915_EXEC_BLT;
     bool ret = DrmEngineMapper<CNLFamily>::engineNodeMap(EngineType::ENGINE_BCS, flag);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(expected, flag);
+}
+
+GEN10TEST_F(DrmMapperTestsGen10, engineNodeMapNegative) {
+    unsigned int flag = I915_EXEC_RING_MASK;
+    bool ret = DrmEngineMapper<CNLFamily>::engineNodeMap(EngineType::ENGINE_VCS, flag);
     EXPECT_FALSE(ret);
 }
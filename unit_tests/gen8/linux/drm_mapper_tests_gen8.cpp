@@ -27,8 +27,16 @@ GEN8TEST_F(DrmMapperTestsGen8, engineNodeMapPass) {
     EXPECT_EQ(expected, flag);
 }
 
-GEN8TEST_F(DrmMapperTestsGen8, engineNodeMapNegative) {
+GEN8TEST_F(DrmMapperTestsGen8, engineNodeMapBlitterPass) {
     unsigned int flag = I915_EXEC_RING_MASK;
+    unsigned int expected = I915_EXEC_BLT;
     bool ret = DrmEngineMapper<BDWFamily>::engineNodeMap(EngineType::ENGINE_BCS, flag);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(expected, flag);
+}
+
+GEN8TEST_F(DrmMapperTestsGen8, engineNodeMapNegative) {
+    unsigned int flag = I915_EXEC_RING_MASK;
+    bool ret = DrmEngineMapper<BDWFamily>::engineNodeMap(EngineType::ENGINE_VCS, flag);
     EXPECT_FALSE(ret);
 }
@@ -27,8 +27,16 @@ GEN9TEST_F(DrmMapperTestsGen9, engineNodeMapPass) {
     EXPECT_EQ(expected, flag);
 }
 
-GEN9TEST_F(DrmMapperTestsGen9, engineNodeMapNegative) {
+GEN9TEST_F(DrmMapperTestsGen9, engineNodeMapBlitterPass) {
     unsigned int flag = I915_EXEC_RING_MASK;
+    unsigned int expected = I915_EXEC_BLT;
     bool ret = DrmEngineMapper<SKLFamily>::engineNodeMap(EngineType::ENGINE_BCS, flag);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(expected, flag);
+}
+
+GEN9TEST_F(DrmMapperTestsGen9, engineNodeMapNegative) {
+    unsigned int flag = I915_EXEC_RING_MASK;
+    bool ret = DrmEngineMapper<SKLFamily>::engineNodeMap(EngineType::ENGINE_VCS, flag);
     EXPECT_FALSE(ret);
 }
@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/event/event.h"
+#include "runtime/helpers/blit_commands_helper.h"
+#include "runtime/helpers/aligned_memory.h"
+#include "runtime/helpers/ptr_math.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/helpers/hw_parse.h"
+#include "unit_tests/libult/ult_command_stream_receiver.h"
+#include "unit_tests/mocks/mock_buffer.h"
+#include "unit_tests/mocks/mock_command_queue.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_device.h"
+#include "unit_tests/mocks/mock_graphics_allocation.h"
+
+#include "test.h"
+
+using namespace OCLRT;
+
+struct BlitCommandsHelperTests : public ::testing::Test {
+    void SetUp() override {
+        DebugManager.flags.EnableBlitterOperationsForBuffers.set(true);
+        device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(platformDevices[0]));
+        ASSERT_NE(nullptr, device->getBlitterCommandStreamReceiver());
+    }
+
+    DebugManagerStateRestore restore;
+    std::unique_ptr<MockDevice> device;
+    MockGraphicsAllocation srcAllocation{reinterpret_cast<void *>(0x10000), 0x100000};
+    MockGraphicsAllocation dstAllocation{reinterpret_cast<void *>(0x200000), 0x100000};
+};
+
+HWTEST_F(BlitCommandsHelperTests, givenCopySizeWhenAskingForBlitCommandsCountThenSplitIntoMaxSizedRectangles) {
+    using Helper = BlitCommandsHelper<FamilyType>;
+
+    EXPECT_EQ(0u, Helper::getBlitCommandsCount(0));
+    EXPECT_EQ(1u, Helper::getBlitCommandsCount(1));
+    EXPECT_EQ(1u, Helper::getBlitCommandsCount(Helper::maxBlitWidth));
+    EXPECT_EQ(2u, Helper::getBlitCommandsCount(Helper::maxBlitWidth + 1));
+    EXPECT_EQ(1u, Helper::getBlitCommandsCount(Helper::maxBlitWidth * Helper::maxBlitHeight));
+    EXPECT_EQ(3u, Helper::getBlitCommandsCount(2 * Helper::maxBlitWidth * Helper::maxBlitHeight + 1));
+}
+
+HWTEST_F(BlitCommandsHelperTests, givenBlitPropertiesWhenDispatchingThenProgramCopyRectanglesWithConsecutiveAddresses) {
+    using XY_SRC_COPY_BLT = typename FamilyType::XY_SRC_COPY_BLT;
+    using Helper = BlitCommandsHelper<FamilyType>;
+
+    BlitProperties blitProperties;
+    blitProperties.srcAllocation = &srcAllocation;
+    blitProperties.dstAllocation = &dstAllocation;
+    blitProperties.srcOffset = 0x10;
+    blitProperties.dstOffset = 0x20;
+    blitProperties.copySize = 3 * Helper::maxBlitWidth + 5;
+
+    uint8_t buffer[1024] = {};
+    LinearStream stream(buffer, sizeof(buffer));
+    Helper::dispatchBlitCommandsForBuffer(blitProperties, stream);
+
+    EXPECT_EQ(Helper::estimateBlitCommandsSize(blitProperties), stream.getUsed());
+    ASSERT_EQ(2 * sizeof(XY_SRC_COPY_BLT), stream.getUsed());
+
+    auto bltCmd = reinterpret_cast<XY_SRC_COPY_BLT *>(buffer);
+    EXPECT_EQ(Helper::maxBlitWidth, bltCmd->getDestinationX2CoordinateRight());
+    EXPECT_EQ(3u, bltCmd->getDestinationY2CoordinateBottom());
+    EXPECT_EQ(Helper::maxBlitWidth, bltCmd->getDestinationPitch());
+    EXPECT_EQ(Helper::maxBlitWidth, bltCmd->getSourcePitch());
+    EXPECT_EQ(srcAllocation.getGpuAddress() + 0x10, bltCmd->getSourceBaseAddress());
+    EXPECT_EQ(dstAllocation.getGpuAddress() + 0x20, bltCmd->getDestinationBaseAddress());
+
+    bltCmd++;
+    EXPECT_EQ(5u, bltCmd->getDestinationX2CoordinateRight());
+    EXPECT_EQ(1u, bltCmd->getDestinationY2CoordinateBottom());
+    EXPECT_EQ(srcAllocation.getGpuAddress() + 0x10 + 3 * Helper::maxBlitWidth, bltCmd->getSourceBaseAddress());
+    EXPECT_EQ(dstAllocation.getGpuAddress() + 0x20 + 3 * Helper::maxBlitWidth, bltCmd->getDestinationBaseAddress());
+}
+
+HWTEST_F(BlitCommandsHelperTests, givenAllocationsStartingMidPageWhenDispatchingThenAllocationOffsetIsPartOfBlitAddresses) {
+    using XY_SRC_COPY_BLT = typename FamilyType::XY_SRC_COPY_BLT;
+
+    MockGraphicsAllocation srcHostPtrAllocation(reinterpret_cast<void *>(0x30040), 0x30000, 0, 0x100);
+    srcHostPtrAllocation.allocationOffset = 0x40;
+    MockGraphicsAllocation dstHostPtrAllocation(reinterpret_cast<void *>(0x50080), 0x50000, 0, 0x100);
+    dstHostPtrAllocation.allocationOffset = 0x80;
+
+    BlitProperties blitProperties;
+    blitProperties.srcAllocation = &srcHostPtrAllocation;
+    blitProperties.dstAllocation = &dstHostPtrAllocation;
+    blitProperties.srcOffset = 0x10;
+    blitProperties.dstOffset = 0x20;
+    blitProperties.copySize = 0x10;
+
+    uint8_t buffer[1024] = {};
+    LinearStream stream(buffer, sizeof(buffer));
+    BlitCommandsHelper<FamilyType>::dispatchBlitCommandsForBuffer(blitProperties, stream);
+    ASSERT_EQ(sizeof(XY_SRC_COPY_BLT), stream.getUsed());
+
+    auto bltCmd = reinterpret_cast<XY_SRC_COPY_BLT *>(buffer);
+    EXPECT_EQ(0x30050u, bltCmd->getSourceBaseAddress());
+    EXPECT_EQ(0x500A0u, bltCmd->getDestinationBaseAddress());
+}
+
+HWTEST_F(BlitCommandsHelperTests, givenDependencyWhenDispatchingThenProgramSemaphoreBeforeCopy) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    using XY_SRC_COPY_BLT = typename FamilyType::XY_SRC_COPY_BLT;
+
+    BlitProperties blitProperties;
+    blitProperties.srcAllocation = &srcAllocation;
+    blitProperties.dstAllocation = &dstAllocation;
+    blitProperties.copySize = 1;
+    blitProperties.dependencyTagAllocation = device->getCommandStreamReceiver().getTagAllocation();
+    blitProperties.dependencyTaskCount = 5;
+
+    uint8_t buffer[1024] = {};
+    LinearStream stream(buffer, sizeof(buffer));
+    BlitCommandsHelper<FamilyType>::dispatchBlitCommandsForBuffer(blitProperties, stream);
+    ASSERT_EQ(sizeof(MI_SEMAPHORE_WAIT) + sizeof(XY_SRC_COPY_BLT), stream.getUsed());
+
+    auto semaphoreCmd = reinterpret_cast<MI_SEMAPHORE_WAIT *>(buffer);
+    EXPECT_EQ(blitProperties.dependencyTagAllocation->getGpuAddress(), semaphoreCmd->getSemaphoreGraphicsAddress());
+    EXPECT_EQ(5u, semaphoreCmd->getSemaphoreDataDword());
+    EXPECT_EQ(MI_SEMAPHORE_WAIT::COMPARE_OPERATION::COMPARE_OPERATION_SAD_GREATER_THAN_OR_EQUAL_SDD, semaphoreCmd->getCompareOperation());
+}
+
+HWTEST_F(BlitCommandsHelperTests, givenBlitterCsrWhenBlittingThenSubmitCopyWithTagUpdateAndKeepRenderResidencyIntact) {
+    using XY_SRC_COPY_BLT = typename FamilyType::XY_SRC_COPY_BLT;
+    using MI_FLUSH_DW = typename FamilyType::MI_FLUSH_DW;
+    using MI_BATCH_BUFFER_END = typename FamilyType::MI_BATCH_BUFFER_END;
+
+    auto &blitterCsr = static_cast<UltCommandStreamReceiver<FamilyType> &>(*device->getBlitterCommandStreamReceiver());
+    EXPECT_NE(&device->getCommandStreamReceiver(), &blitterCsr);
+
+    BlitProperties blitProperties;
+    blitProperties.srcAllocation = &srcAllocation;
+    blitProperties.dstAllocation = &dstAllocation;
+    blitProperties.copySize = 0x100;
+    srcAllocation.residencyTaskCount[blitterCsr.getDeviceIndex()] = 7;
+
+    auto taskCount = blitterCsr.blitBuffer(blitProperties, *device->getOsContext());
+    EXPECT_EQ(1u, taskCount);
+    EXPECT_EQ(1u, blitterCsr.peekTaskCount());
+    EXPECT_EQ(1u, blitterCsr.peekLatestSentTaskCount());
+    EXPECT_EQ(7, srcAllocation.residencyTaskCount[blitterCsr.getDeviceIndex()]);
+    EXPECT_EQ(ObjectNotResident, dstAllocation.residencyTaskCount[blitterCsr.getDeviceIndex()]);
+
+    auto cmdBuffer = blitterCsr.commandStream.getCpuBase();
+    auto bltCmd = reinterpret_cast<XY_SRC_COPY_BLT *>(cmdBuffer);
+    EXPECT_EQ(0x100u, bltCmd->getDestinationX2CoordinateRight());
+
+    auto miFlushDwCmd = reinterpret_cast<MI_FLUSH_DW *>(ptrOffset(cmdBuffer, sizeof(XY_SRC_COPY_BLT)));
+    EXPECT_EQ(MI_FLUSH_DW::POST_SYNC_OPERATION_WRITE_IMMEDIATE_DATA_QWORD, miFlushDwCmd->getPostSyncOperation());
+    EXPECT_EQ(blitterCsr.getTagAllocation()->getGpuAddress(), miFlushDwCmd->getDestinationAddress());
+    EXPECT_EQ(1u, miFlushDwCmd->getImmediateData());
+
+    auto bbEndCmd = reinterpret_cast<MI_BATCH_BUFFER_END *>(ptrOffset(miFlushDwCmd, sizeof(MI_FLUSH_DW)));
+    EXPECT_EQ(MI_BATCH_BUFFER_END::COMMAND_TYPE_MI_COMMAND, bbEndCmd->TheStructure.Common.CommandType);
+}
+
+HWTEST_F(BlitCommandsHelperTests, givenBlitterEnabledWhenCopyingBuffersThenSubmitToBlitterAndOrderNextRenderSubmission) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+
+    MockContext context(device.get());
+    MockCommandQueueHw<FamilyType> commandQueue(&context, device.get(), nullptr);
+    auto &renderCsr = device->getCommandStreamReceiver();
+    auto blitterCsr = device->getBlitterCommandStreamReceiver();
+
+    MockBuffer srcBuffer;
+    MockBuffer dstBuffer;
+    auto retVal = commandQueue.enqueueCopyBuffer(&srcBuffer, &dstBuffer, 0, 0, 0x10, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(0u, renderCsr.peekTaskCount());
+    EXPECT_EQ(1u, blitterCsr->peekTaskCount());
+    EXPECT_EQ(1u, commandQueue.peekBlitterTaskCount());
+
+    cl_event event = nullptr;
+    retVal = commandQueue.enqueueCopyBuffer(&srcBuffer, &dstBuffer, 0, 0, 0x10, 0, nullptr, &event);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1u, blitterCsr->peekTaskCount());
+    EXPECT_EQ(1u, renderCsr.peekTaskCount());
+    clReleaseEvent(event);
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(device->getUltCommandStreamReceiver<FamilyType>().commandStream, 0);
+    auto semaphores = 0u;
+    for (auto it = hwParser.cmdList.begin(); it != hwParser.cmdList.end(); it++) {
+        auto semaphoreCmd = genCmdCast<MI_SEMAPHORE_WAIT *>(*it);
+        if (semaphoreCmd) {
+            semaphores++;
+            EXPECT_EQ(blitterCsr->getTagAllocation()->getGpuAddress(), semaphoreCmd->getSemaphoreGraphicsAddress());
+            EXPECT_EQ(1u, semaphoreCmd->getSemaphoreDataDword());
+            EXPECT_EQ(MI_SEMAPHORE_WAIT::COMPARE_OPERATION::COMPARE_OPERATION_SAD_GREATER_THAN_OR_EQUAL_SDD, semaphoreCmd->getCompareOperation());
+        }
+    }
+    EXPECT_EQ(1u, semaphores);
+}
+
+HWTEST_F(BlitCommandsHelperTests, givenHostPtrStartingMidPageWhenWritingBufferThroughBlitterThenCopyStartsAtHostPtr) {
+    using XY_SRC_COPY_BLT = typename FamilyType::XY_SRC_COPY_BLT;
+
+    MockContext context(device.get());
+    MockCommandQueueHw<FamilyType> commandQueue(&context, device.get(), nullptr);
+    auto &blitterCsr = static_cast<UltCommandStreamReceiver<FamilyType> &>(*device->getBlitterCommandStreamReceiver());
+    *blitterCsr.getTagAddress() = 1;
+
+    auto hostMemory = alignedMalloc(2 * MemoryConstants::pageSize, MemoryConstants::pageSize);
+    auto hostPtr = ptrOffset(hostMemory, 0x40);
+    MockBuffer buffer;
+    buffer.forceDisallowCPUCopy = true;
+    auto retVal = commandQueue.enqueueWriteBuffer(&buffer, CL_TRUE, 0x4, 0x10, hostPtr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1u, blitterCsr.peekTaskCount());
+
+    auto bltCmd = reinterpret_cast<XY_SRC_COPY_BLT *>(blitterCsr.commandStream.getCpuBase());
+    EXPECT_EQ(castToUint64(hostPtr), bltCmd->getSourceBaseAddress());
+    EXPECT_EQ(buffer.getGraphicsAllocation()->getGpuAddress() + 0x4, bltCmd->getDestinationBaseAddress());
+
+    alignedFree(hostMemory);
+}
+
+HWTEST_F(BlitCommandsHelperTests, givenCompressedBufferWhenCopyingBuffersThenDontSubmitToBlitter) {
+    MockContext context(device.get());
+    MockCommandQueueHw<FamilyType> commandQueue(&context, device.get(), nullptr);
+    auto blitterCsr = device->getBlitterCommandStreamReceiver();
+
+    MockBuffer srcBuffer;
+    MockBuffer dstBuffer;
+    dstBuffer.getGraphicsAllocation()->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    auto retVal = commandQueue.enqueueCopyBuffer(&srcBuffer, &dstBuffer, 0, 0, 0x10, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(0u, blitterCsr->peekTaskCount());
+    EXPECT_EQ(0u, commandQueue.peekBlitterTaskCount());
+    EXPECT_EQ(0u, dstBuffer.getGraphicsAllocation()->blitterTaskCount);
+}
+
+HWTEST_F(BlitCommandsHelperTests, givenBlittedBuffersWhenCopyingThenTrackBlitterTaskCountPerAllocation) {
+    MockContext context(device.get());
+    MockCommandQueueHw<FamilyType> commandQueue(&context, device.get(), nullptr);
+
+    MockBuffer srcBuffer;
+    MockBuffer dstBuffer;
+    MockBuffer otherBuffer;
+    auto retVal = commandQueue.enqueueCopyBuffer(&srcBuffer, &dstBuffer, 0, 0, 0x10, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(1u, srcBuffer.getGraphicsAllocation()->blitterTaskCount);
+    EXPECT_EQ(1u, dstBuffer.getGraphicsAllocation()->blitterTaskCount);
+    EXPECT_EQ(0u, otherBuffer.getGraphicsAllocation()->blitterTaskCount);
+}
+
+HWTEST_F(BlitCommandsHelperTests, givenEventWithBlitterTaskCountWhenBlitterTagIsBehindThenEventIsNotCompleted) {
+    MockContext context(device.get());
+    MockCommandQueueHw<FamilyType> commandQueue(&context, device.get(), nullptr);
+    auto blitterTagAddress = device->getBlitterCommandStreamReceiver()->getTagAddress();
+    *blitterTagAddress = 0;
+
+    Event event(&commandQueue, CL_COMMAND_READ_BUFFER, 0, 0);
+    event.setBlitterTaskCount(1);
+    EXPECT_TRUE(commandQueue.isCompleted(event.getCompletionStamp()));
+    EXPECT_EQ(CL_SUBMITTED, event.updateEventAndReturnCurrentStatus());
+
+    *blitterTagAddress = 1;
+    EXPECT_EQ(CL_COMPLETE, event.updateEventAndReturnCurrentStatus());
+}
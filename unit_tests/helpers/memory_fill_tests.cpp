@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/memory_fill.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace OCLRT;
+
+TEST(MemoryFillTest, givenPatternWhenFillingMemoryThenWholeRegionContainsRepeatedPattern) {
+    const uint8_t pattern[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    for (size_t patternSize : {1u, 2u, 4u, 12u}) {
+        for (size_t size : {patternSize, patternSize * 3, patternSize * 64 + patternSize}) {
+            std::vector<uint8_t> memory(size + 1, 0xff);
+            fillMemoryWithPattern(memory.data(), size, pattern, patternSize);
+            for (size_t i = 0; i < size; i++) {
+                EXPECT_EQ(pattern[i % patternSize], memory[i]);
+            }
+            EXPECT_EQ(0xff, memory[size]);
+        }
+    }
+}
+
+TEST(MemoryFillTest, givenSizeSmallerThanPatternWhenFillingMemoryThenOnlySizeBytesAreWritten) {
+    const uint32_t pattern = 0x04030201;
+    uint8_t memory[4] = {0xff, 0xff, 0xff, 0xff};
+    fillMemoryWithPattern(memory, 2, &pattern, sizeof(pattern));
+    EXPECT_EQ(1u, memory[0]);
+    EXPECT_EQ(2u, memory[1]);
+    EXPECT_EQ(0xffu, memory[2]);
+    EXPECT_EQ(0xffu, memory[3]);
+}
@@ -35,7 +35,6 @@ struct TimestampPacketSimpleTests : public ::testing::Test {
       public:
         using BaseClass = TagAllocator<TagType>;
         using BaseClass::freeTags;
-        using BaseClass::usedTags;
         using NodeType = typename BaseClass::NodeType;
 
         MockTagAllocator(MemoryManager *memoryManager, size_t tagCount = 10) : BaseClass(memoryManager, tagCount, 10) {}
@@ -483,6 +483,10 @@ class CommandStreamReceiverMock : public CommandStreamReceiver {
 
     void flushBatchedSubmissions() override {}
 
+    uint32_t blitBuffer(const BlitProperties &blitProperties, OsContext &osContext) override {
+        return taskCount;
+    }
+
     CommandStreamReceiverType getType() override {
         return CommandStreamReceiverType::CSR_HW;
     }
@@ -343,6 +343,108 @@ TEST(Buffer, givenAllocHostPtrFlagAndRenderCompressedBuffersEnabledWhenAllocatio
     EXPECT_EQ(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED, type);
 }
 
+TEST(Buffer, givenReadOnlyHostPtrFlagAndRenderCompressedBuffersEnabledWhenAllocationTypeIsQueriedThenBufferHostMemoryTypeIsReturned) {
+    cl_mem_flags flags = CL_MEM_USE_HOST_PTR | CL_MEM_READ_ONLY | CL_MEM_HOST_NO_ACCESS | CL_MEM_READ_ONLY_HOST_PTR_INTEL;
+    auto type = MockPublicAccessBuffer::getGraphicsAllocationType(flags, false, true);
+    EXPECT_EQ(GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY, type);
+}
+
+TEST(Buffer, givenReadOnlyHostPtrFlagWhenBufferIsCreatedThenHostMemoryIsUsedDirectlyAndTrackedByHostPtrManagerUntilRelease) {
+    std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext ctx(device.get());
+    auto memoryManager = ctx.getMemoryManager();
+
+    cl_int retVal = 0;
+    cl_mem_flags flags = CL_MEM_USE_HOST_PTR | CL_MEM_READ_ONLY | CL_MEM_HOST_READ_ONLY | CL_MEM_READ_ONLY_HOST_PTR_INTEL;
+    void *hostPtr = alignedMalloc(2 * MemoryConstants::pageSize, MemoryConstants::pageSize);
+    auto importPtr = ptrOffset(hostPtr, MemoryConstants::cacheLineSize);
+
+    std::unique_ptr<Buffer> buffer(Buffer::create(&ctx, flags, MemoryConstants::pageSize, importPtr, retVal));
+    ASSERT_NE(nullptr, buffer.get());
+    EXPECT_TRUE(buffer->isMemObjZeroCopy());
+    EXPECT_EQ(importPtr, buffer->getGraphicsAllocation()->getUnderlyingBuffer());
+    EXPECT_TRUE(buffer->getGraphicsAllocation()->isReadOnlyHostMemory());
+    EXPECT_EQ(GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY, buffer->getGraphicsAllocation()->getAllocationType());
+
+    auto fragment = memoryManager->hostPtrManager.getFragment(importPtr);
+    ASSERT_NE(nullptr, fragment);
+    EXPECT_TRUE(fragment->driverAllocation);
+    EXPECT_EQ(hostPtr, fragment->fragmentCpuPointer);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, fragment->fragmentSize);
+
+    buffer.reset();
+    EXPECT_EQ(nullptr, memoryManager->hostPtrManager.getFragment(importPtr));
+    alignedFree(hostPtr);
+}
+
+TEST(Buffer, givenReadOnlyHostPtrOverlappingAlreadyImportedPagesWhenBufferIsCreatedThenHostMemoryIsCopied) {
+    std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext ctx(device.get());
+
+    cl_int retVal = 0;
+    cl_mem_flags flags = CL_MEM_USE_HOST_PTR | CL_MEM_READ_ONLY | CL_MEM_HOST_NO_ACCESS | CL_MEM_READ_ONLY_HOST_PTR_INTEL;
+    void *hostPtr = alignedMalloc(2 * MemoryConstants::pageSize, MemoryConstants::pageSize);
+    memset(hostPtr, 0xAA, 2 * MemoryConstants::pageSize);
+    auto secondImportPtr = ptrOffset(hostPtr, MemoryConstants::pageSize - MemoryConstants::cacheLineSize);
+
+    std::unique_ptr<Buffer> firstBuffer(Buffer::create(&ctx, flags, MemoryConstants::pageSize, hostPtr, retVal));
+    ASSERT_NE(nullptr, firstBuffer.get());
+    EXPECT_TRUE(firstBuffer->isMemObjZeroCopy());
+
+    std::unique_ptr<Buffer> secondBuffer(Buffer::create(&ctx, flags, MemoryConstants::pageSize, secondImportPtr, retVal));
+    ASSERT_NE(nullptr, secondBuffer.get());
+    EXPECT_FALSE(secondBuffer->isMemObjZeroCopy());
+    EXPECT_NE(secondImportPtr, secondBuffer->getGraphicsAllocation()->getUnderlyingBuffer());
+    EXPECT_FALSE(secondBuffer->getGraphicsAllocation()->isReadOnlyHostMemory());
+    EXPECT_THAT(secondBuffer->getGraphicsAllocation()->getUnderlyingBuffer(), MemCompare(secondImportPtr, MemoryConstants::pageSize));
+
+    secondBuffer.reset();
+    EXPECT_NE(nullptr, ctx.getMemoryManager()->hostPtrManager.getFragment(hostPtr));
+    firstBuffer.reset();
+    EXPECT_EQ(nullptr, ctx.getMemoryManager()->hostPtrManager.getFragment(hostPtr));
+    alignedFree(hostPtr);
+}
+
+TEST(Buffer, givenReadOnlyHostPtrBufferWhenCheckingFillOnCpuThenItIsNotPossible) {
+    std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext ctx(device.get());
+
+    cl_int retVal = 0;
+    cl_mem_flags flags = CL_MEM_USE_HOST_PTR | CL_MEM_READ_ONLY | CL_MEM_HOST_NO_ACCESS | CL_MEM_READ_ONLY_HOST_PTR_INTEL;
+    void *hostPtr = alignedMalloc(MemoryConstants::pageSize, MemoryConstants::pageSize);
+
+    std::unique_ptr<Buffer> buffer(Buffer::create(&ctx, flags, MemoryConstants::pageSize, hostPtr, retVal));
+    ASSERT_NE(nullptr, buffer.get());
+    EXPECT_TRUE(buffer->isMemObjZeroCopy());
+    EXPECT_TRUE(buffer->deviceWriteMemObjFlagsInvalid());
+    EXPECT_FALSE(buffer->isFillOnCpuPossible());
+
+    buffer.reset();
+    alignedFree(hostPtr);
+}
+
+TEST(Buffer, givenReadOnlyHostPtrFlagAndForced32BitAllocationsWhenBufferIsCreatedThenHostMemoryIsCopied) {
+    std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext ctx(device.get());
+    ctx.getMemoryManager()->setForce32BitAllocations(true);
+
+    cl_int retVal = 0;
+    cl_mem_flags flags = CL_MEM_USE_HOST_PTR | CL_MEM_READ_ONLY | CL_MEM_HOST_NO_ACCESS | CL_MEM_READ_ONLY_HOST_PTR_INTEL;
+    void *hostPtr = alignedMalloc(MemoryConstants::pageSize, MemoryConstants::pageSize);
+    memset(hostPtr, 0xAA, MemoryConstants::pageSize);
+
+    std::unique_ptr<Buffer> buffer(Buffer::create(&ctx, flags, MemoryConstants::pageSize, hostPtr, retVal));
+    ASSERT_NE(nullptr, buffer.get());
+    if (is64bit) {
+        EXPECT_FALSE(buffer->isMemObjZeroCopy());
+        EXPECT_NE(hostPtr, buffer->getGraphicsAllocation()->getUnderlyingBuffer());
+        EXPECT_THAT(buffer->getGraphicsAllocation()->getUnderlyingBuffer(), MemCompare(hostPtr, MemoryConstants::pageSize));
+    }
+
+    buffer.reset();
+    alignedFree(hostPtr);
+}
+
 TEST(Buffer, givenZeroFlagsNoSharedContextAndRenderCompressedBuffersDisabledWhenAllocationTypeIsQueriedThenBufferTypeIsReturned) {
     cl_mem_flags flags = 0;
     auto type = MockPublicAccessBuffer::getGraphicsAllocationType(flags, false, false);
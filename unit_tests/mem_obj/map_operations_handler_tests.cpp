@@ -16,6 +16,7 @@ using namespace OCLRT;
 struct MockMapOperationsHandler : public MapOperationsHandler {
     using MapOperationsHandler::isOverlapping;
     using MapOperationsHandler::mappedPointers;
+    using MapOperationsHandler::mappedRanges;
 };
 
 struct MapOperationsHandlerTests : public ::testing::Test {
@@ -73,27 +74,27 @@ TEST_F(MapOperationsHandlerTests, givenMappedPtrsWhenDoubleRemovedThenDoNothing)
 TEST_F(MapOperationsHandlerTests, givenMapInfoWhenAddedThenSetReadOnlyFlag) {
     mapFlags = CL_MAP_READ;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 }
 
@@ -103,7 +104,7 @@ TEST_F(MapOperationsHandlerTests, givenNonReadOnlyOverlappingPtrWhenAddingThenRe
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     EXPECT_TRUE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_FALSE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
     EXPECT_EQ(1u, mockHandler.size());
@@ -115,11 +116,77 @@ TEST_F(MapOperationsHandlerTests, givenReadOnlyOverlappingPtrWhenAddingThenRetur
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0);
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     EXPECT_FALSE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_TRUE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
     EXPECT_EQ(2u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
+}
+
+TEST_F(MapOperationsHandlerTests, givenLongReadOnlyMappingStartingFarBeforeRequestedPtrWhenAddingNonReadOnlyPtrThenReturnFalse) {
+    MapInfo longMapInfo((void *)0x1000, 0x10000, {{0, 0, 0}}, {{0, 0, 0}}, 0);
+    mapFlags = CL_MAP_READ;
+    EXPECT_TRUE(mockHandler.add(longMapInfo.ptr, longMapInfo.ptrLength, mapFlags, longMapInfo.size, longMapInfo.offset, 0));
+    EXPECT_TRUE(mockHandler.add(mappedPtrs[1].ptr, mappedPtrs[1].ptrLength, mapFlags, mappedPtrs[1].size, mappedPtrs[1].offset, 0));
+
+    mapFlags = CL_MAP_WRITE;
+    EXPECT_FALSE(mockHandler.add((void *)0x8000, 1, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
+
+    mockHandler.remove(longMapInfo.ptr);
+    EXPECT_TRUE(mockHandler.add((void *)0x8000, 1, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
+    EXPECT_EQ(2u, mockHandler.size());
+}
+
+TEST_F(MapOperationsHandlerTests, givenOverlappingReadOnlyMappingsWhenAddingAndRemovingThenMappedRangesAreMergedByCoverage) {
+    mapFlags = CL_MAP_READ;
+    EXPECT_TRUE(mockHandler.add((void *)0x1000, 0x3000, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
+    EXPECT_TRUE(mockHandler.add((void *)0x2000, 0x3000, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
+
+    std::map<const void *, uint32_t> expectedRanges = {{(void *)0x1000, 1}, {(void *)0x2000, 2}, {(void *)0x4000, 1}, {(void *)0x5000, 0}};
+    EXPECT_EQ(expectedRanges, mockHandler.mappedRanges);
+
+    mapFlags = CL_MAP_WRITE;
+    EXPECT_TRUE(mockHandler.add((void *)0x6000, 0x1000, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
+    EXPECT_FALSE(mockHandler.add((void *)0x4800, 0x100, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
+    EXPECT_FALSE(mockHandler.add((void *)0x5800, 0x800, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
+    EXPECT_TRUE(mockHandler.add((void *)0x5000, 0x800, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
+
+    mockHandler.remove((void *)0x1000);
+    mockHandler.remove((void *)0x6000);
+    expectedRanges = {{(void *)0x2000, 1}, {(void *)0x5800, 0}};
+    EXPECT_EQ(expectedRanges, mockHandler.mappedRanges);
+
+    mockHandler.remove((void *)0x2000);
+    mockHandler.remove((void *)0x5000);
+    EXPECT_TRUE(mockHandler.mappedRanges.empty());
+}
+
+TEST_F(MapOperationsHandlerTests, givenManyOutstandingMappingsWhenAddingFindingAndRemovingThenAllOperationsSucceed) {
+    const size_t numMappings = 10000;
+    const size_t mappingLength = 0x100;
+    auto basePtr = reinterpret_cast<void *>(0x10000);
+    mapFlags = CL_MAP_WRITE;
+
+    for (size_t i = 0; i < numMappings; i++) {
+        EXPECT_TRUE(mockHandler.add(ptrOffset(basePtr, 2 * i * mappingLength), mappingLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
+    }
+    EXPECT_EQ(numMappings, mockHandler.size());
+    EXPECT_EQ(2 * numMappings, mockHandler.mappedRanges.size());
+
+    for (size_t i = 0; i < numMappings; i++) {
+        EXPECT_FALSE(mockHandler.add(ptrOffset(basePtr, 2 * i * mappingLength + 1), 1, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0));
+    }
+    EXPECT_EQ(numMappings, mockHandler.size());
+
+    for (size_t i = 0; i < numMappings; i++) {
+        MapInfo receivedMapInfo;
+        auto mappedPtr = ptrOffset(basePtr, 2 * i * mappingLength);
+        EXPECT_TRUE(mockHandler.find(mappedPtr, receivedMapInfo));
+        EXPECT_EQ(mappedPtr, receivedMapInfo.ptr);
+        mockHandler.remove(mappedPtr);
+    }
+    EXPECT_EQ(0u, mockHandler.size());
+    EXPECT_TRUE(mockHandler.mappedRanges.empty());
 }
 
 const std::tuple<void *, size_t, void *, size_t, bool> overlappingCombinations[] = {
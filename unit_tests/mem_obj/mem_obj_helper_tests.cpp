@@ -6,6 +6,7 @@
  */
 
 #include "runtime/mem_obj/mem_obj_helper.h"
+#include "public/cl_ext_private.h"
 #include "gtest/gtest.h"
 
 using namespace OCLRT;
@@ -24,6 +25,14 @@ TEST(MemObjHelper, givenInvalidMemFlagsForBufferWhenFlagsAreCheckedThenFalseIsRe
     EXPECT_FALSE(MemObjHelper::checkMemFlagsForBuffer(flags));
 }
 
+TEST(MemObjHelper, givenReadOnlyHostPtrFlagWhenFlagsAreCheckedThenTrueIsReturnedAndAllocationFlagsRequestReadOnlyHostPtr) {
+    cl_mem_flags flags = CL_MEM_USE_HOST_PTR | CL_MEM_READ_ONLY | CL_MEM_HOST_NO_ACCESS | CL_MEM_READ_ONLY_HOST_PTR_INTEL;
+    EXPECT_TRUE(MemObjHelper::checkMemFlagsForBuffer(flags));
+
+    EXPECT_EQ(1u, MemObjHelper::getAllocationFlags(flags, false).flags.readOnlyHostPtr);
+    EXPECT_EQ(0u, MemObjHelper::getAllocationFlags(CL_MEM_USE_HOST_PTR, false).flags.readOnlyHostPtr);
+}
+
 TEST(MemObjHelper, givenValidMemFlagsForSubBufferWhenFlagsAreCheckedThenTrueIsReturned) {
     cl_mem_flags flags = CL_MEM_READ_WRITE | CL_MEM_WRITE_ONLY | CL_MEM_READ_ONLY |
                          CL_MEM_HOST_WRITE_ONLY | CL_MEM_HOST_READ_ONLY | CL_MEM_HOST_NO_ACCESS;
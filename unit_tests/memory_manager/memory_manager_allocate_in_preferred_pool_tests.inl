@@ -53,6 +53,22 @@ TEST(MemoryManagerGetAlloctionDataTest, givenAllocateMemoryFlagTrueWhenHostPtrIs
     EXPECT_EQ(nullptr, allocData.hostPtr);
 }
 
+TEST(MemoryManagerGetAlloctionDataTest, givenReadOnlyHostPtrFlagWhenAllocationDataIsQueriedThenFlagIsSetOnlyWhenHostPtrIsUsed) {
+    AllocationData allocData;
+    char memory = 0;
+    AllocationFlags flags(false);
+    flags.flags.readOnlyHostPtr = true;
+
+    MockMemoryManager::getAllocationData(allocData, flags, 0, &memory, sizeof(memory), GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY);
+    EXPECT_TRUE(allocData.flags.readOnlyHostPtr);
+    EXPECT_EQ(&memory, allocData.hostPtr);
+
+    flags.flags.allocateMemory = true;
+    MockMemoryManager::getAllocationData(allocData, flags, 0, &memory, sizeof(memory), GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY);
+    EXPECT_FALSE(allocData.flags.readOnlyHostPtr);
+    EXPECT_EQ(nullptr, allocData.hostPtr);
+}
+
 TEST(MemoryManagerGetAlloctionDataTest, givenBufferTypeWhenAllocationDataIsQueriedThenForcePinFlagIsSet) {
     AllocationData allocData;
     AllocationFlags flags(true);
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/execution_environment/execution_environment.h"
+#include "runtime/memory_manager/os_agnostic_memory_manager.h"
+#include "runtime/memory_manager/scratch_space_manager.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+using namespace OCLRT;
+
+struct ScratchSpaceManagerTest : public ::testing::Test {
+    void SetUp() override {
+        memoryManager = std::make_unique<OsAgnosticMemoryManager>(false, false, executionEnvironment);
+        scratchSpaceManager = memoryManager->getScratchSpaceManager();
+    }
+
+    volatile uint32_t completionTag = 0;
+    ExecutionEnvironment executionEnvironment;
+    std::unique_ptr<OsAgnosticMemoryManager> memoryManager;
+    ScratchSpaceManager *scratchSpaceManager = nullptr;
+};
+
+TEST(ScratchSpaceManagerSizeClassTest, givenRequiredSizeWhenGettingSizeClassThenSizeIsRoundedToQuarterOfItsPowerOfTwoRange) {
+    EXPECT_EQ(ScratchSpaceManager::minSizeClass, ScratchSpaceManager::getSizeClass(1));
+    EXPECT_EQ(64 * MemoryConstants::kiloByte, ScratchSpaceManager::getSizeClass(64 * MemoryConstants::kiloByte));
+    EXPECT_EQ(80 * MemoryConstants::kiloByte, ScratchSpaceManager::getSizeClass(64 * MemoryConstants::kiloByte + 1));
+    EXPECT_EQ(128 * MemoryConstants::kiloByte, ScratchSpaceManager::getSizeClass(128 * MemoryConstants::kiloByte));
+    EXPECT_EQ(160 * MemoryConstants::kiloByte, ScratchSpaceManager::getSizeClass(129 * MemoryConstants::kiloByte));
+    EXPECT_EQ(5 * MemoryConstants::megaByte, ScratchSpaceManager::getSizeClass(4 * MemoryConstants::megaByte + 1));
+}
+
+TEST_F(ScratchSpaceManagerTest, givenRequiredSizeWhenObtainingScratchSpaceThenAllocationOfSizeClassIsReturned) {
+    auto allocation = scratchSpaceManager->obtainScratchSpace(100 * MemoryConstants::kiloByte);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(ScratchSpaceManager::getSizeClass(100 * MemoryConstants::kiloByte), allocation->getUnderlyingBufferSize());
+    EXPECT_EQ(GraphicsAllocation::AllocationType::SCRATCH_SURFACE, allocation->getAllocationType());
+
+    auto statistics = scratchSpaceManager->getStatistics();
+    EXPECT_EQ(1u, statistics.allocationsCount);
+    EXPECT_EQ(allocation->getUnderlyingBufferSize(), statistics.usedSize);
+    EXPECT_EQ(allocation->getUnderlyingBufferSize(), statistics.peakSize);
+    EXPECT_EQ(0u, statistics.pooledSize);
+
+    scratchSpaceManager->releaseScratchSpace(allocation, nullptr, 0);
+}
+
+TEST_F(ScratchSpaceManagerTest, givenScratchReleasedWithPendingWorkWhenObtainingScratchSpaceThenItIsReusedOnlyAfterWorkCompletes) {
+    auto allocation = scratchSpaceManager->obtainScratchSpace(MemoryConstants::megaByte);
+    scratchSpaceManager->releaseScratchSpace(allocation, &completionTag, 2);
+
+    auto otherAllocation = scratchSpaceManager->obtainScratchSpace(MemoryConstants::megaByte);
+    EXPECT_NE(allocation, otherAllocation);
+    scratchSpaceManager->releaseScratchSpace(otherAllocation, &completionTag, 3);
+
+    completionTag = 2;
+    EXPECT_EQ(allocation, scratchSpaceManager->obtainScratchSpace(MemoryConstants::megaByte));
+
+    auto statistics = scratchSpaceManager->getStatistics();
+    EXPECT_EQ(2u, statistics.allocationsCount);
+    EXPECT_EQ(1u, statistics.reusesCount);
+    EXPECT_EQ(allocation->getUnderlyingBufferSize(), statistics.usedSize);
+    EXPECT_EQ(otherAllocation->getUnderlyingBufferSize(), statistics.pooledSize);
+
+    completionTag = 3;
+    scratchSpaceManager->releaseScratchSpace(allocation, nullptr, 0);
+}
+
+TEST_F(ScratchSpaceManagerTest, givenPooledScratchMuchBiggerThanRequiredWhenObtainingScratchSpaceThenNewAllocationIsCreated) {
+    auto bigAllocation = scratchSpaceManager->obtainScratchSpace(4 * MemoryConstants::megaByte);
+    scratchSpaceManager->releaseScratchSpace(bigAllocation, nullptr, 0);
+
+    auto smallAllocation = scratchSpaceManager->obtainScratchSpace(MemoryConstants::megaByte);
+    EXPECT_NE(bigAllocation, smallAllocation);
+    scratchSpaceManager->releaseScratchSpace(smallAllocation, nullptr, 0);
+
+    EXPECT_EQ(bigAllocation, scratchSpaceManager->obtainScratchSpace(3 * MemoryConstants::megaByte));
+    scratchSpaceManager->releaseScratchSpace(bigAllocation, nullptr, 0);
+}
+
+TEST_F(ScratchSpaceManagerTest, givenPooledScratchesWhenObtainingScratchSpaceThenSmallestFittingOneIsReused) {
+    auto biggerAllocation = scratchSpaceManager->obtainScratchSpace(2 * MemoryConstants::megaByte);
+    auto smallerAllocation = scratchSpaceManager->obtainScratchSpace(MemoryConstants::megaByte + 1);
+    scratchSpaceManager->releaseScratchSpace(biggerAllocation, nullptr, 0);
+    scratchSpaceManager->releaseScratchSpace(smallerAllocation, nullptr, 0);
+
+    auto allocation = scratchSpaceManager->obtainScratchSpace(MemoryConstants::megaByte);
+    EXPECT_EQ(smallerAllocation, allocation);
+    scratchSpaceManager->releaseScratchSpace(allocation, nullptr, 0);
+}
+
+TEST_F(ScratchSpaceManagerTest, givenCompletionTagReleasedWhenObtainingScratchSpaceThenScratchWaitingForThatTagIsReused) {
+    auto allocation = scratchSpaceManager->obtainScratchSpace(MemoryConstants::megaByte);
+    scratchSpaceManager->releaseScratchSpace(allocation, &completionTag, 5);
+
+    scratchSpaceManager->releaseCompletionTag(&completionTag);
+    EXPECT_EQ(allocation, scratchSpaceManager->obtainScratchSpace(MemoryConstants::megaByte));
+    scratchSpaceManager->releaseScratchSpace(allocation, nullptr, 0);
+}
+
+TEST_F(ScratchSpaceManagerTest, givenScratchIdleLongerThanIdleTimeWhenTrimmingThenOnlyCompletedScratchIsFreed) {
+    auto completedAllocation = scratchSpaceManager->obtainScratchSpace(MemoryConstants::megaByte);
+    auto pendingAllocation = scratchSpaceManager->obtainScratchSpace(MemoryConstants::megaByte);
+    scratchSpaceManager->releaseScratchSpace(completedAllocation, nullptr, 0);
+    scratchSpaceManager->releaseScratchSpace(pendingAllocation, &completionTag, 1);
+
+    scratchSpaceManager->trimIdle(ScratchSpaceManager::Clock::now());
+    EXPECT_EQ(0u, scratchSpaceManager->getStatistics().trimsCount);
+
+    auto idleTime = std::chrono::milliseconds(DebugManager.flags.ScratchSpaceIdleTimeMs.get());
+    scratchSpaceManager->trimIdle(ScratchSpaceManager::Clock::now() + idleTime);
+
+    auto statistics = scratchSpaceManager->getStatistics();
+    EXPECT_EQ(1u, statistics.trimsCount);
+    EXPECT_EQ(pendingAllocation->getUnderlyingBufferSize(), statistics.pooledSize);
+
+    completionTag = 1;
+}
+
+TEST(ScratchSpaceManagerIdleTimeTest, givenNegativeIdleTimeWhenTrimmingThenScratchIsNotFreed) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ScratchSpaceIdleTimeMs.set(-1);
+
+    ExecutionEnvironment executionEnvironment;
+    OsAgnosticMemoryManager memoryManager(false, false, executionEnvironment);
+    auto scratchSpaceManager = memoryManager.getScratchSpaceManager();
+
+    auto allocation = scratchSpaceManager->obtainScratchSpace(MemoryConstants::megaByte);
+    scratchSpaceManager->releaseScratchSpace(allocation, nullptr, 0);
+    scratchSpaceManager->trimIdle(ScratchSpaceManager::Clock::now() + std::chrono::hours(1));
+
+    EXPECT_EQ(0u, scratchSpaceManager->getStatistics().trimsCount);
+    EXPECT_EQ(allocation, scratchSpaceManager->obtainScratchSpace(MemoryConstants::megaByte));
+    scratchSpaceManager->releaseScratchSpace(allocation, nullptr, 0);
+}
@@ -151,3 +151,122 @@ TEST_F(SVMMemoryAllocatorTest, given64kbAllowedwhenAllocatingSvmMemoryThenDontPr
     myMemoryManager.allocateGraphicsMemoryForSVM(1, false);
     EXPECT_FALSE(myMemoryManager.preferRenderCompressedFlag);
 }
+
+TEST_F(SVMMemoryAllocatorTest, givenMultipleSvmAllocationsWhenOneIsFreedThenLookupsFindRemainingAllocationsByInnerPointers) {
+    ExecutionEnvironment executionEnvironment;
+    OsAgnosticMemoryManager memoryManager(false, false, executionEnvironment);
+    {
+        SVMAllocsManager svmM(&memoryManager);
+        char *ptrs[3];
+        for (auto &ptr : ptrs) {
+            ptr = static_cast<char *>(svmM.createSVMAlloc(4096));
+            ASSERT_NE(nullptr, ptr);
+        }
+
+        svmM.freeSVMAlloc(ptrs[1]);
+        EXPECT_EQ(2u, svmM.getNumAllocs());
+        EXPECT_EQ(nullptr, svmM.getSVMAlloc(ptrs[1]));
+        EXPECT_EQ(nullptr, svmM.getSVMAlloc(ptrs[1] + 100));
+
+        for (auto ptr : {ptrs[0], ptrs[2]}) {
+            auto allocation = svmM.getSVMAlloc(ptr + 4095);
+            ASSERT_NE(nullptr, allocation);
+            EXPECT_EQ(ptr, allocation->getUnderlyingBuffer());
+            EXPECT_EQ(allocation, svmM.getSVMAlloc(ptr));
+        }
+
+        svmM.freeSVMAlloc(ptrs[0]);
+        svmM.freeSVMAlloc(ptrs[2]);
+        EXPECT_EQ(0u, svmM.getNumAllocs());
+    }
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenManySvmAllocationsWhenFreedInterleavedThenLookupsStayConsistent) {
+    const size_t allocationCount = 1000;
+    const size_t allocationSize = 4096;
+    ExecutionEnvironment executionEnvironment;
+    OsAgnosticMemoryManager memoryManager(false, false, executionEnvironment);
+    {
+        SVMAllocsManager svmM(&memoryManager);
+        std::vector<char *> ptrs(allocationCount);
+        for (auto &ptr : ptrs) {
+            ptr = static_cast<char *>(svmM.createSVMAlloc(allocationSize));
+            ASSERT_NE(nullptr, ptr);
+        }
+        EXPECT_EQ(allocationCount, svmM.getNumAllocs());
+
+        for (size_t i = 0; i < allocationCount; i += 2) {
+            svmM.freeSVMAlloc(ptrs[i]);
+        }
+        EXPECT_EQ(allocationCount / 2, svmM.getNumAllocs());
+
+        for (size_t i = 0; i < allocationCount; i++) {
+            auto allocation = svmM.getSVMAlloc(ptrs[i] + allocationSize - 1);
+            if (i % 2) {
+                ASSERT_NE(nullptr, allocation);
+                EXPECT_EQ(ptrs[i], allocation->getUnderlyingBuffer());
+            } else {
+                EXPECT_EQ(nullptr, allocation);
+            }
+        }
+
+        for (size_t i = 1; i < allocationCount; i += 2) {
+            svmM.freeSVMAlloc(ptrs[i]);
+        }
+        EXPECT_EQ(0u, svmM.getNumAllocs());
+    }
+}
+
+struct MockSVMAllocsManagerWithSnapshots : SVMAllocsManager {
+    using SVMAllocsManager::activeReaders;
+    using SVMAllocsManager::mtx;
+    using SVMAllocsManager::retiredSnapshots;
+    using SVMAllocsManager::snapshot;
+    using SVMAllocsManager::SVMAllocsManager;
+};
+
+TEST_F(SVMMemoryAllocatorTest, givenManagerMutexHeldWhenLookingUpSvmAllocationThenLookupCompletesWithoutTakingMutex) {
+    ExecutionEnvironment executionEnvironment;
+    OsAgnosticMemoryManager memoryManager(false, false, executionEnvironment);
+    {
+        MockSVMAllocsManagerWithSnapshots svmM(&memoryManager);
+        auto ptr = static_cast<char *>(svmM.createSVMAlloc(4096));
+        ASSERT_NE(nullptr, ptr);
+
+        GraphicsAllocation *allocation = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(svmM.mtx);
+            allocation = std::async(std::launch::async, [&] { return svmM.getSVMAlloc(ptr + 100); }).get();
+        }
+        ASSERT_NE(nullptr, allocation);
+        EXPECT_EQ(ptr, allocation->getUnderlyingBuffer());
+        EXPECT_EQ(0u, svmM.activeReaders.load());
+
+        svmM.freeSVMAlloc(ptr);
+    }
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenLookupInFlightWhenSvmAllocationsChangeThenReplacedSnapshotsAreKeptUntilNoLookupIsInFlight) {
+    ExecutionEnvironment executionEnvironment;
+    OsAgnosticMemoryManager memoryManager(false, false, executionEnvironment);
+    {
+        MockSVMAllocsManagerWithSnapshots svmM(&memoryManager);
+        EXPECT_TRUE(svmM.retiredSnapshots.empty());
+
+        svmM.activeReaders++;
+        auto snapshotSeenByReader = svmM.snapshot.load();
+        auto ptr = static_cast<char *>(svmM.createSVMAlloc(4096));
+        ASSERT_NE(nullptr, ptr);
+
+        ASSERT_EQ(1u, svmM.retiredSnapshots.size());
+        EXPECT_EQ(snapshotSeenByReader, svmM.retiredSnapshots[0].get());
+        EXPECT_NE(snapshotSeenByReader, svmM.snapshot.load());
+        EXPECT_EQ(nullptr, snapshotSeenByReader->get(ptr));
+        EXPECT_NE(nullptr, svmM.snapshot.load()->get(ptr));
+
+        svmM.activeReaders--;
+        svmM.freeSVMAlloc(ptr);
+        EXPECT_TRUE(svmM.retiredSnapshots.empty());
+        EXPECT_EQ(nullptr, svmM.getSVMAlloc(ptr));
+    }
+}
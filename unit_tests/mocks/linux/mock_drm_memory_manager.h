@@ -12,6 +12,9 @@ static off_t lseekReturn = 4096u;
 static int lseekCalledCount = 0;
 static int mmapMockCallCount = 0;
 static int munmapMockCallCount = 0;
+static int madviseMockCallCount = 0;
+static int mmapMockFlags = 0;
+static int madviseMockAdvice = 0;
 
 off_t lseekMock(int fd, off_t offset, int whence) noexcept {
     lseekCalledCount++;
@@ -20,6 +23,7 @@ off_t lseekMock(int fd, off_t offset, int whence) noexcept {
 void *mmapMock(void *addr, size_t length, int prot, int flags,
                int fd, long offset) noexcept {
     mmapMockCallCount++;
+    mmapMockFlags = flags;
     return reinterpret_cast<void *>(0x1000);
 }
 
@@ -28,6 +32,12 @@ int munmapMock(void *addr, size_t length) noexcept {
     return 0;
 }
 
+int madviseMock(void *addr, size_t length, int advice) noexcept {
+    madviseMockCallCount++;
+    madviseMockAdvice = advice;
+    return 0;
+}
+
 int closeMock(int) {
     return 0;
 }
@@ -42,21 +52,29 @@ class TestedDrmMemoryManager : public DrmMemoryManager {
         this->lseekFunction = &lseekMock;
         this->mmapFunction = &mmapMock;
         this->munmapFunction = &munmapMock;
+        this->madviseFunction = &madviseMock;
         this->closeFunction = &closeMock;
         lseekReturn = 4096;
         lseekCalledCount = 0;
         mmapMockCallCount = 0;
         munmapMockCallCount = 0;
+        madviseMockCallCount = 0;
+        mmapMockFlags = 0;
+        madviseMockAdvice = 0;
     };
     TestedDrmMemoryManager(Drm *drm, bool allowForcePin, bool validateHostPtrMemory, ExecutionEnvironment &executionEnvironment) : DrmMemoryManager(drm, gemCloseWorkerMode::gemCloseWorkerInactive, allowForcePin, validateHostPtrMemory, executionEnvironment) {
         this->lseekFunction = &lseekMock;
         this->mmapFunction = &mmapMock;
         this->munmapFunction = &munmapMock;
+        this->madviseFunction = &madviseMock;
         this->closeFunction = &closeMock;
         lseekReturn = 4096;
         lseekCalledCount = 0;
         mmapMockCallCount = 0;
         munmapMockCallCount = 0;
+        madviseMockCallCount = 0;
+        mmapMockFlags = 0;
+        madviseMockAdvice = 0;
     }
 
     void unreference(BufferObject *bo) {
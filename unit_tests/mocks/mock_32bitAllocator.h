@@ -24,6 +24,7 @@ static uintptr_t offsetIn32BitRange = 0;
 static uint32_t mmapCallCount = 0u;
 static uint32_t unmapCallCount = 0u;
 static uint32_t mmapFailCount = 0u;
+static uint32_t madviseCallCount = 0u;
 
 void *MockMmap(void *addr, size_t length, int prot, int flags,
                int fd, off_t offset) noexcept {
@@ -82,6 +83,10 @@ int MockMunmap(void *addr, size_t length) noexcept {
     unmapCallCount++;
     return 0;
 }
+int MockMadvise(void *addr, size_t length, int advice) noexcept {
+    madviseCallCount++;
+    return 0;
+}
 
 class mockAllocator32Bit : public Allocator32bit {
   public:
@@ -94,6 +99,7 @@ class mockAllocator32Bit : public Allocator32bit {
     mockAllocator32Bit() {
         this->osInternals->mmapFunction = MockMmap;
         this->osInternals->munmapFunction = MockMunmap;
+        this->osInternals->madviseFunction = MockMadvise;
         resetState();
     }
     ~mockAllocator32Bit() {
@@ -110,6 +116,7 @@ class mockAllocator32Bit : public Allocator32bit {
         mmapCallCount = 0u;
         unmapCallCount = 0u;
         mmapFailCount = 0u;
+        madviseCallCount = 0u;
     }
 
     static OsInternalsPublic *createOsInternals() {
@@ -17,6 +17,7 @@ class MockCommandQueue : public CommandQueue {
   public:
     using CommandQueue::device;
     using CommandQueue::obtainNewTimestampPacketNodes;
+    using CommandQueue::readyCommands;
     using CommandQueue::timestampPacketContainer;
 
     void setProfilingEnabled() {
@@ -236,6 +236,10 @@ class MockCommandStreamReceiver : public CommandStreamReceiver {
         }
     }
 
+    uint32_t blitBuffer(const BlitProperties &blitProperties, OsContext &osContext) override {
+        return taskCount;
+    }
+
     void waitForTaskCountWithKmdNotifyFallback(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool quickKmdSleep, OsContext &osContext) override {
     }
 
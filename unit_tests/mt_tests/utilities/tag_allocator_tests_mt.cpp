@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/tag_allocator.h"
+#include "unit_tests/mocks/mock_memory_manager.h"
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+struct MtTestTag {
+    void initialize() { owner = 0; }
+    bool canBeReleased() const { return true; }
+    std::atomic<uint32_t> owner;
+};
+
+class MtMockTagAllocator : public TagAllocator<MtTestTag> {
+  public:
+    using TagAllocator<MtTestTag>::TagAllocator;
+    using TagAllocator<MtTestTag>::getCurrentThreadCache;
+
+    size_t getGraphicsAllocationsCount() {
+        return gfxAllocations.size();
+    }
+};
+
+TEST(TagAllocatorMtTest, givenManyThreadsTakingAndReturningTagsThenEachTagIsOwnedByOneThreadAtATime) {
+    const uint32_t threadCount = 8;
+    const uint32_t iterations = 20000;
+    const uint32_t tagsHeldPerIteration = 4;
+    const size_t tagCount = 64;
+
+    MockMemoryManager memoryManager;
+    MtMockTagAllocator tagAllocator(&memoryManager, tagCount, MemoryConstants::cacheLineSize);
+
+    std::atomic<bool> start{false};
+    std::atomic<uint32_t> ownershipViolations{0};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < threadCount; t++) {
+        threads.emplace_back([&, t]() {
+            while (!start)
+                ;
+            TagNode<MtTestTag> *nodes[tagsHeldPerIteration];
+            for (uint32_t i = 0; i < iterations; i++) {
+                for (auto &node : nodes) {
+                    node = tagAllocator.getTag();
+                    uint32_t expectedOwner = 0;
+                    if (!node->tag->owner.compare_exchange_strong(expectedOwner, t + 1)) {
+                        ownershipViolations++;
+                    }
+                }
+                for (auto &node : nodes) {
+                    node->tag->owner = 0;
+                    tagAllocator.returnTag(node);
+                }
+            }
+        });
+    }
+    start = true;
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, ownershipViolations);
+    // at most half of the pool is held at any time, tags cached by other threads must be reused before a new pool is created
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+
+    // every tag went back to the allocator, so the whole pool can be taken again without growing it
+    TagNode<MtTestTag> *nodes[tagCount];
+    for (auto &node : nodes) {
+        node = tagAllocator.getTag();
+        EXPECT_EQ(0u, node->tag->owner.load());
+    }
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+    for (auto node : nodes) {
+        tagAllocator.returnTag(node);
+    }
+}
+
+TEST(TagAllocatorMtTest, givenTagsCachedByIdleThreadWhenPoolIsExhaustedByOtherThreadThenCachedTagsAreReusedInsteadOfNewPool) {
+    const size_t tagCount = 8;
+    MockMemoryManager memoryManager;
+    MtMockTagAllocator tagAllocator(&memoryManager, tagCount, MemoryConstants::cacheLineSize);
+
+    std::thread idleThread([&]() {
+        auto node = tagAllocator.getTag();
+        tagAllocator.returnTag(node);
+        EXPECT_FALSE(tagAllocator.getCurrentThreadCache().tags.peekIsEmpty());
+    });
+    idleThread.join();
+
+    TagNode<MtTestTag> *nodes[tagCount];
+    for (auto &node : nodes) {
+        node = tagAllocator.getTag();
+    }
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+
+    for (auto node : nodes) {
+        tagAllocator.returnTag(node);
+    }
+}
@@ -311,4 +311,27 @@ TEST(DecoderTests, GivenValidBinaryWhenProcessingBinaryThenProgramAndKernelAndPa
     std::string expectedOutput = "ProgramBinaryHeader:\n\t4 Magic 1229870147\n\t4 Version 1042\n\t4 Device 12\n\t4 GPUPointerSizeInBytes 4\n\t4 NumberOfKernels 1\n\t4 SteppingId 2\n\t4 PatchListSize 30\nPATCH_TOKEN_ALLOCATE_CONSTANT_MEMORY_SURFACE_PROGRAM_BINARY_INFO:\n\t4 Token 42\n\t4 Size 16\n\t4 ConstantBufferIndex 0\n\t4 InlineDataSize 14\n\tHex 48 65 6c 6c 6f 20 77 6f 72 6c 64 21 a 0\nKernel #0\nKernelBinaryHeader:\n\t4 CheckSum 242806820\n\t8 ShaderHashCode 2860607076011376830\n\t4 KernelNameSize 12\n\t4 PatchListSize 12\n\t4 KernelHeapSize 0\n\t4 GeneralStateHeapSize 0\n\t4 DynamicStateHeapSize 0\n\t4 SurfaceStateHeapSize 0\n\t4 KernelUnpaddedSize 0\n\tKernelName HelloWorld\nPATCH_TOKEN_MEDIA_INTERFACE_DESCRIPTOR_LOAD:\n\t4 Token 19\n\t4 Size 12\n\t4 InterfaceDescriptorDataOffset 0\n";
     EXPECT_EQ(expectedOutput, ptmFile.str());
 }
+
+TEST(DecoderTests, GivenBytesWhenDumpingHexThenBytesAreWrittenWithoutPaddingInSingleLine) {
+    const uint8_t bytes[] = {0x0, 0xa, 0x10, 0xff};
+    MockDecoder decoder;
+    std::stringstream out;
+    decoder.dumpHex(bytes, sizeof(bytes), out);
+    EXPECT_EQ("\tHex 0 a 10 ff\n", out.str());
+}
+
+TEST(DecoderTests, GivenTokenOutsideOfPatchTokenRangeWhenReadingPatchTokensThenTokenIsUnidentified) {
+    uint32_t binary[] = {256 + 4, 12, 0xffffffff};
+    MockDecoder decoder;
+    auto PTptr = std::make_unique<PatchToken>();
+    PTptr->size = 12;
+    PTptr->name = "Example patchtoken";
+    PTptr->fields.push_back(PTField{4, "First"});
+    decoder.patchTokens.insert(std::pair<uint8_t, std::unique_ptr<PatchToken>>(4, std::move(PTptr)));
+
+    std::stringstream out;
+    void *ptr = binary;
+    decoder.readPatchTokens(ptr, sizeof(binary), out);
+    EXPECT_EQ("Unidentified PatchToken:\n\t4 Token 260\n\t4 Size 12\n\tHex ff ff ff ff\n", out.str());
+}
 } // namespace OCLRT
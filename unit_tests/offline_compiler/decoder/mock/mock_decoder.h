@@ -14,6 +14,7 @@ struct MockDecoder : public BinaryDecoder {
         : BinaryDecoder(file, patch, dump){};
     using BinaryDecoder::binaryFile;
     using BinaryDecoder::decode;
+    using BinaryDecoder::dumpHex;
     using BinaryDecoder::getSize;
     using BinaryDecoder::kernelHeader;
     using BinaryDecoder::parseTokens;
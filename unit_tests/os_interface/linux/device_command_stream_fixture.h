@@ -139,6 +139,7 @@ class DrmMockCustom : public Drm {
     __s32 inputFd = 0;
     //DRM_IOCTL_I915_GEM_USERPTR
     __u32 returnHandle = 0;
+    __u32 userptrFlags = 0;
     //DRM_IOCTL_I915_GEM_MMAP
     __u32 mmapHandle = 0;
     __u32 mmapPad = 0;
@@ -170,6 +171,7 @@ class DrmMockCustom : public Drm {
         case DRM_IOCTL_I915_GEM_USERPTR: {
             auto *userPtrParams = (drm_i915_gem_userptr *)arg;
             userPtrParams->handle = returnHandle;
+            userptrFlags = userPtrParams->flags;
             returnHandle++;
             ioctl_cnt.gemUserptr++;
         } break;
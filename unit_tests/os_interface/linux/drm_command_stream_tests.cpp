@@ -17,6 +17,7 @@
 #include "runtime/os_interface/linux/drm_buffer_object.h"
 #include "runtime/os_interface/linux/drm_command_stream.h"
 #include "runtime/os_interface/linux/drm_memory_manager.h"
+#include "runtime/os_interface/linux/drm_null_device.h"
 #include "runtime/os_interface/linux/os_interface.h"
 #include "unit_tests/fixtures/device_fixture.h"
 #include "unit_tests/helpers/debug_manager_state_restore.h"
@@ -772,6 +773,7 @@ class DrmCommandStreamEnhancedFixture
         std::vector<drm_i915_gem_exec_object2> &getExecStorage() {
             return this->execObjectsStorage;
         }
+        using DrmCommandStreamReceiver<GfxFamily>::residencySet;
     };
     TestedDrmCommandStreamReceiver<DEFAULT_TEST_FAMILY_NAME> *tCsr = nullptr;
 
@@ -783,10 +785,18 @@ class DrmCommandStreamEnhancedFixture
             this->isSoftpin = true;
             this->size = alignUp(size, 4096);
         }
+
+      public:
+        void fillExecObject(drm_i915_gem_exec_object2 &execObject) override {
+            fillExecObjectCalled++;
+            BufferObject::fillExecObject(execObject);
+        }
+
+        uint32_t fillExecObjectCalled = 0u;
     };
 
-    MockBufferObject *createBO(size_t size) {
-        return new MockBufferObject(this->mock, size);
+    MockBufferObject *createBO(size_t size, Drm *drm = nullptr) {
+        return new MockBufferObject(drm ? drm : this->mock, size);
     }
 };
 typedef Test<DrmCommandStreamEnhancedFixture> DrmCommandStreamGemWorkerTests;
@@ -1717,6 +1727,143 @@ TEST_F(DrmCommandStreamLeaksTest, BufferResidency) {
     EXPECT_EQ(ObjectNotResident, buffer->getGraphicsAllocation()->residencyTaskCount[0u]);
 }
 
+TEST_F(DrmCommandStreamLeaksTest, givenBoSubmittedInConsecutiveFlushesWhenFlushingThenItsExecObjectIsFilledOnlyOnce) {
+    std::unique_ptr<MockBufferObject> buffer1(this->createBO(4096));
+    std::unique_ptr<MockBufferObject> buffer2(this->createBO(4096));
+    DrmAllocation allocation1(buffer1.get(), nullptr, buffer1->peekSize(), MemoryPool::MemoryNull);
+    DrmAllocation allocation2(buffer2.get(), nullptr, buffer2->peekSize(), MemoryPool::MemoryNull);
+    ResidencyContainer allocationsForResidency = {&allocation1, &allocation2};
+
+    auto &cs = csr->getCS();
+    csr->addBatchBufferEnd(cs, nullptr);
+    csr->alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, cs.getUsed(), &cs};
+    csr->flush(batchBuffer, EngineType::ENGINE_RCS, allocationsForResidency, *osContext);
+    csr->flush(batchBuffer, EngineType::ENGINE_RCS, allocationsForResidency, *osContext);
+
+    EXPECT_EQ(1u, buffer1->fillExecObjectCalled);
+    EXPECT_EQ(1u, buffer2->fillExecObjectCalled);
+    EXPECT_EQ(3u, this->mock->execBuffer.buffer_count);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(tCsr->getExecStorage().data()), this->mock->execBuffer.buffers_ptr);
+    EXPECT_EQ(2u, tCsr->residencySet.size());
+    EXPECT_EQ(0u, tCsr->getResidencyVector()->size());
+    EXPECT_FALSE(buffer1->peekIsResident());
+    EXPECT_FALSE(buffer2->peekIsResident());
+}
+
+TEST_F(DrmCommandStreamLeaksTest, givenBoNotUsedInNextFlushWhenFlushingThenItIsRemovedFromResidencySetAndOrderOfRemainingBosIsKept) {
+    std::unique_ptr<MockBufferObject> buffer1(this->createBO(4096));
+    std::unique_ptr<MockBufferObject> buffer2(this->createBO(4096));
+    std::unique_ptr<MockBufferObject> buffer3(this->createBO(4096));
+    DrmAllocation allocation1(buffer1.get(), nullptr, buffer1->peekSize(), MemoryPool::MemoryNull);
+    DrmAllocation allocation2(buffer2.get(), nullptr, buffer2->peekSize(), MemoryPool::MemoryNull);
+    DrmAllocation allocation3(buffer3.get(), nullptr, buffer3->peekSize(), MemoryPool::MemoryNull);
+
+    auto &cs = csr->getCS();
+    csr->addBatchBufferEnd(cs, nullptr);
+    csr->alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, cs.getUsed(), &cs};
+
+    ResidencyContainer allocationsForResidency = {&allocation1, &allocation2, &allocation3};
+    csr->flush(batchBuffer, EngineType::ENGINE_RCS, allocationsForResidency, *osContext);
+    EXPECT_EQ(4u, this->mock->execBuffer.buffer_count);
+
+    allocationsForResidency = {&allocation3, &allocation1};
+    csr->flush(batchBuffer, EngineType::ENGINE_RCS, allocationsForResidency, *osContext);
+    EXPECT_EQ(3u, this->mock->execBuffer.buffer_count);
+
+    ASSERT_EQ(2u, tCsr->residencySet.size());
+    EXPECT_EQ(buffer1.get(), tCsr->residencySet[0].bo);
+    EXPECT_EQ(buffer3.get(), tCsr->residencySet[1].bo);
+    EXPECT_EQ(0u, buffer1->peekResidencySetIndex());
+    EXPECT_EQ(1u, buffer3->peekResidencySetIndex());
+    EXPECT_EQ(1u, buffer1->fillExecObjectCalled);
+    EXPECT_EQ(1u, buffer3->fillExecObjectCalled);
+
+    allocationsForResidency = {&allocation2};
+    csr->flush(batchBuffer, EngineType::ENGINE_RCS, allocationsForResidency, *osContext);
+    EXPECT_EQ(2u, this->mock->execBuffer.buffer_count);
+    ASSERT_EQ(1u, tCsr->residencySet.size());
+    EXPECT_EQ(buffer2.get(), tCsr->residencySet[0].bo);
+    EXPECT_EQ(2u, buffer2->fillExecObjectCalled);
+}
+
+TEST_F(DrmCommandStreamLeaksTest, givenResidencyClearedWithoutFlushWhenFlushingThenPreviouslyResidentBosAreNotSubmitted) {
+    auto allocation1 = static_cast<DrmAllocation *>(mm->allocateGraphicsMemory(1024));
+    auto allocation2 = static_cast<DrmAllocation *>(mm->allocateGraphicsMemory(1024));
+    ASSERT_NE(nullptr, allocation1);
+    ASSERT_NE(nullptr, allocation2);
+
+    csr->makeResident(*allocation1);
+    csr->makeResident(*allocation2);
+    csr->processResidency(csr->getResidencyAllocations(), *osContext);
+    EXPECT_EQ(2u, tCsr->residencySet.size());
+
+    csr->makeNonResident(*allocation1);
+    mm->freeGraphicsMemory(allocation1);
+
+    auto &cs = csr->getCS();
+    csr->addBatchBufferEnd(cs, nullptr);
+    csr->alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, cs.getUsed(), &cs};
+    ResidencyContainer allocationsForResidency;
+    csr->flush(batchBuffer, EngineType::ENGINE_RCS, allocationsForResidency, *osContext);
+
+    EXPECT_EQ(1u, this->mock->execBuffer.buffer_count);
+    EXPECT_EQ(0u, tCsr->residencySet.size());
+
+    csr->makeNonResident(*allocation2);
+    mm->freeGraphicsMemory(allocation2);
+}
+
+class DrmNullDeviceForResidencyTests : public DrmNullDevice {
+  public:
+    DrmNullDeviceForResidencyTests() : DrmNullDevice(-1) {}
+};
+
+TEST_F(DrmCommandStreamLeaksTest, givenThousandResidentBosWhenFlushingRepeatedlyThenExecObjectsAreFilledOnceAndDroppedBosAreCompactedInOrder) {
+    const size_t bosCount = 1000;
+    const size_t flushesCount = 100;
+    DrmNullDeviceForResidencyTests nullDevice;
+
+    std::vector<std::unique_ptr<MockBufferObject>> buffers;
+    std::vector<std::unique_ptr<DrmAllocation>> allocations;
+    ResidencyContainer allocationsForResidency;
+    for (size_t i = 0; i < bosCount; i++) {
+        buffers.emplace_back(this->createBO(4096, &nullDevice));
+        allocations.emplace_back(new DrmAllocation(buffers.back().get(), nullptr, buffers.back()->peekSize(), MemoryPool::MemoryNull));
+        allocationsForResidency.push_back(allocations.back().get());
+    }
+
+    std::unique_ptr<MockBufferObject> commandBufferBo(this->createBO(4096, &nullDevice));
+    DrmAllocation commandBuffer(commandBufferBo.get(), nullptr, commandBufferBo->peekSize(), MemoryPool::MemoryNull);
+    BatchBuffer batchBuffer{&commandBuffer, 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, MemoryConstants::cacheLineSize, nullptr};
+
+    for (size_t i = 0; i < flushesCount; i++) {
+        csr->flush(batchBuffer, EngineType::ENGINE_RCS, allocationsForResidency, *osContext);
+    }
+
+    ASSERT_EQ(bosCount, tCsr->residencySet.size());
+    for (size_t i = 0; i < bosCount; i++) {
+        EXPECT_EQ(buffers[i].get(), tCsr->residencySet[i].bo);
+        EXPECT_EQ(1u, buffers[i]->fillExecObjectCalled);
+    }
+
+    ResidencyContainer oddAllocationsForResidency;
+    for (size_t i = 1; i < bosCount; i += 2) {
+        oddAllocationsForResidency.push_back(allocations[i].get());
+    }
+    csr->flush(batchBuffer, EngineType::ENGINE_RCS, oddAllocationsForResidency, *osContext);
+
+    ASSERT_EQ(bosCount / 2, tCsr->residencySet.size());
+    for (size_t i = 0; i < bosCount / 2; i++) {
+        EXPECT_EQ(buffers[2 * i + 1].get(), tCsr->residencySet[i].bo);
+    }
+    for (auto &buffer : buffers) {
+        EXPECT_EQ(1u, buffer->fillExecObjectCalled);
+    }
+}
+
 typedef Test<DrmCommandStreamEnhancedFixture> DrmCommandStreamMemoryManagerTest;
 
 TEST_F(DrmCommandStreamMemoryManagerTest, givenDrmCommandStreamReceiverWhenMemoryManagerIsCreatedThenItHasHostMemoryValidationEnabledByDefault) {
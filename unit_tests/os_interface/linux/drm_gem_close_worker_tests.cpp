@@ -22,6 +22,7 @@
 #include "runtime/os_interface/linux/drm_command_stream.h"
 #include "runtime/os_interface/linux/drm_gem_close_worker.h"
 #include "runtime/os_interface/linux/drm_memory_manager.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
 #include "test.h"
 #include "unit_tests/os_interface/linux/device_command_stream_fixture.h"
 
@@ -32,6 +33,7 @@ class DrmMockForWorker : public Drm {
     std::mutex mutex;
     std::atomic<int> gem_close_cnt;
     std::atomic<int> gem_close_expected;
+    std::atomic<int> gem_wait_cnt{0};
     std::atomic<std::thread::id> ioctl_caller_thread_id;
     DrmMockForWorker() : Drm(33) {
     }
@@ -43,6 +45,8 @@ class DrmMockForWorker : public Drm {
         }
         if (request == DRM_IOCTL_GEM_CLOSE)
             gem_close_cnt++;
+        if (request == DRM_IOCTL_I915_GEM_WAIT)
+            gem_wait_cnt++;
 
         ioctl_caller_thread_id = std::this_thread::get_id();
 
@@ -159,27 +163,136 @@ TEST_F(DrmGemCloseWorkerTests, givenAllocationWhenAskedForUnreferenceWithForceFl
     delete worker;
 }
 
-TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledWithBlockingFlagThenThreadIsClosed) {
+TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledWithBlockingFlagThenQueueIsProcessed) {
     struct mockDrmGemCloseWorker : DrmGemCloseWorker {
         using DrmGemCloseWorker::DrmGemCloseWorker;
-        using DrmGemCloseWorker::thread;
+        using DrmGemCloseWorker::processingScheduled;
+        using DrmGemCloseWorker::workerPool;
     };
+    this->drmMock->gem_close_expected = 1;
 
     std::unique_ptr<mockDrmGemCloseWorker> worker(new mockDrmGemCloseWorker(*mm));
-    EXPECT_NE(nullptr, worker->thread);
+    EXPECT_NE(nullptr, worker->workerPool.get());
+    worker->push(new BufferObjectWrapper(this->drmMock, 1));
     worker->close(true);
-    EXPECT_EQ(nullptr, worker->thread);
+    EXPECT_FALSE(worker->processingScheduled);
+    EXPECT_TRUE(worker->isEmpty());
 }
 
-TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTimeWithBlockingFlagThenThreadIsClosed) {
+TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTimeWithBlockingFlagThenQueueIsProcessed) {
     struct mockDrmGemCloseWorker : DrmGemCloseWorker {
         using DrmGemCloseWorker::DrmGemCloseWorker;
-        using DrmGemCloseWorker::thread;
+        using DrmGemCloseWorker::processingScheduled;
     };
 
     std::unique_ptr<mockDrmGemCloseWorker> worker(new mockDrmGemCloseWorker(*mm));
     worker->close(true);
     worker->close(true);
     worker->close(true);
-    EXPECT_EQ(nullptr, worker->thread);
+    EXPECT_FALSE(worker->processingScheduled);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenClosedDrmGemCloseWorkerWhenBufferObjectIsPushedThenItIsClosedFromCallingThread) {
+    this->drmMock->gem_close_expected = 1;
+
+    DrmGemCloseWorker worker(*mm);
+    worker.close(true);
+    worker.push(new BufferObjectWrapper(this->drmMock, 1));
+
+    EXPECT_TRUE(worker.isEmpty());
+    EXPECT_EQ(drmMock->ioctl_caller_thread_id, std::this_thread::get_id());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenBufferObjectsUsedBySameSubmissionWhenBatchIsClosedThenSingleWaitIsIssuedForThem) {
+    struct mockDrmGemCloseWorker : DrmGemCloseWorker {
+        using DrmGemCloseWorker::closeBatch;
+        using DrmGemCloseWorker::DrmGemCloseWorker;
+        using DrmGemCloseWorker::WorkItem;
+        using DrmGemCloseWorker::workCount;
+    };
+    this->drmMock->gem_close_expected = 5;
+
+    mockDrmGemCloseWorker worker(*mm);
+    int csr = 0;
+    std::queue<mockDrmGemCloseWorker::WorkItem> batch;
+    for (auto taskCount : {3u, 3u, 3u, 4u, ObjectNotUsed}) {
+        auto bo = new BufferObjectWrapper(this->drmMock, 1);
+        bo->setResidencySetPosition(&csr, 0);
+        batch.push({bo, taskCount});
+    }
+    worker.workCount = 5;
+
+    EXPECT_EQ(3u, worker.closeBatch(batch));
+    EXPECT_EQ(3, this->drmMock->gem_wait_cnt.load());
+    EXPECT_TRUE(batch.empty());
+    EXPECT_TRUE(worker.isEmpty());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenBufferObjectsWithSameTaskCountOfDifferentCommandStreamReceiversWhenBatchIsClosedThenEachIsWaitedFor) {
+    struct mockDrmGemCloseWorker : DrmGemCloseWorker {
+        using DrmGemCloseWorker::closeBatch;
+        using DrmGemCloseWorker::DrmGemCloseWorker;
+        using DrmGemCloseWorker::WorkItem;
+        using DrmGemCloseWorker::workCount;
+    };
+    this->drmMock->gem_close_expected = 2;
+
+    mockDrmGemCloseWorker worker(*mm);
+    int csrs[2] = {};
+    std::queue<mockDrmGemCloseWorker::WorkItem> batch;
+    for (auto &csr : csrs) {
+        auto bo = new BufferObjectWrapper(this->drmMock, 1);
+        bo->setResidencySetPosition(&csr, 0);
+        batch.push({bo, 3u});
+    }
+    worker.workCount = 2;
+
+    EXPECT_EQ(2u, worker.closeBatch(batch));
+    EXPECT_EQ(2, this->drmMock->gem_wait_cnt.load());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenProcessedBufferObjectsWhenStatisticsAreQueriedThenQueueDepthAndReleasedCountsAreReturned) {
+    this->drmMock->gem_close_expected = 3;
+
+    DrmGemCloseWorker worker(*mm);
+    for (auto i = 0; i < 3; i++) {
+        worker.push(new BufferObjectWrapper(this->drmMock, 1), 1u);
+    }
+    worker.close(true);
+
+    auto statistics = worker.getStatistics();
+    EXPECT_EQ(0u, statistics.queueDepth);
+    EXPECT_LE(1u, statistics.peakQueueDepth);
+    EXPECT_GE(3u, statistics.peakQueueDepth);
+    EXPECT_LE(1u, statistics.batchesProcessed);
+    EXPECT_EQ(3u, statistics.releasedBufferObjects);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenQueueDeeperThanLimitWhenThrottlingThenCallingThreadWaitsUntilQueueDrainsBelowLimit) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.GemCloseWorkerMaxQueueDepth.set(1);
+    this->drmMock->gem_close_expected = 4;
+
+    DrmGemCloseWorker worker(*mm);
+    for (auto i = 0; i < 4; i++) {
+        worker.push(new BufferObjectWrapper(this->drmMock, 1));
+    }
+    worker.throttle();
+    EXPECT_GE(1u, worker.getStatistics().queueDepth);
+
+    worker.close(true);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenMemoryManagerWithActiveWorkerWhenAllocationIsFreedThenBufferObjectIsReleasedByWorker) {
+    this->drmMock->gem_close_expected = 1;
+
+    DrmMemoryManager memoryManager(this->drmMock, gemCloseWorkerMode::gemCloseWorkerActive, false, false, executionEnvironment);
+    auto allocation = memoryManager.allocateGraphicsMemory(1024);
+    ASSERT_NE(nullptr, allocation);
+    memoryManager.freeGraphicsMemory(allocation);
+
+    auto worker = memoryManager.peekGemCloseWorker();
+    worker->close(true);
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(1u, worker->getStatistics().releasedBufferObjects);
 }
@@ -235,6 +235,128 @@ TEST_F(DrmMemoryManagerTest, doNotPinAfterAllocateWhenAskedButNotAllowed) {
     memoryManager->freeGraphicsMemory(alloc);
 }
 
+TEST_F(DrmMemoryManagerTest, givenTransparentHugePagesWhenAllocatingAtLeast2MbThenMappingIsAlignedTo2MbAndAdvisedToUseHugePages) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableHugePages.set(1);
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    auto size = 3 * MemoryConstants::megaByte;
+    auto alloc = memoryManager->allocateGraphicsMemory(size, MemoryConstants::pageSize, false, false);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_EQ(size, alloc->getUnderlyingBufferSize());
+    EXPECT_TRUE(isAligned<MemoryConstants::pageSize2Mb>(alloc->getUnderlyingBuffer()));
+    EXPECT_EQ(4 * MemoryConstants::megaByte, alloc->getBO()->peekSize());
+    EXPECT_EQ(4 * MemoryConstants::megaByte, alloc->getBO()->peekUnmapSize());
+    EXPECT_EQ(MMAP_ALLOCATOR, alloc->getBO()->peekAllocationType());
+
+    EXPECT_EQ(1, mmapMockCallCount);
+    EXPECT_EQ(0, mmapMockFlags & MAP_HUGETLB);
+    EXPECT_EQ(2, munmapMockCallCount);
+    EXPECT_EQ(1, madviseMockCallCount);
+    EXPECT_EQ(MADV_HUGEPAGE, madviseMockAdvice);
+
+    memoryManager->freeGraphicsMemory(alloc);
+    EXPECT_EQ(3, munmapMockCallCount);
+}
+
+TEST_F(DrmMemoryManagerTest, givenExplicitHugePagesWhenAllocatingAtLeast2MbThenHugeTlbMappingIsUsed) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableHugePages.set(2);
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    auto alloc = memoryManager->allocateGraphicsMemory(MemoryConstants::pageSize2Mb, MemoryConstants::pageSize, false, false);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_EQ(1, mmapMockCallCount);
+    EXPECT_EQ(MAP_HUGETLB, mmapMockFlags & MAP_HUGETLB);
+    EXPECT_EQ(0, munmapMockCallCount);
+    EXPECT_EQ(0, madviseMockCallCount);
+
+    memoryManager->freeGraphicsMemory(alloc);
+    EXPECT_EQ(1, munmapMockCallCount);
+}
+
+TEST_F(DrmMemoryManagerTest, givenHugePagesDisabledOrSmallAllocationWhenAllocatingThenMemoryIsNotMapped) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableHugePages.set(0);
+    mock->ioctl_expected.gemUserptr = 2;
+    mock->ioctl_expected.gemWait = 2;
+    mock->ioctl_expected.gemClose = 2;
+
+    auto alloc = memoryManager->allocateGraphicsMemory(MemoryConstants::pageSize2Mb, MemoryConstants::pageSize, false, false);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_EQ(0u, alloc->getBO()->peekUnmapSize());
+    memoryManager->freeGraphicsMemory(alloc);
+
+    DebugManager.flags.EnableHugePages.set(1);
+    alloc = memoryManager->allocateGraphicsMemory(MemoryConstants::pageSize2Mb - MemoryConstants::pageSize, MemoryConstants::pageSize, false, false);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_EQ(0u, alloc->getBO()->peekUnmapSize());
+    memoryManager->freeGraphicsMemory(alloc);
+
+    EXPECT_EQ(0, mmapMockCallCount);
+    EXPECT_EQ(0, madviseMockCallCount);
+}
+
+TEST_F(DrmMemoryManagerTest, givenDefaultHugePagesSettingWhenAllocatingThenHugePagesAreUsedOnlyWhenRoundingWastesLittleMemory) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableHugePages.set(-1);
+    mock->ioctl_expected.gemUserptr = 2;
+    mock->ioctl_expected.gemWait = 2;
+    mock->ioctl_expected.gemClose = 2;
+
+    auto alloc = memoryManager->allocateGraphicsMemory(3 * MemoryConstants::megaByte, MemoryConstants::pageSize, false, false);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_EQ(0u, alloc->getBO()->peekUnmapSize());
+    EXPECT_EQ(0, mmapMockCallCount);
+    memoryManager->freeGraphicsMemory(alloc);
+
+    auto size = 7 * MemoryConstants::megaByte + MemoryConstants::megaByte / 2;
+    alloc = memoryManager->allocateGraphicsMemory(size, MemoryConstants::pageSize, false, false);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_EQ(size, alloc->getUnderlyingBufferSize());
+    EXPECT_EQ(8 * MemoryConstants::megaByte, alloc->getBO()->peekUnmapSize());
+    EXPECT_EQ(1, mmapMockCallCount);
+    EXPECT_EQ(0, mmapMockFlags & MAP_HUGETLB);
+    memoryManager->freeGraphicsMemory(alloc);
+}
+
+TEST_F(DrmMemoryManagerTest, givenReadOnlyHostPtrWhenAllocationIsCreatedThenReadOnlyUserptrCoversWholePagesAndPagesAreReadAhead) {
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    auto ptr = reinterpret_cast<const void *>(0x1001);
+    auto alloc = memoryManager->allocateGraphicsMemoryForReadOnlyHostPtr(MemoryConstants::pageSize, ptr);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_EQ(ptr, alloc->getUnderlyingBuffer());
+    EXPECT_EQ(MemoryConstants::pageSize, alloc->getUnderlyingBufferSize());
+    EXPECT_EQ(0x1001u, alloc->getGpuAddress());
+
+    auto bo = alloc->getBO();
+    EXPECT_EQ(reinterpret_cast<void *>(0x1000), bo->peekAddress());
+    EXPECT_EQ(2 * MemoryConstants::pageSize, bo->peekSize());
+    EXPECT_FALSE(bo->peekIsAllocated());
+    EXPECT_EQ(static_cast<__u32>(I915_USERPTR_READ_ONLY), mock->userptrFlags);
+    EXPECT_EQ(1, madviseMockCallCount);
+    EXPECT_EQ(MADV_WILLNEED, madviseMockAdvice);
+
+    memoryManager->freeGraphicsMemory(alloc);
+    EXPECT_EQ(0, munmapMockCallCount);
+}
+
+TEST_F(DrmMemoryManagerTest, givenReadOnlyUserptrNotSupportedWhenAllocationForReadOnlyHostPtrIsCreatedThenNullptrIsReturned) {
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_res = -1;
+
+    auto alloc = memoryManager->allocateGraphicsMemoryForReadOnlyHostPtr(MemoryConstants::pageSize, reinterpret_cast<const void *>(0x1000));
+    EXPECT_EQ(nullptr, alloc);
+    mock->ioctl_res = 0;
+}
+
 // ---- HostPtr
 TEST_F(DrmMemoryManagerTest, pinAfterAllocateWhenAskedAndAllowedAndBigAllocationHostPtr) {
     mock->ioctl_expected.gemUserptr = 2;
@@ -1991,6 +2113,23 @@ TEST(Allocator32BitUsingHeapAllocator, given32BitAllocatorWhenFirstMMapFailsThen
     DebugManager.flags.UseNewHeapAllocator.set(flagToRestore);
 }
 
+TEST(Allocator32BitUsingHeapAllocator, givenHugePagesExplicitlyEnabledWhen32BitAllocatorIsCreatedThenHeapIsAdvisedToUseHugePagesOnlyThen) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.UseNewHeapAllocator.set(true);
+
+    const std::pair<int32_t, uint32_t> expectedMadviseCalls[] = {{-1, 0u}, {0, 0u}, {1, 1u}, {2, 1u}};
+    for (auto &expected : expectedMadviseCalls) {
+        DebugManager.flags.EnableHugePages.set(expected.first);
+        mockAllocator32Bit::resetState();
+        mockAllocator32Bit::OsInternalsPublic *osInternals = mockAllocator32Bit::createOsInternals();
+        osInternals->mmapFunction = MockMmap;
+        osInternals->munmapFunction = MockMunmap;
+        osInternals->madviseFunction = MockMadvise;
+        std::unique_ptr<mockAllocator32Bit> mock32BitAllocator(new mockAllocator32Bit(osInternals));
+        EXPECT_EQ(expected.second, madviseCallCount) << "EnableHugePages = " << expected.first;
+    }
+}
+
 TEST(DrmAllocator32Bit, allocateReturnsPointer) {
     bool flagToRestore = DebugManager.flags.UseNewHeapAllocator.get();
     DebugManager.flags.UseNewHeapAllocator.set(false);
@@ -14,6 +14,7 @@
 #include "runtime/helpers/dispatch_info.h"
 #include "runtime/os_interface/os_interface.h"
 #include "runtime/utilities/tag_allocator.h"
+#include "runtime/utilities/trace_recorder.h"
 
 #include "unit_tests/command_queue/command_enqueue_fixture.h"
 #include "unit_tests/helpers/debug_manager_state_restore.h"
@@ -22,6 +23,7 @@
 #include "unit_tests/mocks/mock_context.h"
 #include "unit_tests/mocks/mock_event.h"
 #include "unit_tests/mocks/mock_kernel.h"
+#include "unit_tests/mocks/mock_ostime.h"
 #include "unit_tests/mocks/mock_program.h"
 #include "unit_tests/os_interface/mock_performance_counters.h"
 #include "test.h"
@@ -500,6 +502,47 @@ TEST(EventProfilingTest, givenRawTimestampsDebugModeWhenDataIsQueriedThenRawData
     EXPECT_EQ(event.queueTimeStamp.GPUTimeStamp, queued);
 }
 
+TEST(EventProfilingTest, givenTracingEnabledWhenCompletedProfiledEventIsDestroyedThenGpuSpanIsRecorded) {
+    std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    device->setOSTime(new MockOSTime());
+    MockContext context;
+    cl_command_queue_properties props[5] = {0, 0, 0, 0, 0};
+    MockCommandQueue cmdQ(&context, device.get(), props);
+    cmdQ.setProfilingEnabled();
+    cmdQ.device = device.get();
+
+    HwTimeStamps timestamp;
+    timestamp.GlobalStartTS = 10;
+    timestamp.ContextStartTS = 20;
+    timestamp.GlobalEndTS = 80;
+    timestamp.ContextEndTS = 56;
+    timestamp.GlobalCompleteTS = 0;
+    timestamp.ContextCompleteTS = 0;
+
+    MockTagNode<HwTimeStamps> timestampNode;
+    timestampNode.tag = &timestamp;
+
+    TraceRecorder::setEnabled(true);
+    {
+        MockEvent<Event> event(&cmdQ, CL_COMMAND_NDRANGE_KERNEL, 0, 0);
+        event.setCPUProfilingPath(false);
+        event.timeStampNode = &timestampNode;
+    }
+    TraceRecorder::setEnabled(false);
+
+    std::vector<TraceEvent> events;
+    TraceRecorder::collect(events);
+    TraceRecorder::clear();
+
+    ASSERT_EQ(1u, events.size());
+    EXPECT_TRUE(events[0].gpu);
+    EXPECT_EQ(static_cast<uint32_t>(CL_COMMAND_NDRANGE_KERNEL), events[0].commandType);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&cmdQ), events[0].trackId);
+    double frequency = device->getDeviceInfo().profilingTimerResolution;
+    EXPECT_EQ(static_cast<uint64_t>((timestamp.ContextEndTS - timestamp.ContextStartTS) * frequency), events[0].durationNs);
+    cmdQ.device = nullptr;
+}
+
 struct ProfilingWithPerfCountersTests : public ProfilingTests,
                                         public PerformanceCountersFixture {
     void SetUp() override {
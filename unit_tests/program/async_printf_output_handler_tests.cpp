@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/program/async_printf_output_handler.h"
+#include "runtime/program/printf_handler.h"
+#include "unit_tests/mocks/mock_device.h"
+#include "unit_tests/mocks/mock_kernel.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+
+using namespace OCLRT;
+
+class MockPrintfHandlerWithPrintCounter : public PrintfHandler {
+  public:
+    MockPrintfHandlerWithPrintCounter(Device &device, Kernel *kernel, std::atomic<uint32_t> &printCount) : PrintfHandler(device), printCount(printCount) {
+        this->kernel = kernel;
+    }
+
+    void printEnqueueOutput() override {
+        printCount++;
+    }
+
+    std::atomic<uint32_t> &printCount;
+};
+
+class MockAsyncPrintfOutputHandler : public AsyncPrintfOutputHandler {
+  public:
+    using AsyncPrintfOutputHandler::AsyncPrintfOutputHandler;
+    using AsyncPrintfOutputHandler::pendingOutputs;
+    using AsyncPrintfOutputHandler::processingScheduled;
+    using AsyncPrintfOutputHandler::workerPool;
+};
+
+class AsyncPrintfOutputHandlerTest : public ::testing::Test {
+  public:
+    void SetUp() override {
+        device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+        kernelInternals = std::make_unique<MockKernelWithInternals>(*device);
+    }
+
+    std::unique_ptr<PrintfHandler> createPrintfHandler() {
+        return std::unique_ptr<PrintfHandler>(new MockPrintfHandlerWithPrintCounter(*device, kernelInternals->mockKernel, printCount));
+    }
+
+    std::unique_ptr<MockDevice> device;
+    std::unique_ptr<MockKernelWithInternals> kernelInternals;
+    std::atomic<uint32_t> printCount{0};
+};
+
+TEST_F(AsyncPrintfOutputHandlerTest, givenNewHandlerWhenCreatedThenWorkerPoolIsNotAcquired) {
+    MockAsyncPrintfOutputHandler handler(*device);
+    EXPECT_EQ(nullptr, handler.workerPool.get());
+}
+
+TEST_F(AsyncPrintfOutputHandlerTest, givenRegisteredOutputWhenWaitingForItsTaskCountThenOutputIsPrintedAndReleased) {
+    MockAsyncPrintfOutputHandler handler(*device);
+    auto initialRefCount = kernelInternals->mockKernel->getRefInternalCount();
+
+    auto taskCount = *device->getCommandStreamReceiver().getTagAddress();
+    handler.registerOutput(createPrintfHandler(), taskCount, 0);
+    EXPECT_NE(nullptr, handler.workerPool.get());
+
+    handler.waitForOutputs(taskCount);
+
+    EXPECT_EQ(1u, printCount);
+    EXPECT_TRUE(handler.pendingOutputs.empty());
+    EXPECT_EQ(initialRefCount, kernelInternals->mockKernel->getRefInternalCount());
+}
+
+TEST_F(AsyncPrintfOutputHandlerTest, givenMultipleRegisteredOutputsWhenWaitingForAllOutputsThenAllOutputsArePrinted) {
+    MockAsyncPrintfOutputHandler handler(*device);
+
+    auto taskCount = *device->getCommandStreamReceiver().getTagAddress();
+    for (uint32_t i = 0; i < 3; i++) {
+        handler.registerOutput(createPrintfHandler(), taskCount, 0);
+    }
+
+    handler.waitForAllOutputs();
+
+    EXPECT_EQ(3u, printCount);
+    EXPECT_TRUE(handler.pendingOutputs.empty());
+    EXPECT_FALSE(handler.processingScheduled);
+}
+
+TEST_F(AsyncPrintfOutputHandlerTest, givenNoRegisteredOutputsWhenWaitingForOutputsThenReturnImmediately) {
+    MockAsyncPrintfOutputHandler handler(*device);
+    handler.waitForOutputs(10);
+    EXPECT_EQ(0u, printCount);
+}
@@ -32,6 +32,7 @@ class MockTagAllocator : public TagAllocator<timeStamps> {
   public:
     using TagAllocator<timeStamps>::populateFreeTags;
     using TagAllocator<timeStamps>::deferredTags;
+    using TagAllocator<timeStamps>::getCurrentThreadCache;
     using TagAllocator<timeStamps>::releaseDeferredTags;
 
     MockTagAllocator(MemoryManager *memMngr, size_t tagCount, size_t tagAlignment) : TagAllocator<timeStamps>(memMngr, tagCount, tagAlignment) {
@@ -45,16 +46,12 @@ class MockTagAllocator : public TagAllocator<timeStamps> {
         return TagAllocator<timeStamps>::freeTags.peekHead();
     }
 
-    TagNode<timeStamps> *getUsedTagsHead() {
-        return TagAllocator<timeStamps>::usedTags.peekHead();
-    }
-
     IDList<TagNode<timeStamps>> &getFreeTags() {
         return TagAllocator<timeStamps>::freeTags;
     }
 
-    IDList<TagNode<timeStamps>> &getUsedTags() {
-        return TagAllocator<timeStamps>::usedTags;
+    bool isTagFree(TagNode<timeStamps> &node) {
+        return freeTags.peekContains(node) || getCurrentThreadCache().tags.peekContains(node);
     }
 
     size_t getGraphicsAllocationsCount() {
@@ -73,41 +70,33 @@ TEST_F(TagAllocatorTest, Initialize) {
     ASSERT_NE(nullptr, tagAllocator.getGraphicsAllocation());
 
     ASSERT_NE(nullptr, tagAllocator.getFreeTagsHead());
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
 
     void *gfxMemory = tagAllocator.getGraphicsAllocation()->getUnderlyingBuffer();
     void *head = reinterpret_cast<void *>(tagAllocator.getFreeTagsHead()->tag);
     EXPECT_EQ(gfxMemory, head);
 }
 
-TEST_F(TagAllocatorTest, GetReturnTagCheckFreeAndUsedLists) {
+TEST_F(TagAllocatorTest, GetReturnTagCheckFreeListAndThreadCache) {
 
     MockTagAllocator tagAllocator(memoryManager, 10, 16);
 
     ASSERT_NE(nullptr, tagAllocator.getGraphicsAllocation());
     ASSERT_NE(nullptr, tagAllocator.getFreeTagsHead());
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
 
     TagNode<timeStamps> *tagNode = tagAllocator.getTag();
 
     EXPECT_NE(nullptr, tagNode);
 
     IDList<TagNode<timeStamps>> &freeList = tagAllocator.getFreeTags();
-    IDList<TagNode<timeStamps>> &usedList = tagAllocator.getUsedTags();
+    auto &threadCacheList = tagAllocator.getCurrentThreadCache().tags;
 
-    bool isFoundOnUsedList = usedList.peekContains(*tagNode);
-    bool isFoundOnFreeList = freeList.peekContains(*tagNode);
-
-    EXPECT_FALSE(isFoundOnFreeList);
-    EXPECT_TRUE(isFoundOnUsedList);
+    EXPECT_FALSE(freeList.peekContains(*tagNode));
+    EXPECT_FALSE(threadCacheList.peekContains(*tagNode));
 
     tagAllocator.returnTag(tagNode);
 
-    isFoundOnUsedList = usedList.peekContains(*tagNode);
-    isFoundOnFreeList = freeList.peekContains(*tagNode);
-
-    EXPECT_TRUE(isFoundOnFreeList);
-    EXPECT_FALSE(isFoundOnUsedList);
+    EXPECT_FALSE(freeList.peekContains(*tagNode));
+    EXPECT_TRUE(threadCacheList.peekContains(*tagNode));
 }
 
 TEST_F(TagAllocatorTest, TagAlignment) {
@@ -171,24 +160,23 @@ TEST_F(TagAllocatorTest, GetTagsAndReturnInDifferentOrder) {
     EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
     EXPECT_EQ(2u, tagAllocator.getTagPoolCount());
 
-    IDList<TagNode<timeStamps>> &freeList = tagAllocator.getFreeTags();
-    bool isFoundOnFreeList = freeList.peekContains(*tagNodes[0]);
+    bool isFoundOnFreeList = tagAllocator.isTagFree(*tagNodes[0]);
     EXPECT_FALSE(isFoundOnFreeList);
 
     tagAllocator.returnTag(tagNodes[2]);
-    isFoundOnFreeList = freeList.peekContains(*tagNodes[2]);
+    isFoundOnFreeList = tagAllocator.isTagFree(*tagNodes[2]);
     EXPECT_TRUE(isFoundOnFreeList);
     EXPECT_NE(nullptr, tagAllocator.getFreeTagsHead());
 
     tagAllocator.returnTag(tagNodes[3]);
-    isFoundOnFreeList = freeList.peekContains(*tagNodes[3]);
+    isFoundOnFreeList = tagAllocator.isTagFree(*tagNodes[3]);
     EXPECT_TRUE(isFoundOnFreeList);
 
     tagAllocator.returnTag(tagNodes[1]);
-    isFoundOnFreeList = freeList.peekContains(*tagNodes[1]);
+    isFoundOnFreeList = tagAllocator.isTagFree(*tagNodes[1]);
     EXPECT_TRUE(isFoundOnFreeList);
 
-    isFoundOnFreeList = freeList.peekContains(*tagNodes[0]);
+    isFoundOnFreeList = tagAllocator.isTagFree(*tagNodes[0]);
     EXPECT_FALSE(isFoundOnFreeList);
 
     tagAllocator.returnTag(tagNodes[0]);
@@ -262,18 +250,18 @@ TEST_F(TagAllocatorTest, givenMultipleReferencesOnTagWhenReleasingThenReturnWhen
     MockTagAllocator tagAllocator(memoryManager, 2, 1);
 
     auto tag = tagAllocator.getTag();
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_FALSE(tagAllocator.isTagFree(*tag));
     tagAllocator.returnTag(tag);
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead()); // only 1 reference
+    EXPECT_TRUE(tagAllocator.isTagFree(*tag)); // only 1 reference
 
     tag = tagAllocator.getTag();
     tag->incRefCount();
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_FALSE(tagAllocator.isTagFree(*tag));
 
     tagAllocator.returnTag(tag);
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead()); // 1 reference left
+    EXPECT_FALSE(tagAllocator.isTagFree(*tag)); // 1 reference left
     tagAllocator.returnTag(tag);
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_TRUE(tagAllocator.isTagFree(*tag));
 }
 
 TEST_F(TagAllocatorTest, givenNotReadyTagWhenReturnedThenMoveToDeferredList) {
@@ -285,9 +273,10 @@ TEST_F(TagAllocatorTest, givenNotReadyTagWhenReturnedThenMoveToDeferredList) {
     tagAllocator.returnTag(node);
     EXPECT_FALSE(tagAllocator.deferredTags.peekIsEmpty());
     EXPECT_TRUE(tagAllocator.getFreeTags().peekIsEmpty());
+    EXPECT_TRUE(tagAllocator.getCurrentThreadCache().tags.peekIsEmpty());
 }
 
-TEST_F(TagAllocatorTest, givenReadyTagWhenReturnedThenMoveToFreeList) {
+TEST_F(TagAllocatorTest, givenReadyTagWhenReturnedThenMoveToCurrentThreadCache) {
     MockTagAllocator tagAllocator(memoryManager, 1, 1);
     auto node = tagAllocator.getTag();
 
@@ -295,7 +284,7 @@ TEST_F(TagAllocatorTest, givenReadyTagWhenReturnedThenMoveToFreeList) {
     EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
     tagAllocator.returnTag(node);
     EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
-    EXPECT_FALSE(tagAllocator.getFreeTags().peekIsEmpty());
+    EXPECT_TRUE(tagAllocator.getCurrentThreadCache().tags.peekContains(*node));
 }
 
 TEST_F(TagAllocatorTest, givenEmptyFreeListWhenAskingForNewTagThenTryToReleaseDeferredListFirst) {
@@ -335,3 +324,65 @@ TEST_F(TagAllocatorTest, givenTagsOnDeferredListWhenReleasingItThenMoveReadyTags
     EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
     EXPECT_FALSE(tagAllocator.getFreeTags().peekIsEmpty());
 }
+
+TEST_F(TagAllocatorTest, givenEmptyThreadCacheWhenTagIsTakenThenBatchOfFreeTagsIsMovedToCurrentThreadCache) {
+    MockTagAllocator tagAllocator(memoryManager, 2 * TagAllocatorThreadCaches::batchSize, 1);
+    size_t freeTagsCount = tagAllocator.getFreeTagsHead()->countSuccessors() + 1;
+
+    auto &threadCache = tagAllocator.getCurrentThreadCache();
+    EXPECT_TRUE(threadCache.tags.peekIsEmpty());
+
+    auto node = tagAllocator.getTag();
+    EXPECT_EQ(freeTagsCount - TagAllocatorThreadCaches::batchSize - 1, tagAllocator.getFreeTagsHead()->countSuccessors() + 1);
+    EXPECT_EQ(TagAllocatorThreadCaches::batchSize - 1, threadCache.tags.peekHead()->countSuccessors());
+    EXPECT_FALSE(threadCache.tags.peekContains(*node));
+
+    auto node2 = tagAllocator.getTag();
+    EXPECT_EQ(freeTagsCount - TagAllocatorThreadCaches::batchSize - 1, tagAllocator.getFreeTagsHead()->countSuccessors() + 1);
+
+    tagAllocator.returnTag(node);
+    tagAllocator.returnTag(node2);
+}
+
+TEST_F(TagAllocatorTest, givenThreadCacheExceedingLimitWhenTagIsReturnedThenTagsAboveBatchSizeAreMovedToFreeList) {
+    const size_t batchSize = TagAllocatorThreadCaches::batchSize;
+    const size_t tagsTaken = TagAllocatorThreadCaches::maxCachedTags + 1;
+    MockTagAllocator tagAllocator(memoryManager, 2 * tagsTaken, 1);
+
+    TagNode<timeStamps> *nodes[tagsTaken];
+    for (auto &node : nodes) {
+        node = tagAllocator.getTag();
+    }
+    auto &threadCache = tagAllocator.getCurrentThreadCache();
+    while (auto cachedNode = threadCache.tags.removeFrontOne().release()) {
+        tagAllocator.getFreeTags().pushFrontOne(*cachedNode);
+    }
+    threadCache.count = 0;
+
+    for (size_t i = 0; i < TagAllocatorThreadCaches::maxCachedTags; i++) {
+        tagAllocator.returnTag(nodes[i]);
+    }
+    EXPECT_EQ(TagAllocatorThreadCaches::maxCachedTags - 1, threadCache.tags.peekHead()->countSuccessors());
+
+    tagAllocator.returnTag(nodes[TagAllocatorThreadCaches::maxCachedTags]);
+    EXPECT_EQ(batchSize, threadCache.count);
+    EXPECT_EQ(batchSize - 1, threadCache.tags.peekHead()->countSuccessors());
+    for (auto node : nodes) {
+        EXPECT_TRUE(tagAllocator.isTagFree(*node));
+    }
+}
+
+TEST_F(TagAllocatorTest, givenTwoAllocatorsUsedByOneThreadWhenTagsAreReturnedThenEachAllocatorCachesOwnTags) {
+    MockTagAllocator tagAllocator1(memoryManager, 4, 1);
+    MockTagAllocator tagAllocator2(memoryManager, 4, 1);
+
+    auto node1 = tagAllocator1.getTag();
+    auto node2 = tagAllocator2.getTag();
+    tagAllocator1.returnTag(node1);
+    tagAllocator2.returnTag(node2);
+
+    EXPECT_NE(&tagAllocator1.getCurrentThreadCache(), &tagAllocator2.getCurrentThreadCache());
+    EXPECT_TRUE(tagAllocator1.getCurrentThreadCache().tags.peekContains(*node1));
+    EXPECT_FALSE(tagAllocator1.getCurrentThreadCache().tags.peekContains(*node2));
+    EXPECT_TRUE(tagAllocator2.getCurrentThreadCache().tags.peekContains(*node2));
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/telemetry.h"
+#include "gtest/gtest.h"
+
+#include <limits>
+#include <sstream>
+#include <thread>
+
+using namespace OCLRT;
+
+class TelemetryTest : public ::testing::Test {
+  public:
+    void SetUp() override {
+        wasEnabled = Telemetry::isEnabled();
+        Telemetry::setEnabled(true);
+        Telemetry::reset();
+    }
+
+    void TearDown() override {
+        Telemetry::reset();
+        Telemetry::setEnabled(wasEnabled);
+    }
+
+    bool wasEnabled = false;
+};
+
+TEST(TelemetryHistogramTest, givenSmallValuesWhenGettingBucketIndexThenValueIsUsedAsIndex) {
+    for (uint64_t value = 0; value < TelemetryHistogram::subBucketsCount; value++) {
+        EXPECT_EQ(value, TelemetryHistogram::getBucketIndex(value));
+        EXPECT_EQ(value, TelemetryHistogram::getBucketLowerBound(static_cast<uint32_t>(value)));
+    }
+}
+
+TEST(TelemetryHistogramTest, givenValueWhenGettingBucketIndexThenValueIsWithinBucketBounds) {
+    for (uint64_t value = 1; value < (1ull << 20); value = value * 3 / 2 + 1) {
+        auto bucketIndex = TelemetryHistogram::getBucketIndex(value);
+        EXPECT_LE(TelemetryHistogram::getBucketLowerBound(bucketIndex), value);
+        EXPECT_GT(TelemetryHistogram::getBucketLowerBound(bucketIndex + 1), value);
+    }
+}
+
+TEST(TelemetryHistogramTest, givenMaxValueWhenGettingBucketIndexThenIndexIsWithinHistogram) {
+    EXPECT_LT(TelemetryHistogram::getBucketIndex(std::numeric_limits<uint64_t>::max()), TelemetryHistogram::bucketsCount);
+}
+
+TEST_F(TelemetryTest, givenRecordedSamplesWhenCollectingThenCountTotalAndMaxAreReturned) {
+    Telemetry::record(TelemetryCounter::FlushTask, 10);
+    Telemetry::record(TelemetryCounter::FlushTask, 1000);
+    Telemetry::record(TelemetryCounter::Allocation, 5);
+
+    TelemetryCounterData data;
+    Telemetry::collect(TelemetryCounter::FlushTask, data);
+    EXPECT_EQ(2u, data.count);
+    EXPECT_EQ(1010u, data.totalNanoseconds);
+    EXPECT_EQ(1000u, data.maxNanoseconds);
+    EXPECT_EQ(1u, data.histogram[TelemetryHistogram::getBucketIndex(10)]);
+    EXPECT_EQ(1u, data.histogram[TelemetryHistogram::getBucketIndex(1000)]);
+
+    Telemetry::collect(TelemetryCounter::Allocation, data);
+    EXPECT_EQ(1u, data.count);
+}
+
+TEST_F(TelemetryTest, givenTelemetryDisabledWhenScopeEndsThenNothingIsRecorded) {
+    Telemetry::setEnabled(false);
+    {
+        TelemetryScope scope(TelemetryCounter::Residency);
+    }
+
+    TelemetryCounterData data;
+    Telemetry::collect(TelemetryCounter::Residency, data);
+    EXPECT_EQ(0u, data.count);
+}
+
+TEST_F(TelemetryTest, givenTelemetryEnabledWhenScopeEndsThenSampleIsRecorded) {
+    {
+        TelemetryScope scope(TelemetryCounter::Residency);
+    }
+
+    TelemetryCounterData data;
+    Telemetry::collect(TelemetryCounter::Residency, data);
+    EXPECT_EQ(1u, data.count);
+}
+
+TEST_F(TelemetryTest, givenSamplesRecordedByExitedThreadWhenCollectingThenTheyAreIncluded) {
+    std::thread thread([]() {
+        for (uint32_t i = 0; i < 10; i++) {
+            Telemetry::record(TelemetryCounter::Flush, 1);
+        }
+    });
+    thread.join();
+    Telemetry::record(TelemetryCounter::Flush, 1);
+
+    TelemetryCounterData data;
+    Telemetry::collect(TelemetryCounter::Flush, data);
+    EXPECT_EQ(11u, data.count);
+}
+
+TEST_F(TelemetryTest, givenRecordedSamplesWhenDumpingThenEveryCounterIsPrinted) {
+    Telemetry::record(TelemetryCounter::WaitForTaskCount, 42);
+
+    std::stringstream output;
+    Telemetry::dump(output);
+
+    for (uint32_t i = 0; i < Telemetry::countersCount; i++) {
+        EXPECT_NE(std::string::npos, output.str().find(Telemetry::getCounterName(static_cast<TelemetryCounter>(i))));
+    }
+    EXPECT_NE(std::string::npos, output.str().find("WaitForTaskCount count=1 totalNs=42 maxNs=42"));
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/telemetry.h"
+#include "runtime/utilities/trace_recorder.h"
+#include "CL/cl.h"
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <thread>
+
+using namespace OCLRT;
+
+class TraceRecorderTest : public ::testing::Test {
+  public:
+    void SetUp() override {
+        wasEnabled = TraceRecorder::isEnabled();
+        TraceRecorder::setEnabled(true);
+        TraceRecorder::clear();
+    }
+
+    void TearDown() override {
+        TraceRecorder::clear();
+        TraceRecorder::setEnabled(wasEnabled);
+    }
+
+    bool wasEnabled = false;
+};
+
+TEST_F(TraceRecorderTest, givenRecordedSpansWhenCollectingThenAllSpansAreReturned) {
+    TraceRecorder::recordCpuSpan("cpuSpan", 100, 20);
+    TraceRecorder::recordGpuSpan(CL_COMMAND_NDRANGE_KERNEL, 7, 110, 5);
+
+    std::vector<TraceEvent> events;
+    TraceRecorder::collect(events);
+
+    ASSERT_EQ(2u, events.size());
+    EXPECT_FALSE(events[0].gpu);
+    EXPECT_STREQ("cpuSpan", events[0].name);
+    EXPECT_EQ(100u, events[0].startNs);
+    EXPECT_EQ(20u, events[0].durationNs);
+    EXPECT_TRUE(events[1].gpu);
+    EXPECT_EQ(static_cast<uint32_t>(CL_COMMAND_NDRANGE_KERNEL), events[1].commandType);
+    EXPECT_EQ(7u, events[1].trackId);
+}
+
+TEST_F(TraceRecorderTest, givenFullThreadBufferWhenRecordingThenNoSpanIsLost) {
+    for (uint32_t i = 0; i < TraceRecorder::threadBufferCapacity * 2 + 1; i++) {
+        TraceRecorder::recordCpuSpan("cpuSpan", i, 1);
+    }
+
+    std::vector<TraceEvent> events;
+    TraceRecorder::collect(events);
+    EXPECT_EQ(TraceRecorder::threadBufferCapacity * 2 + 1, events.size());
+}
+
+TEST_F(TraceRecorderTest, givenSpansRecordedByExitedThreadWhenCollectingThenTheyAreOnSeparateTrack) {
+    TraceRecorder::recordCpuSpan("mainThread", 0, 1);
+    std::thread thread([]() {
+        TraceRecorder::recordCpuSpan("workerThread", 0, 1);
+    });
+    thread.join();
+
+    std::vector<TraceEvent> events;
+    TraceRecorder::collect(events);
+    ASSERT_EQ(2u, events.size());
+    EXPECT_NE(events[0].trackId, events[1].trackId);
+}
+
+TEST_F(TraceRecorderTest, givenTelemetryScopeWhenTracingIsEnabledThenNamedCpuSpanIsRecorded) {
+    auto telemetryWasEnabled = Telemetry::isEnabled();
+    Telemetry::setEnabled(false);
+    {
+        TelemetryScope scope(TelemetryCounter::ApiCall, "clFinish");
+    }
+    {
+        TelemetryScope scope(TelemetryCounter::FlushTask);
+    }
+    Telemetry::setEnabled(telemetryWasEnabled);
+
+    std::vector<TraceEvent> events;
+    TraceRecorder::collect(events);
+    ASSERT_EQ(2u, events.size());
+    EXPECT_STREQ("clFinish", events[0].name);
+    EXPECT_STREQ("FlushTask", events[1].name);
+}
+
+TEST_F(TraceRecorderTest, givenRecordedSpansWhenWritingChromeTraceThenJsonWithCpuAndGpuSpansIsWritten) {
+    TraceRecorder::recordCpuSpan("clEnqueueNDRangeKernel", 1500, 250);
+    TraceRecorder::recordGpuSpan(CL_COMMAND_NDRANGE_KERNEL, 3, 2001, 1000);
+
+    std::stringstream output;
+    TraceRecorder::writeChromeTrace(output);
+    auto trace = output.str();
+
+    EXPECT_EQ(0u, trace.find("{\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"clEnqueueNDRangeKernel\",\"cat\":\"cpu\",\"ph\":\"X\",\"ts\":1.500,\"dur\":0.250,\"pid\":1,\"tid\":"));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"CL_COMMAND_NDRANGE_KERNEL\",\"cat\":\"gpu\",\"ph\":\"X\",\"ts\":2.001,\"dur\":1.000,\"pid\":2,\"tid\":3}"));
+}
@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/aligned_memory.h"
+#include "runtime/utilities/va_arena_allocator.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace OCLRT;
+
+namespace {
+constexpr uint64_t heapBase = 0x100000000llu;
+constexpr uint64_t heapSize = 64 * MemoryConstants::megaByte;
+} // namespace
+
+TEST(VaArenaAllocatorTest, givenSmallAndMediumSizesWhenAllocatingThenSizesAreRoundedToTheirClasses) {
+    VaArenaAllocator allocator(heapBase, heapSize);
+
+    size_t size = 1;
+    EXPECT_NE(0llu, allocator.allocate(size));
+    EXPECT_EQ(MemoryConstants::pageSize, size);
+
+    size = 3 * MemoryConstants::pageSize + 1;
+    EXPECT_NE(0llu, allocator.allocate(size));
+    EXPECT_EQ(4 * MemoryConstants::pageSize, size);
+
+    size = MemoryConstants::pageSize64k + 1;
+    auto ptr = allocator.allocate(size);
+    EXPECT_NE(0llu, ptr);
+    EXPECT_EQ(2 * MemoryConstants::pageSize64k, size);
+    EXPECT_TRUE(isAligned<MemoryConstants::pageSize64k>(ptr));
+}
+
+TEST(VaArenaAllocatorTest, givenAllocationsOfSameClassWhenAllocatingThenTheyArePackedInSingleAlignedSlab) {
+    VaArenaAllocator allocator(heapBase, heapSize);
+
+    std::vector<uint64_t> ptrs;
+    for (uint32_t i = 0; i < VaArenaAllocator::slabSize / MemoryConstants::pageSize; i++) {
+        size_t size = MemoryConstants::pageSize;
+        ptrs.push_back(allocator.allocate(size));
+        ASSERT_NE(0llu, ptrs.back());
+    }
+    auto slabAddress = alignDown(ptrs[0], VaArenaAllocator::slabSize);
+    for (auto ptr : ptrs) {
+        EXPECT_EQ(slabAddress, alignDown(ptr, VaArenaAllocator::slabSize));
+    }
+
+    auto statistics = allocator.getStatistics();
+    EXPECT_EQ(1u, statistics.slabsCount);
+    EXPECT_EQ(VaArenaAllocator::slabSize, statistics.slabsUsedSize);
+    EXPECT_EQ(0.0, statistics.getSlabsFragmentation());
+
+    size_t size = MemoryConstants::pageSize;
+    allocator.allocate(size);
+    EXPECT_EQ(2u, allocator.getStatistics().slabsCount);
+}
+
+TEST(VaArenaAllocatorTest, givenHeapEndNotAlignedToSlabWhenAllocatingThenSlabsAreAligned) {
+    VaArenaAllocator allocator(heapBase + MemoryConstants::pageSize, heapSize + 3 * MemoryConstants::pageSize);
+
+    size_t size = MemoryConstants::pageSize64k;
+    auto ptr = allocator.allocate(size);
+    EXPECT_TRUE(isAligned<VaArenaAllocator::slabSize>(ptr));
+
+    size = 2 * MemoryConstants::pageSize;
+    ptr = allocator.allocate(size);
+    EXPECT_TRUE(isAligned<VaArenaAllocator::slabSize>(ptr));
+}
+
+TEST(VaArenaAllocatorTest, givenHeapEndNotAlignedToSlabWhenAllocatingAboveHalfOfSlabFirstThenItIsAligned) {
+    VaArenaAllocator allocator(heapBase + MemoryConstants::pageSize, heapSize + 3 * MemoryConstants::pageSize);
+
+    size_t size = VaArenaAllocator::mediumAllocationMaxSize + 1;
+    auto ptr = allocator.allocate(size);
+    EXPECT_TRUE(isAligned<VaArenaAllocator::slabSize>(ptr));
+
+    size = MemoryConstants::pageSize;
+    ptr = allocator.allocate(size);
+    EXPECT_TRUE(isAligned<VaArenaAllocator::slabSize>(ptr));
+}
+
+TEST(VaArenaAllocatorTest, givenHugeAllocationWhenAllocatingThenItIsTakenDirectlyFromHeap) {
+    VaArenaAllocator allocator(heapBase, heapSize);
+
+    size_t size = VaArenaAllocator::slabSize + 1;
+    auto ptr = allocator.allocate(size);
+    EXPECT_EQ(heapBase, ptr);
+    EXPECT_EQ(VaArenaAllocator::slabSize + MemoryConstants::pageSize, size);
+
+    auto statistics = allocator.getStatistics();
+    EXPECT_EQ(0u, statistics.slabsCount);
+    EXPECT_EQ(size, statistics.hugeUsedSize);
+    EXPECT_EQ(heapSize - size, statistics.freeSize);
+
+    allocator.free(ptr, size);
+    EXPECT_EQ(0u, allocator.getStatistics().hugeUsedSize);
+    EXPECT_EQ(heapSize, allocator.getStatistics().freeSize);
+}
+
+TEST(VaArenaAllocatorTest, givenSizeAboveHalfOfSlabWhenAllocatingThenItIsTakenDirectlyFromHeap) {
+    VaArenaAllocator allocator(heapBase, heapSize);
+
+    size_t size = VaArenaAllocator::mediumAllocationMaxSize;
+    EXPECT_NE(0llu, allocator.allocate(size));
+    EXPECT_EQ(1u, allocator.getStatistics().slabsCount);
+    EXPECT_EQ(0u, allocator.getStatistics().hugeUsedSize);
+
+    size = VaArenaAllocator::mediumAllocationMaxSize + 1;
+    auto ptr = allocator.allocate(size);
+    EXPECT_NE(0llu, ptr);
+    EXPECT_TRUE(isAligned<VaArenaAllocator::slabSize>(ptr));
+    EXPECT_EQ(VaArenaAllocator::slabSize, size);
+    EXPECT_EQ(1u, allocator.getStatistics().slabsCount);
+    EXPECT_EQ(size, allocator.getStatistics().hugeUsedSize);
+
+    allocator.free(ptr, VaArenaAllocator::mediumAllocationMaxSize + 1);
+    EXPECT_EQ(0u, allocator.getStatistics().hugeUsedSize);
+    EXPECT_EQ(heapSize - VaArenaAllocator::slabSize, allocator.getStatistics().freeSize);
+}
+
+TEST(VaArenaAllocatorTest, givenFreedBlockWhenAllocatingSameClassThenBlockIsReused) {
+    VaArenaAllocator allocator(heapBase, heapSize);
+
+    size_t size = 3 * MemoryConstants::pageSize;
+    auto ptr1 = allocator.allocate(size);
+    auto ptr2 = allocator.allocate(size);
+    EXPECT_EQ(ptr1 + size, ptr2);
+
+    allocator.free(ptr1, size);
+    EXPECT_EQ(ptr1, allocator.allocate(size));
+}
+
+TEST(VaArenaAllocatorTest, givenEmptySlabsWhenFreeingThenOnlySingleEmptySlabOfClassIsKept) {
+    VaArenaAllocator allocator(heapBase, heapSize);
+
+    std::vector<uint64_t> ptrs;
+    size_t size = VaArenaAllocator::slabSize / 2;
+    for (uint32_t i = 0; i < 6; i++) {
+        ptrs.push_back(allocator.allocate(size));
+        ASSERT_NE(0llu, ptrs.back());
+    }
+    EXPECT_EQ(3u, allocator.getStatistics().slabsCount);
+
+    for (auto ptr : ptrs) {
+        allocator.free(ptr, size);
+    }
+    auto statistics = allocator.getStatistics();
+    EXPECT_EQ(1u, statistics.slabsCount);
+    EXPECT_EQ(0u, statistics.slabsUsedSize);
+    EXPECT_EQ(heapSize - VaArenaAllocator::slabSize, statistics.freeSize);
+}
+
+TEST(VaArenaAllocatorTest, givenEmptySlabsOfManyClassesWhenFreeingThenNumberOfKeptEmptySlabsIsLimited) {
+    VaArenaAllocator allocator(heapBase, heapSize);
+
+    std::vector<std::pair<uint64_t, size_t>> allocations;
+    for (uint32_t i = 0; i < 2 * VaArenaAllocator::maxEmptySlabsCount; i++) {
+        size_t size = MemoryConstants::pageSize * (i + 1);
+        allocations.emplace_back(allocator.allocate(size), size);
+        ASSERT_NE(0llu, allocations.back().first);
+    }
+    EXPECT_EQ(2 * VaArenaAllocator::maxEmptySlabsCount, allocator.getStatistics().slabsCount);
+
+    for (auto &allocation : allocations) {
+        allocator.free(allocation.first, allocation.second);
+    }
+    EXPECT_EQ(VaArenaAllocator::maxEmptySlabsCount, allocator.getStatistics().slabsCount);
+
+    auto &allocation = allocations.front();
+    EXPECT_EQ(allocation.first, allocator.allocate(allocation.second));
+    EXPECT_EQ(VaArenaAllocator::maxEmptySlabsCount, allocator.getStatistics().slabsCount);
+
+    size_t size = allocations.back().second;
+    auto ptr = allocator.allocate(size);
+    EXPECT_EQ(VaArenaAllocator::maxEmptySlabsCount + 1, allocator.getStatistics().slabsCount);
+    allocator.free(ptr, size);
+    EXPECT_EQ(VaArenaAllocator::maxEmptySlabsCount + 1, allocator.getStatistics().slabsCount);
+}
+
+TEST(VaArenaAllocatorTest, givenInterleavedAllocationsOfDifferentSizesWhenSmallOnesAreFreedThenFreeRangeIsNotFragmented) {
+    VaArenaAllocator allocator(heapBase, heapSize);
+
+    std::vector<std::pair<uint64_t, size_t>> small;
+    std::vector<std::pair<uint64_t, size_t>> medium;
+    for (uint32_t i = 0; i < 64; i++) {
+        size_t size = MemoryConstants::pageSize * (1 + i % 4);
+        small.emplace_back(allocator.allocate(size), size);
+        size = MemoryConstants::pageSize64k * 4;
+        medium.emplace_back(allocator.allocate(size), size);
+    }
+    for (auto &allocation : small) {
+        allocator.free(allocation.first, allocation.second);
+    }
+
+    auto statistics = allocator.getStatistics();
+    EXPECT_EQ(0u, statistics.hugeUsedSize);
+    EXPECT_EQ(statistics.freeSize, statistics.largestFreeChunkSize);
+    EXPECT_EQ(0.0, statistics.getHeapFragmentation());
+
+    for (auto &allocation : medium) {
+        allocator.free(allocation.first, allocation.second);
+    }
+    EXPECT_EQ(0u, allocator.getStatistics().slabsUsedSize);
+}
+
+TEST(VaArenaAllocatorTest, givenExhaustedHeapWhenAllocatingThenZeroIsReturned) {
+    VaArenaAllocator allocator(heapBase, 2 * VaArenaAllocator::slabSize);
+
+    size_t size = VaArenaAllocator::slabSize;
+    EXPECT_NE(0llu, allocator.allocate(size));
+    EXPECT_NE(0llu, allocator.allocate(size));
+    EXPECT_EQ(0llu, allocator.allocate(size));
+
+    size = MemoryConstants::pageSize;
+    EXPECT_EQ(0llu, allocator.allocate(size));
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2018 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/cpu_list.h"
+#include "runtime/utilities/debug_settings_reader.h"
+#include "runtime/utilities/worker_pool.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <map>
+
+using namespace OCLRT;
+
+class MockPolicySettingsReader : public SettingsReader {
+  public:
+    int32_t getSetting(const char *settingName, int32_t defaultValue) override {
+        auto it = intSettings.find(settingName);
+        return it != intSettings.end() ? it->second : defaultValue;
+    }
+    bool getSetting(const char *settingName, bool defaultValue) override {
+        return defaultValue;
+    }
+    std::string getSetting(const char *settingName, const std::string &value) override {
+        auto it = stringSettings.find(settingName);
+        return it != stringSettings.end() ? it->second : value;
+    }
+
+    std::map<std::string, int32_t> intSettings;
+    std::map<std::string, std::string> stringSettings;
+};
+
+TEST(CpuListTest, givenRangesAndSingleCpusWhenParsingThenAllCpusAreReturned) {
+    std::vector<uint32_t> expected = {0, 1, 2, 3, 8, 10, 11};
+    EXPECT_EQ(expected, parseCpuList("0-3,8,10-11"));
+}
+
+TEST(CpuListTest, givenMalformedEntriesWhenParsingThenTheyAreSkipped) {
+    EXPECT_TRUE(parseCpuList("").empty());
+    EXPECT_TRUE(parseCpuList("5-3").empty());
+    std::vector<uint32_t> expected = {2};
+    EXPECT_EQ(expected, parseCpuList("x,2,-"));
+}
+
+TEST(BackgroundThreadPolicyTest, givenNoSettingsWhenCreatingPolicyThenThreadsAreNotPinnedAndPriorityIsUnchanged) {
+    MockPolicySettingsReader settingsReader;
+    auto policy = BackgroundThreadPolicy::create(settingsReader);
+    EXPECT_TRUE(policy.cpus.empty());
+    EXPECT_EQ(0, policy.priorityDecrease);
+}
+
+TEST(BackgroundThreadPolicyTest, givenCpuListAndNumaNodeWhenCreatingPolicyThenCpuListIsUsed) {
+    MockPolicySettingsReader settingsReader;
+    settingsReader.stringSettings["BackgroundThreadsCpuList"] = "4-5";
+    settingsReader.intSettings["BackgroundThreadsNumaNode"] = 0;
+    settingsReader.intSettings["BackgroundThreadsPriorityDecrease"] = 3;
+
+    auto policy = BackgroundThreadPolicy::create(settingsReader);
+    std::vector<uint32_t> expected = {4, 5};
+    EXPECT_EQ(expected, policy.cpus);
+    EXPECT_EQ(3, policy.priorityDecrease);
+}
+
+TEST(BackgroundThreadPolicyTest, givenNegativePriorityDecreaseWhenCreatingPolicyThenPriorityIsNotRaised) {
+    MockPolicySettingsReader settingsReader;
+    settingsReader.intSettings["BackgroundThreadsPriorityDecrease"] = -5;
+    EXPECT_EQ(0, BackgroundThreadPolicy::create(settingsReader).priorityDecrease);
+}
+
+TEST(WorkerPoolTest, givenRequestedThreadsCountWhenAskingForDefaultThenRequestedCountIsReturned) {
+    EXPECT_EQ(3u, WorkerPool::getDefaultThreadsCount(3));
+    auto defaultCount = WorkerPool::getDefaultThreadsCount(-1);
+    EXPECT_LE(1u, defaultCount);
+    EXPECT_GE(2u, defaultCount);
+}
+
+TEST(WorkerPoolTest, givenSubmittedTasksWhenPoolIsDestroyedThenAllTasksAreExecuted) {
+    std::atomic<uint32_t> executedTasks{0};
+    {
+        WorkerPool pool(3, BackgroundThreadPolicy{});
+        EXPECT_EQ(3u, pool.getThreadsCount());
+        for (uint32_t i = 0; i < 100; i++) {
+            pool.submit([&executedTasks]() { executedTasks++; });
+        }
+    }
+    EXPECT_EQ(100u, executedTasks);
+}
+
+TEST(WorkerPoolTest, givenTaskSubmittedFromWorkerWhenPoolIsDestroyedThenNestedTaskIsExecuted) {
+    std::atomic<uint32_t> executedTasks{0};
+    {
+        WorkerPool pool(2, BackgroundThreadPolicy{});
+        pool.submit([&]() {
+            executedTasks++;
+            pool.submit([&executedTasks]() { executedTasks++; });
+        });
+    }
+    EXPECT_EQ(2u, executedTasks);
+}
+
+TEST(WorkerPoolTest, givenAcquiredPoolWhenAcquiringAgainThenSamePoolIsReturned) {
+    auto pool = WorkerPool::acquire();
+    ASSERT_NE(nullptr, pool.get());
+    EXPECT_EQ(pool.get(), WorkerPool::acquire().get());
+}